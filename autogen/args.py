@@ -1,4 +1,5 @@
 import argparse
+import os
 
 
 class Args:
@@ -26,20 +27,33 @@ class Args:
             "-t",
             "--template",
             type=str,
+            nargs="+",
             required=True,
-            help="Path to the template file used for code generation (absolute path).",
+            help="Paths to the template files used for code generation (absolute paths).",
         )
 
         parser.add_argument(
             "-o",
             "--output",
             type=str,
+            nargs="+",
             required=True,
-            help="Path to the output file where the generated code will be saved (absolute path).",
+            help="Paths to the output files where the generated code will be saved (absolute paths), one per template.",
+        )
+
+        parser.add_argument(
+            "-j",
+            "--jobs",
+            type=int,
+            default=os.cpu_count() or 1,
+            help="Maximum number of processes parsing the input files (default: the number of CPUs).",
         )
 
         self._args = parser.parse_args()
 
+        if len(self._args.template) != len(self._args.output):
+            parser.error("--template and --output must have the same number of files.")
+
     @property
     def InputFiles(self) -> list[str]:
         return self._args.input
@@ -49,9 +63,13 @@ class Args:
         return self._args.clang_path
 
     @property
-    def TemplateFile(self) -> str:
+    def TemplateFiles(self) -> list[str]:
         return self._args.template
 
     @property
-    def OutputFile(self) -> str:
+    def OutputFiles(self) -> list[str]:
         return self._args.output
+
+    @property
+    def Jobs(self) -> int:
+        return self._args.jobs
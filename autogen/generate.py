@@ -1,9 +1,13 @@
 import os
+from typing import Any
 from jinja2 import Environment, FileSystemLoader
-from parser import Parse, Structure
+from parser import CreateStructure, Parse, ParseFiles, Structure
 from parser.py_class import PyClass
+from parser.py_field import PyField
 from parser.py_function import PyFunction
 from parser.py_object import PyObject
+from parser.py_struct import PyStruct
+from timing import PhaseTimer
 from type_map.type_map import TypeMap
 
 
@@ -32,29 +36,88 @@ def Generate(
         str: The generated code as a string.
     """
 
-    templateDir = os.path.dirname(templateFile)
-    templateName = os.path.basename(templateFile)
+    return GenerateAll(inputFiles, [templateFile], testContent)[0]
 
-    env = Environment(
-        loader=FileSystemLoader(templateDir),
-    )
-    template = env.get_template(templateName)
 
-    parser: Structure = {
-        "enums": [],
-        "structs": [],
-        "functions": [],
-        "classes": [],
-    }
+def GenerateAll(
+    inputFiles: list[str],
+    templateFiles: list[str],
+    testContent: str | None = None,
+    jobs: int = 1,
+    clangPath: str | None = None,
+    timer: PhaseTimer | None = None,
+) -> list[str]:
+    """
+    Same as `Generate` for several templates: the source code is parsed once and every template is rendered from
+    the same models.
+
+    Parameters
+    ----------
+        inputFiles (List[str])
+            Paths to the C/C++ source files to be analyzed (absolute paths), parsed in parallel processes.
+
+        templateFiles (List[str])
+            Paths to the template files used for code generation (absolute paths).
+
+        testContent (str | None)
+            Optional string content for testing purposes.
+
+        jobs (int)
+            The maximum number of processes parsing the input files.
+
+        clangPath (str | None)
+            Path to the libclang library, given to the parsing processes.
+
+        timer (PhaseTimer | None)
+            Receives the time spent in the `parse`, `model` and `render` phases.
+
+    Returns
+    -------
+        list[str]: The generated code for each template, in the same order.
+    """
+
+    timer = timer if timer is not None else PhaseTimer()
+
+    with timer.Measure("parse"):
+        if testContent is None:
+            parser = ParseFiles(inputFiles, jobs, clangPath)
+        else:
+            parser = CreateStructure()
+            for inputFile in inputFiles:
+                Parse(inputFile, parser, testContent)
+
+    with timer.Measure("model"):
+        templateGlobals = _CreateTemplateGlobals(parser)
+
+    outputs: list[str] = []
+    environments: dict[str, Environment] = {}
+
+    with timer.Measure("render"):
+        for templateFile in templateFiles:
+            templateDir = os.path.dirname(templateFile)
+            templateName = os.path.basename(templateFile)
+
+            if templateDir not in environments:
+                environments[templateDir] = Environment(
+                    loader=FileSystemLoader(templateDir),
+                )
+
+            template = environments[templateDir].get_template(templateName)
+            template.globals.update(templateGlobals)
 
-    for inputFile in inputFiles:
-        Parse(inputFile, parser, testContent)
+            outputs.append(template.render(**parser))
+
+    return outputs
+
+
+def _CreateTemplateGlobals(parser: Structure) -> dict[str, Any]:
+    """
+    Creates the helpers used by the templates, for the parsed structure.
+    """
 
     typeMap = TypeMap()
     typeMap.LoadMappings()
 
-    template.globals["convertCppTypeToPyType"] = typeMap.Convert
-
     def IsMethodStatic(parent: PyObject, method: PyObject) -> bool:
         assert isinstance(parent, PyClass)
         assert isinstance(method, PyFunction)
@@ -112,6 +175,34 @@ def Generate(
                 return annotation[len(keyNamePrefix) :]
         return ""
 
+    def JsonVersion(obj: PyObject) -> int:
+        versionPrefix = "version:"
+        for annotation in obj.annotations:
+            if annotation.startswith(versionPrefix):
+                return int(annotation[len(versionPrefix) :])
+        return 0
+
+    def JsonValueType(field: PyObject) -> str:
+        assert isinstance(field, PyField)
+
+        if "Array" in field.type:
+            return "JsonValueType::ARRAY"
+        elif field.type in allJsonMappedClasses:
+            return "JsonValueType::OBJECT"
+        elif field.type in ["String", "const char *"]:
+            return "JsonValueType::STRING"
+        elif field.type in ["b8", "bool"]:
+            return "JsonValueType::BOOLEAN"
+        return "JsonValueType::NUMBER"
+
+    def HasJsonMigration(obj: PyObject) -> bool:
+        assert isinstance(obj, PyStruct)
+
+        for method in obj.methods:
+            if method.name == "Migrate" and method.isStatic:
+                return True
+        return False
+
     def ObjectComment(obj: PyObject, default: str) -> str:
         return obj.comment if obj.comment else default
 
@@ -188,17 +279,21 @@ def Generate(
         if "json" in struct.annotations:
             allJsonMappedClasses.append(struct.name)
 
-    template.globals["isMethodStatic"] = IsMethodStatic
-    template.globals["methodParametersPyi"] = MethodParametersPyi
-    template.globals["methodParametersCpp"] = MethodParametersCpp
-    template.globals["methodParametersCall"] = MethodParametersCall
-    template.globals["objectComment"] = ObjectComment
-    template.globals["isContainsJsonKeyAnnotation"] = IsContainsJsonKeyAnnotation
-    template.globals["methodParametersTypeList"] = MethodParametersTypeList
-    template.globals["allJsonMappedClasses"] = allJsonMappedClasses
-    template.globals["e2eBindingType"] = E2EBindingType
-    template.globals["convertAllFunctionParametersToE2EBindingTypeList"] = (
-        ConvertAllFunctionParametersToE2EBindingTypeList
-    )
-
-    return template.render(**parser)
+    return {
+        "convertCppTypeToPyType": typeMap.Convert,
+        "isMethodStatic": IsMethodStatic,
+        "methodParametersPyi": MethodParametersPyi,
+        "methodParametersCpp": MethodParametersCpp,
+        "methodParametersCall": MethodParametersCall,
+        "objectComment": ObjectComment,
+        "isContainsJsonKeyAnnotation": IsContainsJsonKeyAnnotation,
+        "jsonVersion": JsonVersion,
+        "jsonValueType": JsonValueType,
+        "hasJsonMigration": HasJsonMigration,
+        "methodParametersTypeList": MethodParametersTypeList,
+        "allJsonMappedClasses": allJsonMappedClasses,
+        "e2eBindingType": E2EBindingType,
+        "convertAllFunctionParametersToE2EBindingTypeList": (
+            ConvertAllFunctionParametersToE2EBindingTypeList
+        ),
+    }
@@ -1,6 +1,8 @@
 import clang.cindex
 from args import Args
-from generate import Generate
+from generate import GenerateAll
+from output import WriteIfChanged
+from timing import PhaseTimer
 
 
 def ConfigureClangLibrary(clangPath: str) -> None:
@@ -11,10 +13,22 @@ def main():
     args = Args()
 
     ConfigureClangLibrary(args.ClangPath)
-    output = Generate(args.InputFiles, args.TemplateFile)
 
-    with open(args.OutputFile, "w", encoding="utf-8") as f:
-        f.write(output)
+    timer = PhaseTimer()
+    outputs = GenerateAll(
+        args.InputFiles,
+        args.TemplateFiles,
+        jobs=args.Jobs,
+        clangPath=args.ClangPath,
+        timer=timer,
+    )
+
+    with timer.Measure("write"):
+        # unchanged bindings are not rewritten, so they do not trigger a rebuild of the libraries
+        for outputFile, output in zip(args.OutputFiles, outputs):
+            WriteIfChanged(outputFile, output)
+
+    print(timer.Report())
 
 
 if __name__ == "__main__":
@@ -0,0 +1,30 @@
+import os
+
+
+def WriteIfChanged(outputFile: str, content: str) -> bool:
+    """
+    Writes the generated code into the output file, unless the file already has exactly this content. The untouched
+    file keeps its modification time, so the build system does not recompile what depends on it.
+
+    Parameters
+    ----------
+        outputFile (str)
+            Path to the output file (absolute path).
+
+        content (str)
+            The generated code.
+
+    Returns
+    -------
+        bool: True if the file was written, False if it was already up to date.
+    """
+
+    if os.path.isfile(outputFile):
+        with open(outputFile, "r", encoding="utf-8", newline="") as f:
+            if f.read() == content:
+                return False
+
+    with open(outputFile, "w", encoding="utf-8", newline="") as f:
+        f.write(content)
+
+    return True
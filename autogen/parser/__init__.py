@@ -1,5 +1,6 @@
 import clang.cindex
 from clang.cindex import Cursor, TranslationUnit
+from concurrent.futures import ProcessPoolExecutor
 from typing import Literal, TypeAlias
 
 from parser.py_function import PyFunction
@@ -104,3 +105,113 @@ def Parse(
                 elif c.kind == clang.cindex.CursorKind.CLASS_DECL:
                     pyClass = PyClass(c)
                     structure["classes"].append(pyClass)
+
+
+def CreateStructure() -> Structure:
+    """
+    Creates an empty structure to be filled by `Parse`.
+    """
+    return {
+        "enums": [],
+        "structs": [],
+        "functions": [],
+        "classes": [],
+    }
+
+
+def _ObjectKey(obj: CStruct) -> tuple[str, ...]:
+    """
+    The identity of a parsed object: the same declaration is found in every translation unit which includes it.
+    Functions are identified by their parameter types too, so the overloads are kept.
+    """
+    if isinstance(obj, PyFunction):
+        return (obj.name,) + tuple(param.type for param in obj.parameters)
+    return (obj.name,)
+
+
+def MergeStructures(structures: list[Structure]) -> Structure:
+    """
+    Merges the structures parsed from several translation units. The result only depends on the order of
+    `structures` (the order of the input files), never on which parsing finished first: the objects keep their
+    declaration order and the duplicates (headers included by several inputs) keep their first occurrence.
+
+    Parameters
+    ----------
+        structures (list[Structure])
+            The structures in the order of the input files.
+
+    Returns
+    -------
+        Structure: The merged structure.
+    """
+
+    merged = CreateStructure()
+
+    for category in merged:
+        seenKeys: set[tuple[str, ...]] = set()
+
+        for structure in structures:
+            for obj in structure[category]:
+                key = _ObjectKey(obj)
+                if key in seenKeys:
+                    continue
+
+                seenKeys.add(key)
+                merged[category].append(obj)
+
+    return merged
+
+
+def _InitializeWorker(clangPath: str | None) -> None:
+    """
+    Configures libclang in a worker process (needed when the processes are spawned instead of forked).
+    """
+    if clangPath is not None and not clang.cindex.Config.loaded:
+        clang.cindex.Config.set_library_file(clangPath)  # type: ignore
+
+
+def _ParseFile(inputFile: str) -> Structure:
+    structure = CreateStructure()
+    Parse(inputFile, structure)
+    return structure
+
+
+def ParseFiles(
+    inputFiles: list[str],
+    jobs: int = 1,
+    clangPath: str | None = None,
+) -> Structure:
+    """
+    Parses several translation units, in parallel processes when there are more than one, and merges the result
+    with `MergeStructures` so the output does not depend on the scheduling.
+
+    Parameters
+    ----------
+        inputFiles (list[str])
+            Paths to the C/C++ source files to be analyzed.
+
+        jobs (int)
+            The maximum number of worker processes. 1 parses in the current process.
+
+        clangPath (str | None)
+            Path to the libclang library, given to the worker processes.
+
+    Returns
+    -------
+        Structure: The merged structures of all the input files.
+    """
+
+    workerCount = min(jobs, len(inputFiles))
+
+    if workerCount <= 1:
+        structures = [_ParseFile(inputFile) for inputFile in inputFiles]
+    else:
+        with ProcessPoolExecutor(
+            max_workers=workerCount,
+            initializer=_InitializeWorker,
+            initargs=(clangPath,),
+        ) as executor:
+            # `map` yields in the order of the inputs, whatever the completion order is
+            structures = list(executor.map(_ParseFile, inputFiles))
+
+    return MergeStructures(structures)
@@ -0,0 +1,160 @@
+import pytest  # type: ignore
+from .utils import GenerateFuncType, AssertGenerateResult
+
+
+def test_simple_object(generateFunc: GenerateFuncType) -> None:
+    result = generateFunc(
+        """
+struct RPP_JSON Version
+{
+    char major RPP_JSON_KEY("major");
+    char minor RPP_JSON_KEY("minor");
+    int nonMapped;
+};
+""",
+        "binary_writer_binding.j2",
+        [],
+    )
+
+    expected = """
+template<>
+void WriteBinary<Version>(BinaryWriter &writer, const Version &value)
+{
+    u32 structMarker = writer.BeginStruct();
+
+    writer.Field(BinaryKey("major"), value.major);
+    writer.Field(BinaryKey("minor"), value.minor);
+    writer.EndStruct(structMarker);
+}
+
+template<>
+b8 ReadBinary<Version>(BinaryReader &reader, Version &value)
+{
+    u32 structEnd = 0;
+    if (!reader.BeginStruct(structEnd))
+    {
+        return FALSE;
+    }
+
+    u32 key = 0;
+    u32 fieldEnd = 0;
+    while (reader.NextField(structEnd, key, fieldEnd))
+    {
+        switch (key)
+        {
+        case BinaryKey("major"):
+            reader.Read(value.major);
+            break;
+        case BinaryKey("minor"):
+            reader.Read(value.minor);
+            break;
+        default:
+            break;
+        }
+        reader.Seek(fieldEnd);
+    }
+
+    return !reader.HasError();
+}
+"""
+
+    AssertGenerateResult(result, expected)
+
+
+def test_nested_array_object(generateFunc: GenerateFuncType) -> None:
+    result = generateFunc(
+        """
+struct RPP_JSON Test
+{
+    int count RPP_JSON_KEY("count");
+};
+
+struct RPP_JSON Container
+{
+    Test test RPP_JSON_KEY("test");
+    Array<int> values RPP_JSON_KEY("values");
+};
+""",
+        "binary_writer_binding.j2",
+        [],
+    )
+
+    expected = """
+template<>
+void WriteBinary<Test>(BinaryWriter &writer, const Test &value)
+{
+    u32 structMarker = writer.BeginStruct();
+
+    writer.Field(BinaryKey("count"), value.count);
+    writer.EndStruct(structMarker);
+}
+
+template<>
+b8 ReadBinary<Test>(BinaryReader &reader, Test &value)
+{
+    u32 structEnd = 0;
+    if (!reader.BeginStruct(structEnd))
+    {
+        return FALSE;
+    }
+
+    u32 key = 0;
+    u32 fieldEnd = 0;
+    while (reader.NextField(structEnd, key, fieldEnd))
+    {
+        switch (key)
+        {
+        case BinaryKey("count"):
+            reader.Read(value.count);
+            break;
+        default:
+            break;
+        }
+        reader.Seek(fieldEnd);
+    }
+
+    return !reader.HasError();
+}
+
+template<>
+void WriteBinary<Container>(BinaryWriter &writer, const Container &value)
+{
+    u32 structMarker = writer.BeginStruct();
+
+    writer.Field(BinaryKey("test"), value.test);
+    writer.Field(BinaryKey("values"), value.values);
+    writer.EndStruct(structMarker);
+}
+
+template<>
+b8 ReadBinary<Container>(BinaryReader &reader, Container &value)
+{
+    u32 structEnd = 0;
+    if (!reader.BeginStruct(structEnd))
+    {
+        return FALSE;
+    }
+
+    u32 key = 0;
+    u32 fieldEnd = 0;
+    while (reader.NextField(structEnd, key, fieldEnd))
+    {
+        switch (key)
+        {
+        case BinaryKey("test"):
+            reader.Read(value.test);
+            break;
+        case BinaryKey("values"):
+            reader.Read(value.values);
+            break;
+        default:
+            break;
+        }
+        reader.Seek(fieldEnd);
+    }
+
+    return !reader.HasError();
+}
+"""
+
+    AssertGenerateResult(result, expected)
@@ -18,27 +18,102 @@ struct RPP_JSON Version
     )
 
     expected = """
+static const JsonSchemaField s_VersionSchemaFields[] = {
+    {"major", JsonValueType::NUMBER},
+    {"minor", JsonValueType::NUMBER},
+    {"patch", JsonValueType::NUMBER},
+    {nullptr, JsonValueType::COUNT},
+};
+
 template<>
-const String ToString<Version>(const Version &value)
+const JsonSchema &GetJsonSchema<Version>()
 {
-    Json result;
+    static const JsonSchema schema = {
+        "Version",
+        0,
+        s_VersionSchemaFields,
+        sizeof(s_VersionSchemaFields) / sizeof(JsonSchemaField) - 1,
+        nullptr,
+    };
+    return schema;
+}
 
-    result.Set(String("major"), value.major);
-    result.Set(String("minor"), value.minor);
-    result.Set(String("patch"), value.patch);
-    return result.ToString();
+template<>
+void WriteJson<Version>(JsonWriter &writer, const Version &value)
+{
+    writer.BeginObject();
+
+    writer.Key("major");
+    writer.Value(value.major);
+    writer.Key("minor");
+    writer.Value(value.minor);
+    writer.Key("patch");
+    writer.Value(value.patch);
+    writer.EndObject();
 }
 
 template<>
-Version FromString<Version>(const String& str)
+b8 ReadJson<Version>(JsonReader &reader, Version &value)
 {
-    Json json(str);
-    Version value = {};
+    if (reader.Next() != JsonToken::BEGIN_OBJECT)
+    {
+        reader.Skip();
+        return FALSE;
+    }
 
-    value.major = json.Get<char>(String("major"), value.major);
-    value.minor = json.Get<char>(String("minor"), value.minor);
-    value.patch = json.Get<char>(String("patch"), value.patch);
+    while (reader.Next() == JsonToken::KEY)
+    {
+        StringView key = reader.GetString();
 
+        switch (reader.GetKeyHash())
+        {
+        case JsonKeyHash("major"):
+            if (key == "major")
+            {
+                reader.Read(value.major);
+                continue;
+            }
+            break;
+        case JsonKeyHash("minor"):
+            if (key == "minor")
+            {
+                reader.Read(value.minor);
+                continue;
+            }
+            break;
+        case JsonKeyHash("patch"):
+            if (key == "patch")
+            {
+                reader.Read(value.patch);
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        reader.Skip();
+    }
+
+    return reader.GetToken() == JsonToken::END_OBJECT;
+}
+
+template<>
+const String ToString<Version>(const Version &value)
+{
+    JsonWriter writer(JsonFormat::PRETTY);
+    WriteJson(writer, value);
+    return writer.Build();
+}
+
+template<>
+Version FromString<Version>(const String &str)
+{
+    Version value = {};
+    String error;
+    if (!ReadVersionedJson(str, value, error))
+    {
+        RPP_LOG_ERROR("{}", error);
+    }
     return value;
 }
 """
@@ -65,43 +140,171 @@ struct RPP_JSON Container
     )
 
     expected = """
+static const JsonSchemaField s_TestSchemaFields[] = {
+    {"count", JsonValueType::NUMBER},
+    {nullptr, JsonValueType::COUNT},
+};
+
 template<>
-const String ToString<Test>(const Test &value)
+const JsonSchema &GetJsonSchema<Test>()
+{
+    static const JsonSchema schema = {
+        "Test",
+        0,
+        s_TestSchemaFields,
+        sizeof(s_TestSchemaFields) / sizeof(JsonSchemaField) - 1,
+        nullptr,
+    };
+    return schema;
+}
+
+template<>
+void WriteJson<Test>(JsonWriter &writer, const Test &value)
 {
-    Json result;
+    writer.BeginObject();
 
-    result.Set(String("count"), value.count);
-    return result.ToString();
+    writer.Key("count");
+    writer.Value(value.count);
+    writer.EndObject();
 }
 
 template<>
-Test FromString<Test>(const String& str)
+b8 ReadJson<Test>(JsonReader &reader, Test &value)
 {
-    Json json(str);
-    Test value = {};
+    if (reader.Next() != JsonToken::BEGIN_OBJECT)
+    {
+        reader.Skip();
+        return FALSE;
+    }
+
+    while (reader.Next() == JsonToken::KEY)
+    {
+        StringView key = reader.GetString();
+
+        switch (reader.GetKeyHash())
+        {
+        case JsonKeyHash("count"):
+            if (key == "count")
+            {
+                reader.Read(value.count);
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        reader.Skip();
+    }
 
-    value.count = json.Get<int>(String("count"), value.count);
+    return reader.GetToken() == JsonToken::END_OBJECT;
+}
+
+template<>
+const String ToString<Test>(const Test &value)
+{
+    JsonWriter writer(JsonFormat::PRETTY);
+    WriteJson(writer, value);
+    return writer.Build();
+}
+
+template<>
+Test FromString<Test>(const String &str)
+{
+    Test value = {};
+    String error;
+    if (!ReadVersionedJson(str, value, error))
+    {
+        RPP_LOG_ERROR("{}", error);
+    }
     return value;
 }
 
+static const JsonSchemaField s_ContainerSchemaFields[] = {
+    {"id", JsonValueType::NUMBER},
+    {"test", JsonValueType::OBJECT},
+    {nullptr, JsonValueType::COUNT},
+};
+
 template<>
-const String ToString<Container>(const Container &value)
+const JsonSchema &GetJsonSchema<Container>()
+{
+    static const JsonSchema schema = {
+        "Container",
+        0,
+        s_ContainerSchemaFields,
+        sizeof(s_ContainerSchemaFields) / sizeof(JsonSchemaField) - 1,
+        nullptr,
+    };
+    return schema;
+}
+
+template<>
+void WriteJson<Container>(JsonWriter &writer, const Container &value)
 {
-    Json result;
+    writer.BeginObject();
 
-    result.Set(String("id"), value.id);
-    result.Set(String("test"), Json(ToString(value.test)));
-    return result.ToString();
+    writer.Key("id");
+    writer.Value(value.id);
+    writer.Key("test");
+    WriteJson(writer, value.test);
+    writer.EndObject();
 }
 
 template<>
-Container FromString<Container>(const String& str)
+b8 ReadJson<Container>(JsonReader &reader, Container &value)
 {
-    Json json(str);
-    Container value = {};
+    if (reader.Next() != JsonToken::BEGIN_OBJECT)
+    {
+        reader.Skip();
+        return FALSE;
+    }
+
+    while (reader.Next() == JsonToken::KEY)
+    {
+        StringView key = reader.GetString();
+
+        switch (reader.GetKeyHash())
+        {
+        case JsonKeyHash("id"):
+            if (key == "id")
+            {
+                reader.Read(value.id);
+                continue;
+            }
+            break;
+        case JsonKeyHash("test"):
+            if (key == "test")
+            {
+                ReadJson(reader, value.test);
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        reader.Skip();
+    }
 
-    value.id = json.Get<int>(String("id"), value.id);
-    FromString(json.Get<String>(String("test"), String("{}")), value.test);
+    return reader.GetToken() == JsonToken::END_OBJECT;
+}
+
+template<>
+const String ToString<Container>(const Container &value)
+{
+    JsonWriter writer(JsonFormat::PRETTY);
+    WriteJson(writer, value);
+    return writer.Build();
+}
+
+template<>
+Container FromString<Container>(const String &str)
+{
+    Container value = {};
+    String error;
+    if (!ReadVersionedJson(str, value, error))
+    {
+        RPP_LOG_ERROR("{}", error);
+    }
     return value;
 }
 """
@@ -123,44 +326,205 @@ struct RPP_JSON Item
     )
 
     expected = """
+static const JsonSchemaField s_ItemSchemaFields[] = {
+    {"id", JsonValueType::NUMBER},
+    {"values", JsonValueType::ARRAY},
+    {nullptr, JsonValueType::COUNT},
+};
+
 template<>
-const String ToString<Item>(const Item &value)
+const JsonSchema &GetJsonSchema<Item>()
 {
-    Json result;
+    static const JsonSchema schema = {
+        "Item",
+        0,
+        s_ItemSchemaFields,
+        sizeof(s_ItemSchemaFields) / sizeof(JsonSchemaField) - 1,
+        nullptr,
+    };
+    return schema;
+}
 
-    result.Set(String("id"), value.id);
+template<>
+void WriteJson<Item>(JsonWriter &writer, const Item &value)
+{
+    writer.BeginObject();
 
+    writer.Key("id");
+    writer.Value(value.id);
+    writer.Key("values");
+    writer.ValueArray(value.values);
+    writer.EndObject();
+}
+
+template<>
+b8 ReadJson<Item>(JsonReader &reader, Item &value)
+{
+    if (reader.Next() != JsonToken::BEGIN_OBJECT)
     {
-        u32 fieldsCount = value.values.Size();
-        Json fieldJson = Json("[]");
-        for (u32 i = 0; i < fieldsCount; i++)
+        reader.Skip();
+        return FALSE;
+    }
+
+    while (reader.Next() == JsonToken::KEY)
+    {
+        StringView key = reader.GetString();
+
+        switch (reader.GetKeyHash())
         {
-            fieldJson.Append<int>(value.values[i]);
-        }   
-        result.Set(String("values"), fieldJson);
+        case JsonKeyHash("id"):
+            if (key == "id")
+            {
+                reader.Read(value.id);
+                continue;
+            }
+            break;
+        case JsonKeyHash("values"):
+            if (key == "values")
+            {
+                reader.ReadArray(value.values);
+                continue;
+            }
+            break;
+        default:
+            break;
+        }
+        reader.Skip();
     }
 
-    return result.ToString();
+    return reader.GetToken() == JsonToken::END_OBJECT;
+}
+
+template<>
+const String ToString<Item>(const Item &value)
+{
+    JsonWriter writer(JsonFormat::PRETTY);
+    WriteJson(writer, value);
+    return writer.Build();
 }
 
 template<>
-Item FromString<Item>(const String& str)
+Item FromString<Item>(const String &str)
 {
-    Json json(str);
     Item value = {};
+    String error;
+    if (!ReadVersionedJson(str, value, error))
+    {
+        RPP_LOG_ERROR("{}", error);
+    }
+    return value;
+}
+"""
+
+    AssertGenerateResult(result, expected)
 
-    value.id = json.Get<int>(String("id"), value.id);
 
+def test_versioned_object(generateFunc: GenerateFuncType) -> None:
+    result = generateFunc(
+        """
+class Json;
+
+struct RPP_JSON RPP_JSON_VERSION(2) Settings
+{
+    String name RPP_JSON_KEY("name");
+    bool enabled RPP_JSON_KEY("enabled");
+
+    static bool Migrate(unsigned int fromVersion, Json &document);
+};
+""",
+        "json_writer_binding.j2",
+        ["string"],
+    )
+
+    expected = """
+static const JsonSchemaField s_SettingsSchemaFields[] = {
+    {"name", JsonValueType::STRING},
+    {"enabled", JsonValueType::BOOLEAN},
+    {nullptr, JsonValueType::COUNT},
+};
+
+template<>
+const JsonSchema &GetJsonSchema<Settings>()
+{
+    static const JsonSchema schema = {
+        "Settings",
+        2,
+        s_SettingsSchemaFields,
+        sizeof(s_SettingsSchemaFields) / sizeof(JsonSchemaField) - 1,
+        &Settings::Migrate,
+    };
+    return schema;
+}
+
+template<>
+void WriteJson<Settings>(JsonWriter &writer, const Settings &value)
+{
+    writer.BeginObject();
+    writer.Key(RPP_JSON_VERSION_KEY);
+    writer.Value(u32(2));
+
+    writer.Key("name");
+    writer.Value(value.name);
+    writer.Key("enabled");
+    writer.Value(value.enabled);
+    writer.EndObject();
+}
+
+template<>
+b8 ReadJson<Settings>(JsonReader &reader, Settings &value)
+{
+    if (reader.Next() != JsonToken::BEGIN_OBJECT)
     {
-        Json arrayField = json.Get<Json>(String("values"));
-        RPP_ASSERT_MSG(arrayField.IsArray(), "The field 'values' is not an array.");
-        u32 arraySize = arrayField.Size();
-        for (u32 i = 0; i < arraySize; i++)
+        reader.Skip();
+        return FALSE;
+    }
+
+    while (reader.Next() == JsonToken::KEY)
+    {
+        StringView key = reader.GetString();
+
+        switch (reader.GetKeyHash())
         {
-            value.values.Push(arrayField.Get<int>(i));
+        case JsonKeyHash("name"):
+            if (key == "name")
+            {
+                reader.Read(value.name);
+                continue;
+            }
+            break;
+        case JsonKeyHash("enabled"):
+            if (key == "enabled")
+            {
+                reader.Read(value.enabled);
+                continue;
+            }
+            break;
+        default:
+            break;
         }
+        reader.Skip();
     }
 
+    return reader.GetToken() == JsonToken::END_OBJECT;
+}
+
+template<>
+const String ToString<Settings>(const Settings &value)
+{
+    JsonWriter writer(JsonFormat::PRETTY);
+    WriteJson(writer, value);
+    return writer.Build();
+}
+
+template<>
+Settings FromString<Settings>(const String &str)
+{
+    Settings value = {};
+    String error;
+    if (!ReadVersionedJson(str, value, error))
+    {
+        RPP_LOG_ERROR("{}", error);
+    }
     return value;
 }
 """
@@ -0,0 +1,29 @@
+import os
+import pytest  # type: ignore
+from output import WriteIfChanged
+
+
+def test_write_new_file(tmp_path: str) -> None:
+    outputFile = os.path.join(tmp_path, "binding.cpp")
+
+    assert WriteIfChanged(outputFile, "int a;\n")
+
+    with open(outputFile, "r", encoding="utf-8") as f:
+        assert f.read() == "int a;\n"
+
+
+def test_skip_unchanged_file(tmp_path: str) -> None:
+    outputFile = os.path.join(tmp_path, "binding.cpp")
+    WriteIfChanged(outputFile, "int a;\n")
+
+    # an old modification time, which must be kept when nothing changed
+    os.utime(outputFile, (1000000, 1000000))
+
+    assert not WriteIfChanged(outputFile, "int a;\n")
+    assert os.path.getmtime(outputFile) == 1000000
+
+    assert WriteIfChanged(outputFile, "int b;\n")
+    assert os.path.getmtime(outputFile) != 1000000
+
+    with open(outputFile, "r", encoding="utf-8") as f:
+        assert f.read() == "int b;\n"
@@ -1,5 +1,5 @@
 import pytest  # type: ignore
-from parser import Parse, Structure
+from parser import MergeStructures, Parse, Structure
 from .utils import ParserContentWrapper
 from .assertion import (
     EnumConstantsAssert,
@@ -348,3 +348,44 @@ public:
         ],
         annotations=["python"],
     ).Assert(result["classes"][0])
+
+
+def test_merge_structures_is_deterministic():
+    # both translation units include the same header (Color, Move), each one also declares its own objects
+    common = """
+enum RPP_PYTHON_BINDING Color { RED };
+void RPP_PYTHON_BINDING Move(int distance);
+"""
+    first = WrapperParse(
+        common
+        + """
+struct RPP_PYTHON_BINDING Point { int x; };
+void RPP_PYTHON_BINDING Move(float distance);
+"""
+    )
+    second = WrapperParse(
+        common
+        + """
+class RPP_PYTHON_BINDING Robot { public: void Stop(); };
+"""
+    )
+
+    merged = MergeStructures([first, second])
+
+    assert [enum.name for enum in merged["enums"]] == ["Color"]
+    assert [struct.name for struct in merged["structs"]] == ["Point"]
+    assert [cls.name for cls in merged["classes"]] == ["Robot"]
+
+    # the overloads are kept, the duplicate is dropped
+    assert [
+        [param.type for param in function.parameters]
+        for function in merged["functions"]
+    ] == [["int"], ["float"]]
+
+    # the order only depends on the order of the inputs
+    reversedMerge = MergeStructures([second, first])
+    assert [
+        [param.type for param in function.parameters]
+        for function in reversedMerge["functions"]
+    ] == [["int"], ["float"]]
+    assert [struct.name for struct in reversedMerge["structs"]] == ["Point"]
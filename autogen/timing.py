@@ -0,0 +1,48 @@
+import time
+from contextlib import contextmanager
+from typing import Generator
+
+
+class PhaseTimer:
+    """
+    Accumulates the wall-clock time spent in each phase of the generation (parse, model, render).
+    """
+
+    def __init__(self) -> None:
+        self.durations: dict[str, float] = {}
+
+    @contextmanager
+    def Measure(self, phase: str) -> Generator[None, None, None]:
+        """
+        Measures the enclosed block, a phase measured several times is summed up.
+
+        Parameters
+        ----------
+            phase (str)
+                The name of the phase.
+        """
+        start = time.perf_counter()
+        try:
+            yield
+        finally:
+            self.durations[phase] = (
+                self.durations.get(phase, 0.0) + time.perf_counter() - start
+            )
+
+    def Report(self) -> str:
+        """
+        Formats the durations, in the order the phases were first measured.
+
+        Returns
+        -------
+            str: One line per phase and the total, e.g. `parse   1.204s`.
+        """
+        width = max([len(phase) for phase in self.durations] + [len("total")])
+
+        lines = [
+            f"{phase.ljust(width)} {duration:7.3f}s"
+            for phase, duration in self.durations.items()
+        ]
+        lines.append(f"{'total'.ljust(width)} {sum(self.durations.values()):7.3f}s")
+
+        return "\n".join(lines)
@@ -1,3 +1,4 @@
+import hashlib
 import os
 from .path_utils import GetAbsoluteTemporaryDir, CreateRecursiveDirIfNotExists
 from ..constants import Constants
@@ -25,9 +26,25 @@ def _GetCacheFilePath(filePath: str) -> str:
     return os.path.join(finalTmpDir, f"{fileName}.stamp")
 
 
+def _ComputeFileHash(filePath: str) -> str:
+    """
+    Helper function to compute the content hash stored in the cache file.
+
+    Parameters
+    ----------
+    filePath : str
+        The path to the file to hash (relative to the `ABSOLUTE_BASE_DIR`).
+    """
+    hasher = hashlib.sha256()
+    with open(filePath, "rb") as f:
+        for chunk in iter(lambda: f.read(1024 * 1024), b""):
+            hasher.update(chunk)
+    return hasher.hexdigest()
+
+
 def IsFileModified(filePath: str) -> bool:
     """
-    Used for checking whether a file has been changed since the last time it was cached.
+    Used for checking whether the content of a file has been changed since the last time it was cached.
 
     Parameters
     ----------
@@ -39,16 +56,30 @@ def IsFileModified(filePath: str) -> bool:
     bool
         True if the file has been modified since the last cache, False otherwise.
         If the file has never been cached, it is considered modified and will return True.
+
+    Notes
+    -----
+    A file which is only touched (checkout, branch switch, save without change) is not considered modified: when
+    the modification time is newer than the cache, the content hash decides, and the cache is refreshed so the hash
+    is not computed again on the next call.
     """
     if not os.path.exists(filePath):
         return False
 
-    if not os.path.exists(_GetCacheFilePath(filePath)):
+    cacheFilePath = _GetCacheFilePath(filePath)
+    if not os.path.exists(cacheFilePath):
         return True
 
-    if os.path.getmtime(filePath) > os.path.getmtime(_GetCacheFilePath(filePath)):
+    if os.path.getmtime(filePath) <= os.path.getmtime(cacheFilePath):
+        return False
+
+    with open(cacheFilePath, "r") as f:
+        cachedHash = f.read().strip()
+
+    if cachedHash != _ComputeFileHash(filePath):
         return True
 
+    UpdateFileCache(filePath)
     return False
 
 
@@ -61,8 +92,9 @@ def UpdateFileCache(filePath: str) -> None:
     filePath : str
         The path to the file to update the cache for (relative to the `ABSOLUTE_BASE_DIR`).
         If the file has never been cached, it will be added to the cache. If it has been cached before,
-        its cache entry will be updated to reflect the current state of the file. This function does not return any value.
+        its cache entry will be updated to reflect the current state of the file (its content hash). This function
+        does not return any value.
     """
 
     with open(_GetCacheFilePath(filePath), "w") as f:
-        f.write("")
+        f.write(_ComputeFileHash(filePath))
@@ -329,68 +329,29 @@ def RunPythonProject(
 
         CreateRecursiveDirIfNotExists(librariesTempDir)
 
-        writerOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "writer_binding.j2"),
-            "--output",
-            writerOutput,
+        # (template, output) pairs, all rendered by one autogen process which parses the headers once
+        templateOutputs = [
+            ("e2e_test_cpp_binding.j2", e2eOutput),
+            ("e2e_json_writer_binding.j2", e2eJsonWriterBindingOutput),
+            ("writer_binding.j2", writerOutput),
+            ("e2e_python_binding.j2", pyiE2EGRuntimeOutput),
+            ("e2e_python_init_binding.j2", e2ePythonInitOutput),
+            ("e2e_module_register.j2", e2eAppendOutput),
+            ("e2e_json_writer_register.j2", e2eJsonWriterAppendOutput),
+            ("e2e_module_import.j2", e2ePythonModuleImportOutput),
+            ("e2e_module_enum_create.j2", e2ePythonModuleCreateEnumOutput),
         ]
 
-        e2eOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_test_cpp_binding.j2"),
-            "--output",
-            e2eOutput,
-        ]
-
-        e2eJsonWriterBindingOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_json_writer_binding.j2"),
-            "--output",
-            e2eJsonWriterBindingOutput,
-        ]
-
-        e2eAppendOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_module_register.j2"),
-            "--output",
-            e2eAppendOutput,
-        ]
-
-        e2eJsonWriterAppendOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_json_writer_register.j2"),
-            "--output",
-            e2eJsonWriterAppendOutput,
-        ]
-
-        e2ePythonModuleImportOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_module_import.j2"),
-            "--output",
-            e2ePythonModuleImportOutput,
-        ]
-
-        e2ePythonModuleEnumCreatedOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_module_enum_create.j2"),
-            "--output",
-            e2ePythonModuleCreateEnumOutput,
-        ]
-
-        pyiE2EGRuntimeOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_python_binding.j2"),
-            "--output",
-            pyiE2EGRuntimeOutput,
-        ]
-
-        e2eInitOutputArgs = argCommon + [
-            "--template",
-            os.path.join(cwd, "templates", "e2e_python_init_binding.j2"),
-            "--output",
-            e2ePythonInitOutput,
-        ]
+        autogenArgs = (
+            argCommon
+            + ["--template"]
+            + [
+                os.path.join(cwd, "templates", template)
+                for template, _ in templateOutputs
+            ]
+            + ["--output"]
+            + [output for _, output in templateOutputs]
+        )
 
         logger.info("Header files have changed. Running autogen...")
 
@@ -398,42 +359,8 @@ def RunPythonProject(
 
             logger.info(f"Running Python project in '{project}'...")
 
-            e2eCommand = " ".join([pythonExe, mainScript] + e2eOutputArgs)
-            RunCommand(e2eCommand, cwd=cwd)
-
-            e2eJsonWriterCommand = " ".join(
-                [pythonExe, mainScript] + e2eJsonWriterBindingOutputArgs
-            )
-            RunCommand(e2eJsonWriterCommand, cwd=cwd)
-
-            writerOutputCommand = " ".join([pythonExe, mainScript] + writerOutputArgs)
-            RunCommand(writerOutputCommand, cwd=cwd)
-
-            pyiE2EGRuntimeCommand = f"{pythonExe} {mainScript} " + " ".join(
-                pyiE2EGRuntimeOutputArgs
-            )
-            RunCommand(pyiE2EGRuntimeCommand, cwd=cwd)
-
-            e2eInitCommand = f"{pythonExe} {mainScript} " + " ".join(e2eInitOutputArgs)
-            RunCommand(e2eInitCommand, cwd=cwd)
-
-            e2eAppendCommand = " ".join([pythonExe, mainScript] + e2eAppendOutputArgs)
-            RunCommand(e2eAppendCommand, cwd=cwd)
-
-            e2eJsonWriterAppendCommand = " ".join(
-                [pythonExe, mainScript] + e2eJsonWriterAppendOutputArgs
-            )
-            RunCommand(e2eJsonWriterAppendCommand, cwd=cwd)
-
-            e2ePythonModuleImportCommand = " ".join(
-                [pythonExe, mainScript] + e2ePythonModuleImportOutputArgs
-            )
-            RunCommand(e2ePythonModuleImportCommand, cwd=cwd)
-
-            e2ePythonModuleEnumCreatedCommand = " ".join(
-                [pythonExe, mainScript] + e2ePythonModuleEnumCreatedOutputArgs
-            )
-            RunCommand(e2ePythonModuleEnumCreatedCommand, cwd=cwd)
+            autogenCommand = " ".join([pythonExe, mainScript] + autogenArgs)
+            RunCommand(autogenCommand, cwd=cwd)
 
             logger.info(f"Python project '{project}' finished successfully.")
 
@@ -33,6 +33,8 @@ int main(int argc, const char **argv)
     Renderer::Initialize();
     Thread::Initialize();
     Signal::Initialize();
+    Async::Initialize();
+    IOQueue::Initialize();
 
 #if defined(RPP_USE_TEST)
     String runtimeFilePath = Format("{}/e2e/{}.py", String(STRINGIFY(RPP_PROJECT_DIR)), args.Get<String>("test", "basic"));
@@ -40,7 +42,7 @@ int main(int argc, const char **argv)
     String runTestCaseName = args.Get<String>("testcase", "run_all_tests");
 
     TestSystem::GetInstance()->Initialize(
-        String(STRINGIFY(RPP_PROJECT_DIR) "/e2e/results.json"),
+        String(STRINGIFY(RPP_PROJECT_DIR) "/e2e/results.jsonl"),
         runtimeFilePath,
         runTestCaseName);
 
@@ -99,6 +101,8 @@ int main(int argc, const char **argv)
     TestSystem::GetInstance()->Shutdown();
 #endif
 
+    IOQueue::Shutdown();
+    Async::Shutdown();
     Signal::Shutdown();
     Thread::Shutdown();
     GraphicSessionManager::GetInstance()->ClearSessions();
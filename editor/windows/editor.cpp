@@ -44,7 +44,9 @@ void EditorWindow::InitializeImpl()
 
     if (m_pEditorData->GetRecentProjects().Size() > 0)
     {
-        OpenProject(m_pEditorData->GetRecentProjects()[0]);
+        // loaded right away, the first frame shows the project
+        String projectFilePath = m_pEditorData->GetRecentProjects()[0];
+        SetCurrentProject(projectFilePath, Project::Create(projectFilePath));
     }
 
     Renderer::GetWindow()->SetOnCloseCallback(
@@ -81,10 +83,23 @@ void EditorWindow::InitializeImpl()
 
             if (commandTag & FUNCTION_COMMAND_TAG)
             {
+                m_pCurrentProject->MarkDirty(ProjectSection::FUNCTIONS);
                 ResetFunctionSelectionStates();
             }
         });
 
+    HistoryManager::GetInstance()->SetOnCommandUndoCallback(
+        [this](Command *pCommand)
+        {
+            RPP_PROFILE_SCOPE();
+            RPP_ASSERT(m_pCurrentProject != nullptr);
+
+            if (pCommand->Tag() & FUNCTION_COMMAND_TAG)
+            {
+                m_pCurrentProject->MarkDirty(ProjectSection::FUNCTIONS);
+            }
+        });
+
     HistoryManager::GetInstance()->SetOnHistoryEmptyCallback(
         [this]()
         {
@@ -350,7 +365,7 @@ void EditorWindow::CreateProject(const String &projectFolder, const ProjectDescr
     String projectFilePath = Format("{}/project.rppproj", finalProjectPath);
 
     FileSystem::CreateDirectory(finalProjectPath);
-    m_pCurrentProject->Save(projectFilePath);
+    m_pCurrentProject->SaveChanges(projectFilePath);
     m_pEditorData->AddRecentProject(projectFilePath);
     m_pEditorData->Save(EDITOR_DATA_FILE);
 
@@ -363,11 +378,37 @@ void EditorWindow::OpenProject(const String &projectFilePath)
     RPP_PROFILE_SCOPE();
     RPP_ASSERT(FileSystem::PathExists(projectFilePath));
 
-    FileHandle file = FileSystem::OpenFile(projectFilePath, FILE_MODE_READ);
-    String fileContent = FileSystem::Read(file);
-    FileSystem::CloseFile(file);
+    if (m_isOpeningProject)
+    {
+        RPP_LOG_WARNING("Ignored opening {}, another project is being loaded.", projectFilePath);
+        return;
+    }
+    m_isOpeningProject = TRUE;
 
-    ProjectDescription desc = FromString<ProjectDescription>(fileContent);
+    u32 rendererId = GetRendererId();
+    Project::CreateAsync(
+        projectFilePath,
+        [this, projectFilePath, rendererId](Project *pProject)
+        {
+            RPP_PROFILE_SCOPE();
+            m_isOpeningProject = FALSE;
+
+            if (pProject == nullptr)
+            {
+                RPP_LOG_ERROR("Failed to open project: {}", projectFilePath);
+                return;
+            }
+
+            // called from GraphicSessionManager::Update, any renderer may be active
+            Renderer::Activate(rendererId);
+            SetCurrentProject(projectFilePath, pProject);
+        });
+}
+
+void EditorWindow::SetCurrentProject(const String &projectFilePath, Project *pProject)
+{
+    RPP_PROFILE_SCOPE();
+    RPP_ASSERT(pProject != nullptr);
 
     if (m_pCurrentProject != nullptr)
     {
@@ -375,13 +416,14 @@ void EditorWindow::OpenProject(const String &projectFilePath)
         m_pCurrentProject = nullptr;
     }
 
-    m_pCurrentProject = RPP_NEW(Project, desc);
+    m_pCurrentProject = pProject;
+    m_pCurrentProject->MarkClean(projectFilePath);
     RPP_LOG_DEBUG("Opened project: {}", projectFilePath);
     m_pEditorData->AddRecentProject(projectFilePath);
     m_pEditorData->Save(EDITOR_DATA_FILE);
     m_openProjectFile = projectFilePath;
 
-    Renderer::SetWindowTitle(Format("Editor - {}", desc.name));
+    Renderer::SetWindowTitle(Format("Editor - {}", m_pCurrentProject->GetName()));
     ResetFunctionSelectionStates();
 }
 
@@ -390,7 +432,7 @@ void EditorWindow::SaveProject()
     RPP_PROFILE_SCOPE();
     RPP_ASSERT(m_pCurrentProject != nullptr);
 
-    m_pCurrentProject->Save(m_openProjectFile);
+    m_pCurrentProject->SaveChanges(m_openProjectFile);
 }
 
 void EditorWindow::EditorMainRender()
@@ -565,7 +607,7 @@ void EditorWindow::UnsavedChangesModalRender()
         if (ImGui::Button("Save"))
         {
             RPP_ASSERT(m_pCurrentProject != nullptr);
-            m_pCurrentProject->Save(m_openProjectFile);
+            m_pCurrentProject->SaveChanges(m_openProjectFile);
 #if !defined(RPP_USE_TEST)
             GraphicsCommandData cmdData;
             cmdData.type = GraphicsCommandType::CLOSE_WINDOW;
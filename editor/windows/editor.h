@@ -37,8 +37,16 @@ private:
 private:
     void CreateProject(const String &projectFolder, const ProjectDescription &desc);
 
+    /**
+     * Loads the project on the `Async` worker, it replaces the current one once loaded (the window keeps rendering).
+     */
     void OpenProject(const String &projectFilePath);
 
+    /**
+     * Takes the ownership of the loaded project and makes it the current one.
+     */
+    void SetCurrentProject(const String &projectFilePath, Project *pProject);
+
     void SaveProject();
 
 private:
@@ -65,6 +73,7 @@ private:
     Command *m_pCurrentCommand = nullptr;           ///< The current command being executed that caused unsaved changes.
 
     String m_openProjectFile; ///< The folder path of the currently opened project.
+    b8 m_isOpeningProject = FALSE; ///< Whether a project is being loaded in the background.
 
     // multiple select feature
 private:
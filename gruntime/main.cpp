@@ -66,12 +66,14 @@ int main(int argc, char **argv)
     Renderer::Initialize();
     Thread::Initialize();
     Signal::Initialize();
+    Async::Initialize();
+    IOQueue::Initialize();
 
 #if defined(RPP_USE_TEST)
     String runtimeFilePath = Format("{}/e2e/{}.py", String(STRINGIFY(RPP_PROJECT_DIR)), args.Get<String>("runtime", "empty_scenario"));
 
     TestSystem::GetInstance()->Initialize(
-        String(STRINGIFY(RPP_PROJECT_DIR) "/e2e/results.json"),
+        String(STRINGIFY(RPP_PROJECT_DIR) "/e2e/results.jsonl"),
         String(""),
         runtimeFilePath);
 #endif
@@ -120,6 +122,8 @@ int main(int argc, char **argv)
 
     GraphicSessionManager::GetInstance()->ClearSessions();
 
+    IOQueue::Shutdown();
+    Async::Shutdown();
     Signal::Shutdown();
     Thread::Shutdown();
     Renderer::Shutdown();
@@ -18,7 +18,8 @@ namespace rpp
         void AddSession(Scope<GraphicSession> session);
 
         /**
-         * @brief Update all the graphic sessions inside the manager. This will call `Update` method of each session.
+         * @brief Update all the graphic sessions inside the manager. This will call `Update` method of each session,
+         *      after running the completions of the finished `Async` jobs.
          * @param deltaTime The time elapsed since the last update call.
          *
          * @return TRUE if all the sessions are closed and the application should close, FALSE otherwise.
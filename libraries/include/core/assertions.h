@@ -24,6 +24,6 @@ namespace rpp
     }
 #else
 #define RPP_ASSERT(condition)
-#define RPP_ASSERT_MSG(condition, message)
+#define RPP_ASSERT_MSG(condition, ...)
 #endif
 } // namespace rpp
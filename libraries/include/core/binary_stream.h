@@ -0,0 +1,332 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "string.h"
+#include "filesystem.h"
+#include "json_stream.h"
+#include "containers/array.h"
+#include <cstring>
+#include <type_traits>
+
+/// The version of the binary layout written by `BinaryWriter::WriteHeader`. Files with another version are rejected.
+#define RPP_BINARY_FORMAT_VERSION 1
+
+namespace rpp
+{
+    /**
+     * @brief Computes the identifier of a field in the binary format: the `JsonKeyHash` of the field's JSON key (a
+     *      collision inside one struct fails to compile in the generated `switch`).
+     */
+    constexpr u32 BinaryKey(const char *key)
+    {
+        return JsonKeyHash(key);
+    }
+
+    namespace details
+    {
+        template <typename T>
+        struct IsArray : std::false_type
+        {
+        };
+
+        template <typename T>
+        struct IsArray<Array<T>> : std::true_type
+        {
+            using ElementType = T;
+        };
+    } // namespace details
+
+    class BinaryWriter;
+    class BinaryReader;
+
+    /**
+     * @brief Writes a value in the binary format. Autogen generates the specializations for the structs annotated with
+     *      `RPP_JSON` (fields annotated with `RPP_JSON_KEY`).
+     */
+    template <typename T>
+    void WriteBinary(BinaryWriter &writer, const T &value);
+
+    /**
+     * @brief Reads a value in the binary format. Autogen generates the specializations for the structs annotated with
+     *      `RPP_JSON`: missing fields keep the current value and unknown fields are skipped.
+     *
+     * @return FALSE if the data is truncated or corrupted.
+     */
+    template <typename T>
+    b8 ReadBinary(BinaryReader &reader, T &outValue);
+
+    /**
+     * @brief Encodes values into a compact little-endian binary buffer. Strings and arrays are prefixed with their
+     *      length, and every struct field is written as `key, size, payload` so a reader can skip the fields it does
+     *      not know (or no longer knows).
+     *
+     * @example
+     * ```cpp
+     * BinaryWriter writer;
+     * writer.WriteHeader();
+     * WriteBinary(writer, project.ToDescription());
+     * writer.WriteTo(file);
+     * ```
+     */
+    class BinaryWriter
+    {
+    public:
+        BinaryWriter();
+        ~BinaryWriter();
+
+        BinaryWriter(const BinaryWriter &) = delete;
+        BinaryWriter &operator=(const BinaryWriter &) = delete;
+
+    public:
+        /**
+         * @brief Writes the magic number and the format version, which `BinaryReader::ReadHeader` checks.
+         */
+        void WriteHeader();
+
+        /**
+         * @brief Starts a struct. Returns a marker which must be passed to `EndStruct`.
+         */
+        u32 BeginStruct();
+
+        /**
+         * @brief Completes the struct started with `BeginStruct` (writes its size).
+         */
+        void EndStruct(u32 marker);
+
+        /**
+         * @brief Writes one field of a struct.
+         */
+        template <typename T>
+        void Field(u32 key, const T &value)
+        {
+            writeUnsigned(key, sizeof(u32));
+            u32 marker = reserveSize();
+            Write(value);
+            patchSize(marker);
+        }
+
+        /**
+         * @brief Writes a value. Supports `b8`, the integer and floating point types, anything convertible to
+         *      `StringView`, `Array` of supported values and the types which have a `WriteBinary` specialization.
+         */
+        template <typename T>
+        void Write(const T &value)
+        {
+            if constexpr (std::is_same_v<T, b8>)
+            {
+                writeUnsigned(value ? 1 : 0, 1);
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                writeUnsigned(static_cast<u64>(value), sizeof(T));
+            }
+            else if constexpr (std::is_same_v<T, f32>)
+            {
+                u32 bits;
+                memcpy(&bits, &value, sizeof(bits));
+                writeUnsigned(bits, sizeof(bits));
+            }
+            else if constexpr (std::is_same_v<T, f64>)
+            {
+                u64 bits;
+                memcpy(&bits, &value, sizeof(bits));
+                writeUnsigned(bits, sizeof(bits));
+            }
+            else if constexpr (std::is_convertible_v<const T &, StringView>)
+            {
+                StringView text(value);
+                writeUnsigned(text.Length(), sizeof(u32));
+                writeBytes(text.Data(), text.Length());
+            }
+            else if constexpr (details::IsArray<T>::value)
+            {
+                u32 count = value.Size();
+                writeUnsigned(count, sizeof(u32));
+                for (u32 i = 0; i < count; i++)
+                {
+                    Write(value.Data()[i]);
+                }
+            }
+            else
+            {
+                WriteBinary(*this, value);
+            }
+        }
+
+        /**
+         * @brief Writes the encoded bytes into a file opened for writing (preferably with `FILE_MODE_BINARY`).
+         */
+        void WriteTo(FileHandle file) const;
+
+        inline const u8 *Data() const { return m_data; }
+        inline u32 Size() const { return m_size; }
+
+    private:
+        void writeUnsigned(u64 value, u32 byteCount);
+        void writeBytes(const void *data, u32 length);
+        u32 reserveSize();
+        void patchSize(u32 marker);
+        void grow(u32 additional);
+
+    private:
+        u8 *m_data;
+        u32 m_size;
+        u32 m_capacity;
+    };
+
+    /**
+     * @brief Decodes the buffers produced by `BinaryWriter`. Every read is bounds-checked: a truncated or corrupted
+     *      buffer sets the error flag instead of reading out of range.
+     *
+     * @example
+     * ```cpp
+     * BinaryReader reader(file);
+     * ProjectDescription desc = {};
+     * if (reader.ReadHeader() && ReadBinary(reader, desc)) { ... }
+     * ```
+     */
+    class BinaryReader
+    {
+    public:
+        /**
+         * @brief Reads from a buffer. The buffer must outlive the reader.
+         */
+        BinaryReader(const u8 *data, u32 size);
+
+        /**
+         * @brief Reads a file. A handle created by `FileSystem::MapFile` is read in place without any copy (it must stay
+         *      open while the reader is used), otherwise the rest of the file opened for reading (preferably with
+         *      `FILE_MODE_BINARY`) is loaded with `FileSystem::ReadBytes`.
+         */
+        explicit BinaryReader(FileHandle file);
+
+        ~BinaryReader();
+
+        BinaryReader(const BinaryReader &) = delete;
+        BinaryReader &operator=(const BinaryReader &) = delete;
+
+    public:
+        /**
+         * @brief Reads and checks the header written by `BinaryWriter::WriteHeader`.
+         */
+        b8 ReadHeader();
+
+        /**
+         * @brief Starts reading a struct.
+         *
+         * @param outEnd The position right after the struct, to pass to `NextField`.
+         */
+        b8 BeginStruct(u32 &outEnd);
+
+        /**
+         * @brief Moves to the next field of the struct.
+         *
+         * @param structEnd The value returned by `BeginStruct`.
+         * @param outKey The identifier of the field (see `BinaryKey`).
+         * @param outFieldEnd The position right after the field, pass it to `Seek` once the field is handled.
+         *
+         * @return FALSE when there is no field left (or on error).
+         */
+        b8 NextField(u32 structEnd, u32 &outKey, u32 &outFieldEnd);
+
+        /**
+         * @brief Moves the read position (used to skip unknown fields).
+         */
+        void Seek(u32 position);
+
+        inline u32 GetPosition() const { return m_position; }
+        inline b8 HasError() const { return m_error; }
+
+        /**
+         * @brief Reads a value written by `BinaryWriter::Write` with the same type. A string can also be read as a
+         *      `StringView`, which points into the buffer instead of being copied.
+         *
+         * @return FALSE on error, `outValue` may be partially modified then.
+         */
+        template <typename T>
+        b8 Read(T &outValue)
+        {
+            if constexpr (std::is_same_v<T, b8>)
+            {
+                outValue = readUnsigned(1) != 0;
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                outValue = static_cast<T>(static_cast<std::make_unsigned_t<T>>(readUnsigned(sizeof(T))));
+            }
+            else if constexpr (std::is_same_v<T, f32>)
+            {
+                u32 bits = static_cast<u32>(readUnsigned(sizeof(bits)));
+                memcpy(&outValue, &bits, sizeof(bits));
+            }
+            else if constexpr (std::is_same_v<T, f64>)
+            {
+                u64 bits = readUnsigned(sizeof(bits));
+                memcpy(&outValue, &bits, sizeof(bits));
+            }
+            else if constexpr (std::is_same_v<T, StringView>)
+            {
+                // zero-copy: the view points into the buffer of the reader
+                u32 length = static_cast<u32>(readUnsigned(sizeof(u32)));
+                const u8 *text = readBytes(length);
+                if (text != nullptr)
+                {
+                    outValue = StringView(reinterpret_cast<const char *>(text), length);
+                }
+            }
+            else if constexpr (std::is_same_v<T, String>)
+            {
+                u32 length = static_cast<u32>(readUnsigned(sizeof(u32)));
+                const u8 *text = readBytes(length);
+                if (text != nullptr)
+                {
+                    outValue = String(reinterpret_cast<const char *>(text), length);
+                }
+            }
+            else if constexpr (details::IsArray<T>::value)
+            {
+                u32 count = static_cast<u32>(readUnsigned(sizeof(u32)));
+
+                // every element takes at least one byte, anything larger is corrupted data
+                if (count > m_size - m_position)
+                {
+                    m_error = TRUE;
+                    return FALSE;
+                }
+
+                // overwrites the array like the other reads
+                outValue.Clear();
+                if (count > outValue.Capacity())
+                {
+                    outValue.Reallocate(count);
+                }
+
+                for (u32 i = 0; i < count && !m_error; i++)
+                {
+                    typename details::IsArray<T>::ElementType element = {};
+                    Read(element);
+                    outValue.Push(std::move(element));
+                }
+            }
+            else
+            {
+                if (!ReadBinary(*this, outValue))
+                {
+                    m_error = TRUE;
+                }
+            }
+
+            return !m_error;
+        }
+
+    private:
+        u64 readUnsigned(u32 byteCount);
+        const u8 *readBytes(u32 length);
+
+    private:
+        const u8 *m_data;
+        u32 m_size;
+        u32 m_position;
+        b8 m_error;
+        Array<u8> m_ownedData; ///< The file content when the reader loaded it itself (empty for buffers and mapped files).
+    };
+} // namespace rpp
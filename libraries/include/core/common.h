@@ -35,6 +35,11 @@
  * @brief map the attribute with the given name in JSON object.
  */
 #define RPP_JSON_KEY(name)
+
+/**
+ * @brief Used for marking the version of the JSON layout of a `RPP_JSON` class (see `GetJsonSchema`).
+ */
+#define RPP_JSON_VERSION(version)
 #elif defined(__GNUC__) || defined(__clang__)
 /**
  * @brief Used for marking the object should be exposed to be binded into Python Module.
@@ -70,4 +75,9 @@
  * @brief map the attribute with the given name in JSON object.
  */
 #define RPP_JSON_KEY(name) __attribute__((annotate("key:" name)))
+
+/**
+ * @brief Used for marking the version of the JSON layout of a `RPP_JSON` class (see `GetJsonSchema`).
+ */
+#define RPP_JSON_VERSION(version) __attribute__((annotate("version:" #version)))
 #endif
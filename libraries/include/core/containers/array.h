@@ -27,13 +27,12 @@ namespace rpp
 
         /**
          * @brief Constructor with initial capacity.
-         * @param capacity Initial capacity of the array.
-         * @note The capacity must be greater than zero.
+         * @param capacity Initial capacity of the array. A zero capacity allocates on the first push.
          */
         Array(u32 capacity)
         {
             m_capacity = capacity;
-            m_data = (T *)RPP_MALLOC(m_capacity * sizeof(T));
+            m_data = m_capacity > 0 ? (T *)RPP_MALLOC(m_capacity * sizeof(T)) : nullptr;
             // RPP_NEW_ARRAY(m_data, T, m_capacity);
             m_size = 0;
         }
@@ -45,13 +44,24 @@ namespace rpp
         {
             m_capacity = other.m_capacity;
             m_size = other.m_size;
-            m_data = (T *)RPP_MALLOC(m_capacity * sizeof(T));
+            m_data = m_capacity > 0 ? (T *)RPP_MALLOC(m_capacity * sizeof(T)) : nullptr;
             for (u32 i = 0; i < m_size; i++)
             {
                 RPP_NEW_REPLACE(&m_data[i], T(other.m_data[i]));
             }
         }
 
+        /**
+         * @brief Move constructor. Takes the buffer of the other array, which is left empty with no capacity.
+         */
+        Array(Array &&other) noexcept
+            : m_data(other.m_data), m_capacity(other.m_capacity), m_size(other.m_size)
+        {
+            other.m_data = nullptr;
+            other.m_capacity = 0;
+            other.m_size = 0;
+        }
+
         ~Array()
         {
             if (m_data != nullptr)
@@ -101,13 +111,32 @@ namespace rpp
 
             m_capacity = other.m_capacity;
             m_size = other.m_size;
-            m_data = (T *)RPP_MALLOC(m_capacity * sizeof(T));
+            m_data = m_capacity > 0 ? (T *)RPP_MALLOC(m_capacity * sizeof(T)) : nullptr;
             for (u32 i = 0; i < m_size; i++)
             {
                 RPP_NEW_REPLACE(&m_data[i], T(other.m_data[i]));
             }
         }
 
+        void operator=(Array &&other) noexcept
+        {
+            if (this == &other)
+            {
+                return;
+            }
+
+            Clear();
+            RPP_FREE(m_data);
+
+            m_data = other.m_data;
+            m_capacity = other.m_capacity;
+            m_size = other.m_size;
+
+            other.m_data = nullptr;
+            other.m_capacity = 0;
+            other.m_size = 0;
+        }
+
         /**
          * @brief Const access operator for the array (for read-only access).
          * @param index Index of the element to access. If the index is out of bounds, an exception will be thrown.
@@ -151,6 +180,31 @@ namespace rpp
             m_capacity = newCapacity;
         }
 
+        /**
+         * @brief Changes the number of elements. The new elements are value-initialized (zero for the arithmetic
+         *      types) and the removed ones are destroyed. The capacity only grows, once, when it is too small.
+         * @param newSize New number of elements of the array.
+         */
+        void Resize(u32 newSize)
+        {
+            if (newSize > m_capacity)
+            {
+                Reallocate(newSize);
+            }
+
+            for (u32 i = m_size; i < newSize; i++)
+            {
+                RPP_NEW_REPLACE(&m_data[i], T());
+            }
+
+            for (u32 i = newSize; i < m_size; i++)
+            {
+                m_data[i].~T();
+            }
+
+            m_size = newSize;
+        }
+
         /**
          * @brief Add an element to the end of the array. The array will be resized if needed.
          * @param value Value to add to the array.
@@ -166,7 +220,7 @@ namespace rpp
 
             if (m_size >= m_capacity)
             {
-                Reallocate(m_capacity * 2);
+                Reallocate(m_capacity > 0 ? m_capacity * 2 : RPP_ARRAY_DEFAULT_CAPACITY);
             }
 
             u32 modifiedIndex = 0;
@@ -180,9 +234,11 @@ namespace rpp
             }
             m_size++;
 
+            // every shifted element is destroyed once moved, so the moved-from slot can be constructed again
             for (u32 i = m_size - 1; i >= u32(modifiedIndex) + 1; i--)
             {
                 RPP_NEW_REPLACE(&m_data[i], T(std::move(const_cast<T &>(m_data[i - 1]))));
+                m_data[i - 1].~T();
             }
 
             RPP_NEW_REPLACE(&m_data[modifiedIndex], T(value));
@@ -197,7 +253,7 @@ namespace rpp
 
             if (m_size >= m_capacity)
             {
-                Reallocate(m_capacity * 2);
+                Reallocate(m_capacity > 0 ? m_capacity * 2 : RPP_ARRAY_DEFAULT_CAPACITY);
             }
 
             u32 modifiedIndex = 0;
@@ -211,9 +267,11 @@ namespace rpp
             }
             m_size++;
 
+            // every shifted element is destroyed once moved, so the moved-from slot can be constructed again
             for (u32 i = m_size - 1; i >= u32(modifiedIndex) + 1; i--)
             {
                 RPP_NEW_REPLACE(&m_data[i], T(std::move(const_cast<T &>(m_data[i - 1]))));
+                m_data[i - 1].~T();
             }
 
             RPP_NEW_REPLACE(&m_data[modifiedIndex], T(std::move(value)));
@@ -247,6 +305,7 @@ namespace rpp
             for (u32 i = modifiedIndex; i < m_size; i++)
             {
                 RPP_NEW_REPLACE(&m_data[i], T(std::move(const_cast<T &>(m_data[i + 1]))));
+                m_data[i + 1].~T();
             }
         }
 
@@ -268,6 +327,12 @@ namespace rpp
          */
         inline T *Data() { return m_data; }
 
+        /**
+         * @brief Get the pointer to the array data (read-only).
+         * @return Pointer to the array data.
+         */
+        inline const T *Data() const { return m_data; }
+
     private:
         T *m_data = nullptr; ///< Pointer to the array data.
         u32 m_capacity = 0;  ///< Current capacity of the array. The array will be resized when the size exceeds the capacity.
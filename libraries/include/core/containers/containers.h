@@ -4,4 +4,6 @@
 #include "queue.h"
 #include "set.h"
 #include "storage.h"
-#include "stack.h"
\ No newline at end of file
+#include "stack.h"
+#include "span.h"
+#include "lru_cache.h"
\ No newline at end of file
@@ -0,0 +1,243 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "array.h"
+#include <stdexcept>
+
+namespace rpp
+{
+    /**
+     * @brief The hash function type of the keys of a `LRUCache`.
+     * @param key The key to hash (pointer to the key).
+     * @return The hash of the key, equal keys must have the same hash.
+     */
+    typedef u32 (*LRUCacheHasher)(const void *key);
+
+    /**
+     * @brief A fixed-capacity map which forgets the least recently used entry when a new one does not fit. The entries
+     *      are allocated once, at construction, and reused afterwards: the lookups and the insertions do not allocate
+     *      (besides what copying the key and the value does). The keys are compared with `operator==`.
+     */
+    template <typename K, typename V, LRUCacheHasher Hasher>
+    class LRUCache
+    {
+    private:
+        static constexpr u32 NO_NODE = u32(-1);
+
+        /**
+         * One entry of the cache, linked twice: in the recency order and in its bucket.
+         */
+        struct Node
+        {
+            K key;
+            V value;
+            u32 hash;
+            u32 previous;     ///< The more recently used node, `NO_NODE` for the most recent one.
+            u32 next;         ///< The less recently used node (or the next free node), `NO_NODE` for the last one.
+            u32 nextInBucket; ///< The next node with the same bucket.
+        };
+
+    public:
+        /**
+         * @brief Creates an empty cache. An exception will be thrown if the capacity is 0.
+         * @param capacity The maximum number of entries.
+         */
+        LRUCache(u32 capacity)
+        {
+            if (capacity == 0)
+            {
+                throw std::runtime_error("The capacity of a cache must not be 0");
+            }
+
+            m_nodes.Resize(capacity);
+
+            // at least twice the capacity, as a power of two so that the bucket is a mask of the hash
+            u32 bucketCount = 1;
+            while (bucketCount < capacity * 2)
+            {
+                bucketCount <<= 1;
+            }
+            m_buckets.Resize(bucketCount);
+
+            Clear();
+        }
+
+    public:
+        /**
+         * @brief Get the number of entries in the cache.
+         */
+        inline u32 Size() const { return m_size; }
+
+        /**
+         * @brief Get the maximum number of entries in the cache.
+         */
+        inline u32 Capacity() const { return m_nodes.Size(); }
+
+        /**
+         * @brief Looks up an entry and marks it as the most recently used one.
+         * @param outValue Receives a copy of the value when the key is found.
+         * @return TRUE if the key is in the cache.
+         */
+        b8 Get(const K &key, V &outValue)
+        {
+            u32 nodeIndex = findNode(key, Hasher(&key));
+            if (nodeIndex == NO_NODE)
+            {
+                return FALSE;
+            }
+
+            unlink(nodeIndex);
+            linkFront(nodeIndex);
+            outValue = m_nodes[nodeIndex].value;
+            return TRUE;
+        }
+
+        /**
+         * @brief Adds or replaces an entry, which becomes the most recently used one. The least recently used entry
+         *      is dropped when the cache is full.
+         */
+        void Put(const K &key, const V &value)
+        {
+            u32 hash = Hasher(&key);
+            u32 nodeIndex = findNode(key, hash);
+            if (nodeIndex != NO_NODE)
+            {
+                m_nodes[nodeIndex].value = value;
+                unlink(nodeIndex);
+                linkFront(nodeIndex);
+                return;
+            }
+
+            if (m_freeHead == NO_NODE)
+            {
+                Remove(m_nodes[m_tail].key);
+            }
+
+            nodeIndex = m_freeHead;
+            Node &node = m_nodes[nodeIndex];
+            m_freeHead = node.next;
+
+            node.key = key;
+            node.value = value;
+            node.hash = hash;
+
+            u32 &bucket = m_buckets[hash & (m_buckets.Size() - 1)];
+            node.nextInBucket = bucket;
+            bucket = nodeIndex;
+
+            linkFront(nodeIndex);
+            m_size++;
+        }
+
+        /**
+         * @brief Removes an entry.
+         * @return TRUE if the key was in the cache.
+         */
+        b8 Remove(const K &key)
+        {
+            u32 hash = Hasher(&key);
+            u32 *pLink = &m_buckets[hash & (m_buckets.Size() - 1)];
+            while (*pLink != NO_NODE)
+            {
+                u32 nodeIndex = *pLink;
+                Node &node = m_nodes[nodeIndex];
+                if (node.hash == hash && node.key == key)
+                {
+                    *pLink = node.nextInBucket;
+                    unlink(nodeIndex);
+
+                    node.next = m_freeHead;
+                    m_freeHead = nodeIndex;
+                    m_size--;
+                    return TRUE;
+                }
+                pLink = &node.nextInBucket;
+            }
+            return FALSE;
+        }
+
+        /**
+         * @brief Removes all the entries. The previous keys and values are kept until their node is reused.
+         */
+        void Clear()
+        {
+            for (u32 i = 0; i < m_buckets.Size(); i++)
+            {
+                m_buckets[i] = NO_NODE;
+            }
+
+            for (u32 i = 0; i < m_nodes.Size(); i++)
+            {
+                m_nodes[i].next = i + 1 < m_nodes.Size() ? i + 1 : NO_NODE;
+            }
+
+            m_freeHead = 0;
+            m_head = NO_NODE;
+            m_tail = NO_NODE;
+            m_size = 0;
+        }
+
+    private:
+        u32 findNode(const K &key, u32 hash) const
+        {
+            // read through `Data()`, the const `operator[]` of `Array` returns a copy of the node
+            u32 nodeIndex = m_buckets.Data()[hash & (m_buckets.Size() - 1)];
+            while (nodeIndex != NO_NODE)
+            {
+                const Node &node = m_nodes.Data()[nodeIndex];
+                if (node.hash == hash && node.key == key)
+                {
+                    return nodeIndex;
+                }
+                nodeIndex = node.nextInBucket;
+            }
+            return NO_NODE;
+        }
+
+        void unlink(u32 nodeIndex)
+        {
+            Node &node = m_nodes[nodeIndex];
+            if (node.previous != NO_NODE)
+            {
+                m_nodes[node.previous].next = node.next;
+            }
+            else
+            {
+                m_head = node.next;
+            }
+
+            if (node.next != NO_NODE)
+            {
+                m_nodes[node.next].previous = node.previous;
+            }
+            else
+            {
+                m_tail = node.previous;
+            }
+        }
+
+        void linkFront(u32 nodeIndex)
+        {
+            Node &node = m_nodes[nodeIndex];
+            node.previous = NO_NODE;
+            node.next = m_head;
+
+            if (m_head != NO_NODE)
+            {
+                m_nodes[m_head].previous = nodeIndex;
+            }
+            else
+            {
+                m_tail = nodeIndex;
+            }
+            m_head = nodeIndex;
+        }
+
+    private:
+        Array<Node> m_nodes;   ///< Every entry, allocated at construction.
+        Array<u32> m_buckets;  ///< The first node of each bucket, `NO_NODE` for an empty bucket.
+        u32 m_freeHead;        ///< The first unused node, the unused nodes are chained with `Node::next`.
+        u32 m_head;            ///< The most recently used node.
+        u32 m_tail;            ///< The least recently used node, dropped first.
+        u32 m_size;            ///< The number of entries.
+    };
+} // namespace rpp
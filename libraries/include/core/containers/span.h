@@ -0,0 +1,80 @@
+#pragma once
+#include "platforms/platforms.h"
+#include <stdexcept>
+
+namespace rpp
+{
+    /**
+     * @brief A non-owning view of contiguous elements (an array, a mapped file...). The viewed memory must outlive the
+     *      span. Use `Span<const T>` for a read-only view.
+     */
+    template <typename T>
+    class Span
+    {
+    public:
+        /**
+         * @brief Default constructor for an empty span.
+         */
+        Span()
+            : m_data(nullptr), m_size(0)
+        {
+        }
+
+        /**
+         * @brief Views `size` elements starting at `data`.
+         */
+        Span(T *data, u32 size)
+            : m_data(data), m_size(size)
+        {
+        }
+
+    public:
+        /**
+         * @brief Get the number of elements in the span.
+         */
+        inline u32 Size() const { return m_size; }
+
+        /**
+         * @brief Check if the span has no element.
+         */
+        inline b8 Empty() const { return m_size == 0; }
+
+        /**
+         * @brief Get the pointer to the first element (nullptr for an empty span).
+         */
+        inline T *Data() const { return m_data; }
+
+        /**
+         * @brief Access an element. An exception will be thrown if the index is out of range.
+         */
+        T &operator[](u32 index) const
+        {
+            if (index >= m_size)
+            {
+                throw std::runtime_error("Span index out of bounds");
+            }
+            return m_data[index];
+        }
+
+        /**
+         * @brief Views a part of the span. An exception will be thrown if the range does not fit into the span.
+         * @param offset The index of the first element of the part.
+         * @param count The number of elements of the part.
+         */
+        Span SubSpan(u32 offset, u32 count) const
+        {
+            if (offset > m_size || count > m_size - offset)
+            {
+                throw std::runtime_error("Span range out of bounds");
+            }
+            return Span(m_data + offset, count);
+        }
+
+        inline T *begin() const { return m_data; }
+        inline T *end() const { return m_data + m_size; }
+
+    private:
+        T *m_data;  ///< The first viewed element, not owned by the span.
+        u32 m_size; ///< The number of viewed elements.
+    };
+} // namespace rpp
@@ -5,10 +5,17 @@
 #include "logging.h"
 #include "handlers/handlers.h"
 #include "string.h"
+#include "string_builder.h"
+#include "string_id.h"
+#include "path.h"
+#include "simd.h"
 #include "containers/containers.h"
 #include "format.h"
 #include "assertions.h"
 #include "json.h"
+#include "json_stream.h"
+#include "json_schema.h"
+#include "binary_stream.h"
 #include "timer.h"
 #include "stb_image.h"
 #include "filesystem.h"
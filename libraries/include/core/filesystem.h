@@ -2,7 +2,9 @@
 #include "common.h"
 #include "platforms/platforms.h"
 #include "containers/storage.h"
+#include "containers/span.h"
 #include "string.h"
+#include <functional>
 
 namespace rpp
 {
@@ -17,6 +19,40 @@ namespace rpp
 #define FILE_MODE_WRITE u32(0x01)      ///< Open the file for writing (overwrites existing content).
 #define FILE_MODE_APPEND u32(0x02)     ///< Open the file for appending (adds to the end of the file).
 #define FILE_MODE_READ_WRITE u32(0x03) ///< Open the file for both reading and writing.
+#define FILE_MODE_BINARY u32(0x04)     ///< Combined with one of the modes above, disables the newline translation.
+
+#define FILE_CHANGE_CREATED u8(0x01)  ///< The file was created in, or moved into, the watched directory.
+#define FILE_CHANGE_MODIFIED u8(0x02) ///< The content of the file was written.
+#define FILE_CHANGE_DELETED u8(0x04)  ///< The file was deleted from, or moved out of, the watched directory.
+
+    /**
+     * Identifies a directory watched with `FileSystem::Watch`.
+     */
+    typedef u32 WatchHandle;
+
+    /**
+     * @brief One file or directory found by `FileSystem::ListDirectory`.
+     */
+    struct DirectoryEntry
+    {
+        String name;      ///< The name inside the listed directory, without the path of the directory.
+        b8 isDirectory;
+    };
+
+    /**
+     * @brief The changes of one file of a watched directory, coalesced over a short delay.
+     */
+    struct FileChangeEvent
+    {
+        WatchHandle watch;
+        String filePath; ///< The logical path of the file (the watched path joined with the name of the file).
+        u8 changes;      ///< The `FILE_CHANGE_*` flags seen during the delay (a file can be created then modified).
+    };
+
+    /**
+     * @brief Executed on the main thread by `FileSystem::ProcessWatchEvents`.
+     */
+    typedef std::function<void(const FileChangeEvent &event)> FileWatchCallback;
 
     /**
      * The file system module provides functionalities for file and directory operations.
@@ -48,10 +84,56 @@ namespace rpp
         /**
          * used internally to convert a given path to the actual physical path on the filesystem (for testing environment)
          *
-         * @note in non-testing environment, this function will return the path as-is.
+         * @note in non-testing environment, this function will return the path as-is. In testing environment the path
+         *      is normalized (see `Path`) and the result is cached, keyed by the path as given.
          */
         static String getPhysicalPath(const String &path);
 
+        /**
+         * used internally to access `s_fileEntries` from any thread (the entries themselves are not shared between threads)
+         */
+        static FileHandle createFileEntry();
+        static FileEntry *getFileEntry(FileHandle file);
+
+        /**
+         * used internally by `Initialize` and `Shutdown` for the state of `Watch` (filesystem_watch.cpp)
+         */
+        static void initializeWatches();
+        static void shutdownWatches();
+
+        /**
+         * used internally for the mount points (filesystem_vfs.cpp). The `try*` functions return FALSE when the path is
+         *      not inside a memory or archive mount, the caller then uses the physical file.
+         */
+        static void initializeMounts();
+        static void shutdownMounts();
+        static b8 tryResolveDirectoryMount(const String &path, String &outPhysicalPath);
+        static b8 tryReadMounted(const String &path, Array<u8> &outBytes, b8 &outRead);
+        static b8 tryWriteMounted(const String &path, const u8 *data, u32 length, b8 &outWritten);
+        static b8 tryDeleteMounted(const String &path);
+        static b8 tryRenameMounted(const String &sourcePath, const String &destinationPath, b8 &outRenamed);
+        static b8 tryFindMounted(const String &path, b8 &outExists, b8 &outIsDirectory);
+        static b8 tryListMounted(const String &path, Array<DirectoryEntry> &outEntries, StringView pattern, b8 &outListed);
+
+        /**
+         * used internally by `OpenFile` for the files of the memory and archive mounts: the entry reads a copy of the
+         *      file, a nullptr content gives a closed handle.
+         */
+        static FileHandle openVirtualFile(const String &filePath, const Array<u8> *pContent);
+
+        /**
+         * used internally by `OpenFile` for the write modes on a memory or archive mount: the entry writes to a buffer
+         *      which replaces the file of the memory mount when the handle is closed. A closed handle is returned for
+         *      `FILE_MODE_READ_WRITE` and the archive mounts.
+         */
+        static FileHandle openVirtualWriteFile(const String &filePath, u32 mode);
+
+        /**
+         * used internally by `MapFile` for the files of the memory and archive mounts: the content is copied to the heap
+         *      and exposed like a read-only mapping, a nullptr content gives a closed handle.
+         */
+        static FileHandle mapVirtualFile(const String &filePath, const Array<u8> *pContent);
+
     public:
         /**
          * @brief Checks if a physical file/folder exists on the filesystem.
@@ -70,7 +152,8 @@ namespace rpp
         /**
          * @brief Creates a physical directory on the filesystem.
          * @param path The physical path where the directory should be created (the ABSOLUTE path)
-         * @note The function will create any necessary parent directories as well.
+         * @note The function will create any necessary parent directories as well. The directories created or found are
+         *      remembered, so that opening many files in the same directory for writing checks it only once.
          * @note The directory is the physical path, not the logical path.
          */
         static void CreatePhysicalDirectory(const String &path);
@@ -110,6 +193,14 @@ namespace rpp
          */
         static FileHandle OpenPhysicalFile(const String &filePath, u32 mode = FILE_MODE_READ);
 
+        /**
+         * @brief Maps a whole physical file into memory (see `MapFile`).
+         * @param filePath The physical path of the file (the ABSOLUTE path).
+         * @param mode `FILE_MODE_READ` or `FILE_MODE_READ_WRITE`.
+         * @return The handle of the mapping, check it with `IsFileOpen`.
+         */
+        static FileHandle MapPhysicalFile(const String &filePath, u32 mode = FILE_MODE_READ);
+
     public:
         /**
          * @brief Checks if a file exists at the specified path.
@@ -132,6 +223,7 @@ namespace rpp
          * @brief Reads the entire content of an open file into a string.
          * @param file The handle of the file to read from.
          * @return A String containing the content of the file.
+         * @note The lines are joined by '\n' and the last newline is dropped, use `ReadBytes` for the exact content.
          */
         static String Read(FileHandle file) RPP_E2E_BINDING;
 
@@ -143,6 +235,102 @@ namespace rpp
          */
         static void Write(FileHandle file, const String &data) RPP_E2E_BINDING;
 
+        /**
+         * @brief Reads the next raw bytes of an open file (no newline handling), used to stream large files.
+         * @param file The handle of the file to read from.
+         * @param buffer The buffer to fill.
+         * @param capacity The size of the buffer in bytes.
+         * @return The number of bytes read, 0 once the end of the file is reached.
+         */
+        static u32 ReadChunk(FileHandle file, char *buffer, u32 capacity);
+
+        /**
+         * @brief Writes raw bytes to an open file without flushing it, used to stream large files.
+         * @param file The handle of the file to write to.
+         * @param data The bytes to write.
+         * @param length The number of bytes to write.
+         */
+        static void WriteChunk(FileHandle file, const char *data, u32 length);
+
+        /**
+         * @brief Reads the rest of an open file as raw bytes (no newline handling): the size is queried once and the
+         *      content is read with a single call. Open the file with `FILE_MODE_BINARY` so that nothing is translated.
+         * @param file The handle of the file to read from.
+         * @param outBytes Replaced by the content of the file.
+         * @return TRUE if the file was read.
+         */
+        static b8 ReadBytes(FileHandle file, Array<u8> &outBytes);
+
+        /**
+         * @brief Writes raw bytes to an open file. Unlike `Write`, the stream is not flushed on every call: the bytes
+         *      are sent to the OS when the buffer of the stream is full or when the file is closed.
+         * @param file The handle of the file to write to.
+         * @param data The bytes to write.
+         * @param length The number of bytes to write.
+         */
+        static void WriteBytes(FileHandle file, const u8 *data, u32 length);
+
+        /**
+         * @brief Reads a whole file as raw bytes, see `ReadBytes`.
+         * @param filePath The path to the file to read.
+         * @param outBytes Replaced by the content of the file.
+         * @return TRUE if the file was read.
+         */
+        static b8 ReadAll(const String &filePath, Array<u8> &outBytes);
+
+        /**
+         * @brief Replaces the content of a file with raw bytes, written with a single call.
+         * @param filePath The path to the file to write.
+         * @param data The bytes to write.
+         * @param length The number of bytes to write.
+         * @return TRUE if the file was written.
+         */
+        static b8 WriteAll(const String &filePath, const u8 *data, u32 length);
+
+        /**
+         * @brief Maps a whole file into memory. The content is accessed in place through `GetMappedBytes`, pages are
+         *      loaded by the OS on demand and nothing is copied into the process: the page cache is shared with the
+         *      other processes which map or read the same file. Close it with `CloseFile`. A file of a memory or
+         *      archive mount is copied once instead, and can only be mapped for reading.
+         * @param filePath The path to the file to map.
+         * @param mode `FILE_MODE_READ` (default) or `FILE_MODE_READ_WRITE`. The changes made through a read-write
+         *      mapping are written back to the file (see `FlushMappedFile`), its size can not change.
+         * @return The handle of the mapping, check it with `IsFileOpen`.
+         */
+        static FileHandle MapFile(const String &filePath, u32 mode = FILE_MODE_READ);
+
+        /**
+         * @brief Checks if the handle was created by `MapFile`.
+         */
+        static b8 IsFileMapped(FileHandle file);
+
+        /**
+         * @brief Returns the content of a mapped file, valid until the handle is closed (nullptr for an empty file).
+         */
+        static const u8 *GetMappedData(FileHandle file);
+
+        /**
+         * @brief Returns the size in bytes of a mapped file.
+         */
+        static u32 GetMappedSize(FileHandle file);
+
+        /**
+         * @brief Returns the content of a mapped file as a read-only span, valid until the handle is closed.
+         */
+        static Span<const u8> GetMappedBytes(FileHandle file);
+
+        /**
+         * @brief Returns the content of a file mapped with `FILE_MODE_READ_WRITE`, valid until the handle is closed.
+         */
+        static Span<u8> GetMappedWritableBytes(FileHandle file);
+
+        /**
+         * @brief Writes the changes made through a read-write mapping to the file and waits for it. The OS also writes
+         *      them back by itself, at the latest when the handle is closed.
+         * @return TRUE if the changes were written.
+         */
+        static b8 FlushMappedFile(FileHandle file);
+
         /**
          * Closes an open file identified by the given file handle.
          * @param file The handle of the file to close.
@@ -175,6 +363,108 @@ namespace rpp
          */
         static void DeleteFile(const String &path) RPP_E2E_BINDING;
 
+        /**
+         * @brief Renames a file, replacing the destination if it exists. On the same volume the replacement is atomic:
+         *      readers see either the old or the new content, never a partially written file.
+         * @param sourcePath The path of the file to rename.
+         * @param destinationPath The new path of the file.
+         * @return TRUE if the file was renamed, FALSE otherwise.
+         */
+        static b8 RenameFile(const String &sourcePath, const String &destinationPath);
+
+        /**
+         * @brief Lists the files and directories directly inside a directory (not recursive), sorted by name.
+         * @param directoryPath The path of the directory to list.
+         * @param outEntries Replaced by the entries whose name matches the pattern.
+         * @param pattern A glob pattern matched against the names, see `MatchGlob`.
+         * @return FALSE if the directory cannot be read.
+         */
+        static b8 ListDirectory(const String &directoryPath, Array<DirectoryEntry> &outEntries, StringView pattern = "*");
+
+        /**
+         * @brief Checks a name against a glob pattern: `*` matches any number of characters and `?` matches one
+         *      character, the other characters match themselves (case-sensitive).
+         *
+         * @example
+         * ```cpp
+         * FileSystem::MatchGlob("robot.png", "*.png"); // TRUE
+         * FileSystem::MatchGlob("move_1.py", "move_?.py"); // TRUE
+         * ```
+         */
+        static b8 MatchGlob(StringView name, StringView pattern);
+
+        /**
+         * @brief Starts watching the files directly inside a directory (not recursive). The changes are read without
+         *      blocking by `ProcessWatchEvents`, and the changes of one file are coalesced until it stays untouched
+         *      for a short delay, so that a save made of several writes is reported once.
+         * @param directoryPath The path of the directory to watch.
+         * @param callback Executed on the main thread by `ProcessWatchEvents`, once per changed file.
+         * @return The handle of the watch, INVALID_ID if the directory cannot be watched.
+         * @note Watching is done with inotify on Linux and `ReadDirectoryChangesW` on Windows. Only call the watch
+         *      functions from the main thread.
+         */
+        static WatchHandle Watch(const String &directoryPath, FileWatchCallback callback);
+
+        /**
+         * @brief Stops a watch started by `Watch`. The changes not dispatched yet are dropped.
+         */
+        static void Unwatch(WatchHandle watch);
+
+        /**
+         * @brief Reads the pending changes of the watched directories and executes the callbacks of the changes which
+         *      are settled. `GraphicSessionManager::Update` calls it every frame.
+         * @return The number of executed callbacks.
+         */
+        static u32 ProcessWatchEvents();
+
+        /// Mount points
+    public:
+        /**
+         * @brief Makes a physical directory appear at a logical path: the paths inside the mount point are translated
+         *      to paths inside the directory, before the translation of the testing environment (which acts as the
+         *      mount of the root).
+         * @param mountPoint The logical path of the mount, the deepest mount wins when mount points are nested.
+         * @param physicalDirectoryPath The directory to mount (the ABSOLUTE path, or relative to the process CWD).
+         * @return FALSE if the directory does not exist or the mount point is already used.
+         */
+        static b8 MountDirectory(const String &mountPoint, const String &physicalDirectoryPath);
+
+        /**
+         * @brief Mounts an empty in-memory directory. The files are created by `WriteAll` or `OpenFile` (write and
+         *      append modes, the content is stored when the handle is closed), read by `ReadAll`, `OpenFile` and
+         *      `MapFile`, renamed with `RenameFile` inside the mount, and dropped with `DeleteFile` or `Unmount`. The
+         *      directories exist as long as they hold a file.
+         * @return FALSE if the mount point is already used.
+         */
+        static b8 MountMemory(const String &mountPoint);
+
+        /**
+         * @brief Mounts a read-only archive created by `CreateArchive`. Only its table of contents is loaded, every read
+         *      is a single seek in the archive followed by the decompression of the file when it is compressed.
+         * @param mountPoint The logical path of the mount.
+         * @param archivePath The logical path of the archive.
+         * @return FALSE if the archive cannot be read or is not valid, or if the mount point is already used.
+         */
+        static b8 MountArchive(const String &mountPoint, const String &archivePath);
+
+        /**
+         * @brief Removes a mount added by one of the `Mount*` functions, the content of a memory mount is dropped.
+         * @return FALSE if nothing is mounted there.
+         */
+        static b8 Unmount(const String &mountPoint);
+
+        /**
+         * @brief Packs every file of a directory, recursively, into a single archive for `MountArchive`: a header, the
+         *      content of the files, then a table of contents with the path, offset and size of each file.
+         * @param archivePath The logical path of the archive to write.
+         * @param sourceDirectoryPath The logical path of the directory to pack.
+         * @param compress Compresses the files with a LZ77 codec, the files which do not shrink are stored as they are.
+         * @return TRUE if the archive was written.
+         * @note `FILE_MODE_READ_WRITE` (of `OpenFile` and `MapFile`) is not supported on the memory and archive mounts,
+         *      and `RenameFile` does not move a file out of the mount which holds it.
+         */
+        static b8 CreateArchive(const String &archivePath, const String &sourceDirectoryPath, b8 compress = TRUE);
+
         /// Path utils
     public:
         /**
@@ -1,42 +1,187 @@
 #pragma once
 #include "platforms/platforms.h"
 #include "string.h"
+#include <type_traits>
 
 namespace rpp
 {
     /**
-     * @brief Converts a format string with placeholders and a variable number of arguments into a formatted string.
+     * @brief The options written inside a placeholder, e.g. `{:>8.3}`. The full syntax is
+     *      `{[:[[fill]align][0][width][.precision]]}` where align is one of `<` (left), `>` (right) or `^` (center).
+     */
+    struct FormatSpec
+    {
+        char fill;     ///< The character used to pad the value up to `width`.
+        char align;    ///< '<', '>', '^' or 0 for the type's default (numbers right, text left).
+        b8 zeroPad;    ///< Pads numbers with '0' after the sign.
+        u32 width;     ///< The minimum number of characters written, 0 means no padding.
+        i32 precision; ///< Digits after the point for floats, maximum characters for text, -1 if not set.
+    };
+
+    /**
+     * @brief Writes the decimal representation of a number into the buffer. Floats use the shortest representation
+     *      which reads back to exactly the same value (e.g. `0.1f` -> "0.1", `1e20` -> "1e+20").
+     *
+     * @return The number of characters written (no null terminator), or 0 if the buffer is too small.
+     */
+    u32 ToChars(char *buffer, u32 capacity, i32 value);
+    u32 ToChars(char *buffer, u32 capacity, u32 value);
+    u32 ToChars(char *buffer, u32 capacity, i64 value);
+    u32 ToChars(char *buffer, u32 capacity, u64 value);
+    u32 ToChars(char *buffer, u32 capacity, f32 value);
+    u32 ToChars(char *buffer, u32 capacity, f64 value);
+
+    /**
+     * @brief Parses a decimal number. The whole text must be the number (an optional leading '+' is allowed,
+     *      whitespace is not), and it must fit into the output type.
+     *
+     * @return TRUE on success. On failure `outValue` is not modified.
      *
-     * @return A formatted String.
+     * @example
+     * ```cpp
+     * f32 value;
+     * if (FromChars("3.14159", value)) { ... }
+     * ```
      */
-    String Format(const String &formatMessage);
+    b8 FromChars(StringView text, u8 &outValue);
+    b8 FromChars(StringView text, u16 &outValue);
+    b8 FromChars(StringView text, u32 &outValue);
+    b8 FromChars(StringView text, u64 &outValue);
+    b8 FromChars(StringView text, i8 &outValue);
+    b8 FromChars(StringView text, i16 &outValue);
+    b8 FromChars(StringView text, i32 &outValue);
+    b8 FromChars(StringView text, i64 &outValue);
+    b8 FromChars(StringView text, f32 &outValue);
+    b8 FromChars(StringView text, f64 &outValue);
 
     /**
-     * @brief Converts a value of any type to its string representation.
-     * @tparam T The type of the value to convert.
-     * @param value The value to convert to a string.
+     * @brief Writes formatted pieces into a caller-provided character buffer. Nothing is allocated: when the buffer
+     *      is full the output is truncated but `Length()` keeps counting, so the caller can retry with a buffer of
+     *      `Length() + 1` characters.
      *
-     * @return A String representing the value.
+     * @note The output is NOT null-terminated by the writer.
      */
-    template <typename T>
-    String Format(const String &formatMessage, const T &value)
+    class FormatWriter
     {
-        String result = formatMessage;
-        return result.Replace("{}", ToString<T>(value));
-    }
+    public:
+        FormatWriter(char *buffer, u32 capacity);
+
+    public:
+        /**
+         * @brief Returns the number of characters the full output needs, which may be larger than the capacity.
+         */
+        inline u32 Length() const { return m_length; }
+
+        /**
+         * @brief Checks whether some of the output did not fit into the buffer.
+         */
+        inline b8 Truncated() const { return m_length > m_capacity; }
+
+    public:
+        void Write(StringView value);
+        void Write(char value);
+
+        void WriteText(StringView value, const FormatSpec &spec);
+        void WriteSigned(i64 value, const FormatSpec &spec);
+        void WriteUnsigned(u64 value, const FormatSpec &spec);
+        void WriteFloat(f32 value, const FormatSpec &spec);
+        void WriteFloat(f64 value, const FormatSpec &spec);
+        void WriteBool(b8 value, const FormatSpec &spec);
+
+    private:
+        void writeFill(char fill, u32 count);
+        void writePadded(StringView value, const FormatSpec &spec, char defaultAlign);
+        void writeNumber(StringView digits, const FormatSpec &spec);
+
+    private:
+        char *m_buffer;
+        u32 m_capacity;
+        u32 m_length;
+    };
+
+    namespace details
+    {
+        /**
+         * One type-erased argument of a `Format` call. The value is only referenced, never copied.
+         */
+        struct FormatArgument
+        {
+            const void *value;
+            void (*write)(FormatWriter &writer, const FormatSpec &spec, const void *value);
+        };
+
+        template <typename T>
+        void WriteFormatArgument(FormatWriter &writer, const FormatSpec &spec, const void *value)
+        {
+            const T &argument = *static_cast<const T *>(value);
+
+            if constexpr (std::is_same_v<T, b8>)
+            {
+                writer.WriteBool(argument, spec);
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+            {
+                writer.WriteSigned(static_cast<i64>(argument), spec);
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                writer.WriteUnsigned(static_cast<u64>(argument), spec);
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                if constexpr (std::is_same_v<T, f32>)
+                {
+                    writer.WriteFloat(argument, spec);
+                }
+                else
+                {
+                    writer.WriteFloat(static_cast<f64>(argument), spec);
+                }
+            }
+            else if constexpr (std::is_convertible_v<const T &, StringView>)
+            {
+                writer.WriteText(StringView(argument), spec);
+            }
+            else
+            {
+                String text = ToString<T>(argument);
+                writer.WriteText(text, spec);
+            }
+        }
+
+        /**
+         * Walks the pattern once from left to right and writes every literal run and argument into the writer.
+         */
+        void FormatPattern(FormatWriter &writer, StringView pattern, const FormatArgument *arguments, u32 argumentCount);
+
+        /**
+         * Formats into a stack buffer first and only touches the heap when the result does not fit into it.
+         */
+        String FormatPatternToString(StringView pattern, const FormatArgument *arguments, u32 argumentCount);
+
+        /**
+         * Formats into the given buffer, null-terminates it and returns the full length of the output.
+         */
+        u32 FormatPatternTo(char *buffer, u32 capacity, StringView pattern, const FormatArgument *arguments, u32 argumentCount);
+    } // namespace details
 
     /**
-     * Formatting function that supports multiple arguments.
-     * It replaces each occurrence of "{}" in the formatMessage with the string representation of the corresponding argument.
-     * @tparam T The type of the first argument.
-     * @tparam Args The types of the remaining arguments.
-     * @param formatMessage The format string containing "{}" placeholders.
-     * @param value The first argument to format.
-     * @param args The remaining arguments to format.
+     * Formatting function that supports any number of arguments.
+     * It replaces each "{}" placeholder in the formatMessage with the string representation of the corresponding argument.
+     * The pattern is parsed in a single pass and the arguments are written straight into the output, so placeholders
+     * which appear inside an argument value are kept as-is.
+     *
+     * @param formatMessage The format string containing "{}" placeholders. A placeholder may carry a spec, e.g. `{:8}`,
+     *      `{:.3}`, `{:>10}` or `{:08.2}` (see `FormatSpec`). A `{` which does not start a valid placeholder is
+     *      written literally.
+     * @param args The arguments to format. Extra arguments are ignored, and placeholders without an argument are
+     *      written literally.
      *
      * @return A formatted String with all placeholders replaced by the corresponding argument values.
      *
-     * @note If a new class type is needed to be formatted, you must provide a specialization of the ToString function for that type.
+     * @note Integers, floats, booleans and anything convertible to `StringView` are written directly. Floats use the
+     * shortest round-trip representation unless a precision is given (`{:.2}`). If a new class
+     * type is needed to be formatted, you must provide a specialization of the ToString function for that type.
      * Example:
      * ```cpp
      * class MyClass { ... };
@@ -46,11 +191,32 @@ namespace rpp
      * ```
      *
      */
-    template <typename T, typename... Args>
-    String Format(const String &formatMessage, const T &value, const Args &...args)
+    template <typename... Args>
+    String Format(StringView formatMessage, const Args &...args)
+    {
+        const details::FormatArgument arguments[] = {{&args, &details::WriteFormatArgument<Args>}..., {nullptr, nullptr}};
+        return details::FormatPatternToString(formatMessage, arguments, sizeof...(Args));
+    }
+
+    /**
+     * @brief Same as `Format` but writes the result into a caller-provided buffer, no memory is allocated.
+     *
+     * @param buffer The output buffer, always null-terminated when `capacity` is not 0.
+     * @param capacity The size of the buffer in bytes (including the null terminator).
+     *
+     * @return The length of the full formatted output (without the null terminator). If it is greater than or equal
+     *      to `capacity`, the output was truncated.
+     *
+     * @example
+     * ```cpp
+     * char buffer[64];
+     * u32 length = FormatTo(buffer, sizeof(buffer), "Frame {} took {:.3} ms", frameIndex, elapsed);
+     * ```
+     */
+    template <typename... Args>
+    u32 FormatTo(char *buffer, u32 capacity, StringView formatMessage, const Args &...args)
     {
-        String result = formatMessage;
-        result = result.Replace("{}", ToString(value));
-        return Format(result, args...);
+        const details::FormatArgument arguments[] = {{&args, &details::WriteFormatArgument<Args>}..., {nullptr, nullptr}};
+        return details::FormatPatternTo(buffer, capacity, formatMessage, arguments, sizeof...(Args));
     }
 } // namespace rpp
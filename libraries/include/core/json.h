@@ -1,10 +1,148 @@
 #pragma once
+#include "common.h"
 #include "platforms/platforms.h"
 #include "string.h"
 #include "containers/array.h"
 
 namespace rpp
 {
+    /**
+     * @brief The layouts `Json::ToString` and `JsonWriter` can produce.
+     */
+    enum class JsonFormat : u8
+    {
+        COMPACT, ///< Everything on one line without any whitespace.
+        PRETTY,  ///< One member/element per line, indented by 4 spaces per level.
+        COUNT RPP_HIDE,
+    };
+
+    class Json;
+
+    /**
+     * @brief A read-only view into a node of a `Json` document (an object, an array or a value). Nothing is copied or
+     *      re-parsed when walking down the tree, so nested accesses cost the same as accessing the root.
+     *
+     * @note The view does not own the node: it must not outlive the `Json` it comes from, and it is invalidated when
+     *      that part of the document is replaced or removed.
+     *
+     * @example
+     * ```cpp
+     * Json project(content);
+     * JsonConstRef functions = project.Ref().Child("functions");
+     * for (u32 i = 0; i < functions.Size(); i++)
+     * {
+     *     String name = functions.At(i).Get<String>("name");
+     * }
+     * ```
+     */
+    class JsonConstRef
+    {
+    public:
+        /**
+         * @brief Constructs an invalid view. Every query returns the default value.
+         */
+        JsonConstRef();
+
+        /**
+         * @brief Constructs a view over a node of the underlying JSON library (used internally by `Json`).
+         */
+        explicit JsonConstRef(const void *node);
+
+    public:
+        /**
+         * @brief Checks whether the view points to a node (FALSE for a missing child).
+         */
+        inline b8 IsValid() const { return m_node != nullptr; }
+
+        /**
+         * @brief Same as `Json::Get` for the viewed node.
+         */
+        template <typename T>
+        T Get(const String &key, const T defaultValue = T()) const;
+
+        /**
+         * @brief Same as `Json::Get` (array version) for the viewed node.
+         */
+        template <typename T>
+        T Get(i32 index, const T defaultValue = T()) const;
+
+        /**
+         * @brief Returns a view of the child with the specified key, or an invalid view if the node is not an object
+         *      or the key does not exist.
+         */
+        JsonConstRef Child(const String &key) const;
+
+        /**
+         * @brief Returns a view of the array element at the specified index, or an invalid view if the node is not an
+         *      array or the index is out of range.
+         */
+        JsonConstRef At(i32 index) const;
+
+        /**
+         * @brief Checks whether the viewed object contains the specified key.
+         */
+        b8 Contains(const String &key) const;
+
+        b8 Empty() const;
+        b8 IsArray() const;
+        b8 IsObject() const;
+        u32 Size() const;
+
+        /**
+         * @brief Serializes the viewed node (same as `Json::ToString`).
+         */
+        String ToString(JsonFormat format = JsonFormat::PRETTY) const;
+
+    protected:
+        const void *m_node;
+
+        friend class Json;
+        friend class JsonRef;
+    };
+
+    /**
+     * @brief A mutable view into a node of a `Json` document. Same rules as `JsonConstRef`, and modifications are
+     *      written directly into the document.
+     */
+    class JsonRef : public JsonConstRef
+    {
+    public:
+        JsonRef();
+        explicit JsonRef(void *node);
+
+    public:
+        /**
+         * @brief Same as `Json::Set` for the viewed node.
+         */
+        template <typename T>
+        void Set(const String &key, const T &value);
+
+        /**
+         * @brief Same as `Json::Set` (array version) for the viewed node.
+         */
+        template <typename T>
+        void Set(i32 index, const T &value);
+
+        /**
+         * @brief Same as `Json::Append` for the viewed node.
+         */
+        template <typename T>
+        void Append(const T &value);
+
+        /**
+         * @brief Returns a mutable view of the child with the specified key (invalid if missing).
+         */
+        JsonRef Child(const String &key);
+
+        /**
+         * @brief Returns a mutable view of the array element at the specified index (invalid if out of range).
+         */
+        JsonRef At(i32 index);
+
+    private:
+        inline void *node() const { return const_cast<void *>(m_node); }
+    };
+
     /**
      * @brief A wrapper for JSON data structure, providing parsing and serialization functionalities.
      *      This class is designed to handle JSON formatted strings, allowing for easy manipulation and access to JSON data.
@@ -28,16 +166,40 @@ namespace rpp
          */
         Json(const Json &other);
 
+        /**
+         * @brief Creates a deep copy of the viewed node. An invalid view gives an empty object.
+         */
+        explicit Json(JsonConstRef node);
+
         Json(Json &&other) noexcept;
 
         ~Json();
 
+        /**
+         * @brief Replaces the content with a deep copy of another Json object.
+         */
+        Json &operator=(const Json &other);
+
+        Json &operator=(Json &&other) noexcept;
+
+    public:
+        /**
+         * @brief Returns a mutable view of the root node.
+         */
+        inline JsonRef Ref() { return JsonRef(m_data); }
+
+        /**
+         * @brief Returns a read-only view of the root node.
+         */
+        inline JsonConstRef Ref() const { return JsonConstRef(m_data); }
+
     public:
         /**
          * @brief Serializes the Json object back into a JSON-formatted string.
+         * @param format PRETTY (default) for files read by humans, COMPACT for data which is only stored or sent.
          * @return A String containing the JSON representation of the object.
          */
-        String ToString() const;
+        String ToString(JsonFormat format = JsonFormat::PRETTY) const;
 
         /**
          * @brief Retrieves the value associated with the specified key, returning a default value if the key is not found or if the type does not match.
@@ -48,7 +210,10 @@ namespace rpp
          * @return The value associated with the specified key, or the default value if the key
          */
         template <typename T>
-        T Get(const String &key, const T defaultValue = T()) const;
+        T Get(const String &key, const T defaultValue = T()) const
+        {
+            return Ref().Get<T>(key, defaultValue);
+        }
 
         /**
          * @brief The overloaded Get method for accessing elements in a JSON array by index (only support for array type).
@@ -59,7 +224,10 @@ namespace rpp
          * @note If the JSON object is not an array, always return the default value.
          */
         template <typename T>
-        T Get(i32 index, const T defaultValue = T()) const;
+        T Get(i32 index, const T defaultValue = T()) const
+        {
+            return Ref().Get<T>(index, defaultValue);
+        }
 
         /**
          * @brief Sets the value for the specified key in the JSON object. If the key already exists, its value is updated; otherwise, a new key-value pair is added.
@@ -68,7 +236,10 @@ namespace rpp
          * @note This method supports values of type String and various integer types (u32, u16, u8, i32, i16, i8).
          */
         template <typename T>
-        void Set(const String &key, const T &value);
+        void Set(const String &key, const T &value)
+        {
+            Ref().Set<T>(key, value);
+        }
 
         /**
          * @brief The overloaded Set method for setting elements in a JSON array by index (only support for array type).
@@ -80,7 +251,10 @@ namespace rpp
          * @note If the JSON object is not an array, this operation will be ignored.
          */
         template <typename T>
-        void Set(i32 index, const T &value);
+        void Set(i32 index, const T &value)
+        {
+            Ref().Set<T>(index, value);
+        }
 
         /**
          * @brief Appends a value to the end of the JSON array. If the JSON object is not an array, this operation will be ignored.
@@ -89,7 +263,10 @@ namespace rpp
          * @param value The value to append to the JSON array.
          */
         template <typename T>
-        void Append(const T &value);
+        void Append(const T &value)
+        {
+            Ref().Append<T>(value);
+        }
 
         /**
          * @brief Checks if the JSON object is empty (i.e., contains no key-value pairs).
@@ -112,6 +289,9 @@ namespace rpp
 
     private:
         void *m_data;
+
+        friend class JsonConstRef;
+        friend class JsonRef;
     };
 
     /**
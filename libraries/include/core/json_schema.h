@@ -0,0 +1,131 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "string.h"
+#include "json.h"
+#include "json_stream.h"
+
+/// The key which holds the version of the structs annotated with `RPP_JSON_VERSION`, always written first.
+#define RPP_JSON_VERSION_KEY "version"
+
+namespace rpp
+{
+    /**
+     * @brief The kind of value expected for a key of a `JsonSchema`.
+     */
+    enum class JsonValueType : u8
+    {
+        NUMBER,
+        BOOLEAN,
+        STRING,
+        ARRAY,
+        OBJECT,
+        COUNT RPP_HIDE,
+    };
+
+    /**
+     * @brief One key of a `JsonSchema`. Every key of the schema is required.
+     */
+    struct JsonSchemaField
+    {
+        const char *key;
+        JsonValueType type;
+    };
+
+    /**
+     * @brief Upgrades a document by one version, from `fromVersion` to `fromVersion + 1`. Autogen uses the static
+     *      `Migrate` method of the struct when it declares one:
+     *      `static b8 Migrate(u32 fromVersion, Json &document);`.
+     *
+     * @return FALSE if the document cannot be upgraded.
+     */
+    typedef b8 (*JsonMigration)(u32 fromVersion, Json &document);
+
+    /**
+     * @brief The layout expected for the JSON object of a struct annotated with `RPP_JSON`, generated by autogen from
+     *      the fields annotated with `RPP_JSON_KEY`.
+     */
+    struct JsonSchema
+    {
+        const char *name;              ///< The name of the struct (used in the error messages).
+        u32 version;                   ///< The value of `RPP_JSON_VERSION`, 0 for the structs which are not versioned.
+        const JsonSchemaField *fields; ///< The keys of the struct (`fieldCount` elements).
+        u32 fieldCount;
+        JsonMigration migration; ///< nullptr when the struct does not declare `Migrate`.
+    };
+
+    /**
+     * @brief Returns the schema of a struct. Autogen generates the specializations for the structs annotated with
+     *      `RPP_JSON`.
+     */
+    template <typename T>
+    const JsonSchema &GetJsonSchema();
+
+    /**
+     * @brief Reads the version of a document without parsing it: only the first key is looked at, which is where
+     *      `WriteJson` puts it.
+     *
+     * @return The version, or 0 if the document does not start with it (written before the struct was versioned, or
+     *      edited by hand).
+     */
+    u32 PeekJsonVersion(StringView content);
+
+    /**
+     * @brief Checks that the document is an object which holds every key of the schema with the expected type. The
+     *      keys which are not in the schema are allowed (they are skipped by `ReadJson`).
+     *
+     * @param outError The description of the first problem found.
+     * @return TRUE if the document matches the schema.
+     */
+    b8 ValidateJson(StringView content, const JsonSchema &schema, String &outError);
+
+    /**
+     * @brief Brings a document written with an older version to the current version of the schema: the migrations
+     *      are applied one version at a time, then the result is validated.
+     *
+     * @param outContent The upgraded document.
+     * @param outError The description of the problem when the document cannot be upgraded (invalid JSON, newer
+     *      version, failed migration, or a result which does not match the schema).
+     *
+     * @return TRUE if `outContent` can be read.
+     */
+    b8 UpgradeJson(StringView content, const JsonSchema &schema, String &outContent, String &outError);
+
+    /**
+     * @brief Reads a whole document into a struct annotated with `RPP_JSON`. A document of the current version is
+     *      streamed straight into the struct, only the version is checked (the fast path). An older document is
+     *      migrated and validated first, so the missing keys are reported instead of silently using defaults.
+     *
+     * @example
+     * ```cpp
+     * ProjectDescription desc = {};
+     * String error;
+     * if (!ReadVersionedJson(content, desc, error)) { RPP_LOG_ERROR("{}", error); }
+     * ```
+     *
+     * @return FALSE if the document cannot be read, `outError` describes why.
+     */
+    template <typename T>
+    b8 ReadVersionedJson(StringView content, T &outValue, String &outError)
+    {
+        const JsonSchema &schema = GetJsonSchema<T>();
+        if (PeekJsonVersion(content) == schema.version)
+        {
+            JsonReader reader(content);
+            if (!ReadJson(reader, outValue) || reader.Next() != JsonToken::END)
+            {
+                outError = reader.HasError() ? reader.GetError() : Format("{} is not a JSON object", schema.name);
+                return FALSE;
+            }
+            return TRUE;
+        }
+
+        String upgraded;
+        if (!UpgradeJson(content, schema, upgraded, outError))
+        {
+            return FALSE;
+        }
+
+        JsonReader reader(upgraded);
+        return ReadJson(reader, outValue);
+    }
+} // namespace rpp
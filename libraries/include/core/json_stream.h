@@ -0,0 +1,510 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "string.h"
+#include "string_builder.h"
+#include "format.h"
+#include "filesystem.h"
+#include "json.h"
+#include "containers/array.h"
+#include <cmath>
+#include <limits>
+#include <type_traits>
+
+/// The size of the chunks which are read from/written to the file by the streaming JSON reader and writer.
+#define RPP_JSON_STREAM_CHUNK_SIZE (16 * 1024)
+
+namespace rpp
+{
+    /**
+     * @brief Hashes an object key (FNV-1a). It is constexpr, so the generated readers `switch` on the hash of the key
+     *      instead of comparing it with every known key, and two known keys with the same hash do not compile (the
+     *      hash is perfect for the keys of each struct). An unknown key can still share a hash, so the matched key is
+     *      compared once.
+     */
+    constexpr u32 JsonKeyHash(const char *key, u32 length)
+    {
+        u32 hash = 2166136261u;
+        for (u32 i = 0; i < length; i++)
+        {
+            hash ^= static_cast<u8>(key[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    /**
+     * @brief Hashes a null-terminated key, see `JsonKeyHash(const char *, u32)`.
+     */
+    constexpr u32 JsonKeyHash(const char *key)
+    {
+        u32 length = 0;
+        while (key[length] != '\0')
+        {
+            length++;
+        }
+        return JsonKeyHash(key, length);
+    }
+
+    /**
+     * @brief The tokens produced by `JsonReader::Next`.
+     */
+    enum class JsonToken : u8
+    {
+        BEGIN_OBJECT, ///< `{`
+        END_OBJECT,   ///< `}`
+        BEGIN_ARRAY,  ///< `[`
+        END_ARRAY,    ///< `]`
+        KEY,          ///< An object key, the text is available through `GetString`.
+        STRING,       ///< A string value, the decoded text is available through `GetString`.
+        NUMBER,       ///< A number value, read it with `GetValue`.
+        BOOLEAN,      ///< `true` or `false`, read it with `GetValue`.
+        NULL_VALUE,   ///< `null`
+        END,          ///< The whole document has been read.
+        ERROR,        ///< The input is not valid JSON, see `GetError`.
+        COUNT RPP_HIDE,
+    };
+
+    /**
+     * @brief A pull parser which reads a JSON document token by token, either from memory or straight from an open
+     *      file. Only one chunk of the file, the current token and one entry per nesting level are kept in memory,
+     *      so the memory usage does not depend on the size of the document.
+     *
+     * @example
+     * ```cpp
+     * FileHandle file = FileSystem::OpenFile("project.rppproj", FILE_MODE_READ);
+     * JsonReader reader(file);
+     * if (reader.Next() == JsonToken::BEGIN_OBJECT)
+     * {
+     *     while (reader.Next() == JsonToken::KEY)
+     *     {
+     *         if (reader.GetString() == "name") { reader.Read(name); }
+     *         else { reader.Skip(); }
+     *     }
+     * }
+     * FileSystem::CloseFile(file);
+     * ```
+     */
+    class JsonReader
+    {
+    public:
+        /**
+         * @brief Reads the document from a buffer. The buffer must outlive the reader.
+         */
+        explicit JsonReader(StringView content);
+
+        /**
+         * @brief Reads the document from a file opened for reading. The file is read chunk by chunk on demand.
+         */
+        explicit JsonReader(FileHandle file);
+
+        ~JsonReader();
+
+        JsonReader(const JsonReader &) = delete;
+        JsonReader &operator=(const JsonReader &) = delete;
+
+    public:
+        /**
+         * @brief Moves to the next token of the document.
+         *
+         * @return The new current token. After `END` or `ERROR` every call returns the same token again.
+         */
+        JsonToken Next();
+
+        /**
+         * @brief Returns the current token.
+         */
+        inline JsonToken GetToken() const { return m_token; }
+
+        /**
+         * @brief Returns the text of the current KEY or STRING token (escapes already decoded), or the raw text of a
+         *      NUMBER token. The view is invalidated by the next call to `Next`.
+         */
+        inline StringView GetString() const { return m_value; }
+
+        /**
+         * @brief Returns the `JsonKeyHash` of the text of the current token (usually a KEY).
+         */
+        inline u32 GetKeyHash() const { return JsonKeyHash(m_value.Data(), m_value.Length()); }
+
+        /**
+         * @brief Returns the number of containers (objects/arrays) which are currently open.
+         */
+        inline u32 GetDepth() const { return m_containers.Size(); }
+
+        /**
+         * @brief Checks whether the input turned out to be invalid.
+         */
+        inline b8 HasError() const { return m_token == JsonToken::ERROR; }
+
+        /**
+         * @brief Returns the description of the error (empty if there is no error).
+         */
+        inline const String &GetError() const { return m_error; }
+
+        /**
+         * @brief Skips the value which starts at the current token. For BEGIN_OBJECT/BEGIN_ARRAY the whole container is
+         *      skipped, for a KEY its value is skipped, other tokens are already complete.
+         */
+        void Skip();
+
+        /**
+         * @brief Converts the current token into `outValue`. Supports `b8`, the integer and floating point types and
+         *      `String`.
+         *
+         * @return FALSE if the token does not hold a value of that type, `outValue` is not modified then.
+         */
+        template <typename T>
+        b8 GetValue(T &outValue) const
+        {
+            if constexpr (std::is_same_v<T, b8>)
+            {
+                if (m_token != JsonToken::BOOLEAN)
+                {
+                    return FALSE;
+                }
+                outValue = m_value == "true";
+                return TRUE;
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                if (m_token != JsonToken::NUMBER)
+                {
+                    return FALSE;
+                }
+                if (FromChars(m_value, outValue))
+                {
+                    return TRUE;
+                }
+
+                // written with a fraction or an exponent ("1e3"), only an integer value in the range of T is taken
+                f64 number;
+                if (!FromChars(m_value, number) || number != std::trunc(number) ||
+                    !(number >= static_cast<f64>(std::numeric_limits<T>::min()) &&
+                      number < std::ldexp(1.0, std::numeric_limits<T>::digits)))
+                {
+                    return FALSE;
+                }
+                outValue = static_cast<T>(number);
+                return TRUE;
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                return m_token == JsonToken::NUMBER && FromChars(m_value, outValue);
+            }
+            else
+            {
+                static_assert(std::is_same_v<T, String>, "JsonReader::GetValue does not support this type");
+                if (m_token != JsonToken::STRING)
+                {
+                    return FALSE;
+                }
+                outValue = String(m_value.Data(), m_value.Length());
+                return TRUE;
+            }
+        }
+
+        /**
+         * @brief Moves to the next value and converts it into `outValue`. A value of another type is skipped as a whole
+         *      and `outValue` is left untouched.
+         */
+        template <typename T>
+        b8 Read(T &outValue)
+        {
+            Next();
+            if (GetValue(outValue))
+            {
+                return TRUE;
+            }
+            Skip();
+            return FALSE;
+        }
+
+        /**
+         * @brief Moves to the next value, which must be an array, and appends every element to `outValues`. Elements of
+         *      another type are skipped.
+         *
+         * @return FALSE if the value is not an array (it is skipped then).
+         */
+        template <typename T>
+        b8 ReadArray(Array<T> &outValues)
+        {
+            if (Next() != JsonToken::BEGIN_ARRAY)
+            {
+                Skip();
+                return FALSE;
+            }
+
+            while (Next() != JsonToken::END_ARRAY)
+            {
+                if (HasError())
+                {
+                    return FALSE;
+                }
+
+                T value = {};
+                if (GetValue(value))
+                {
+                    outValues.Push(value);
+                }
+                else
+                {
+                    Skip();
+                }
+            }
+            return TRUE;
+        }
+
+    private:
+        enum class State : u8
+        {
+            VALUE,          ///< The root value must follow.
+            VALUE_OR_END,   ///< Right after `[`.
+            KEY_OR_END,     ///< Right after `{`.
+            COMMA_OR_END,   ///< After a value inside a container.
+            COLON,          ///< After a key.
+            DONE,           ///< The root value is complete.
+        };
+
+        i32 peekChar();
+        void skipWhitespace();
+        b8 fillChunk();
+
+        JsonToken readValue();
+        JsonToken readString(JsonToken token);
+        JsonToken readNumber();
+        JsonToken readLiteral();
+        JsonToken beginContainer(JsonToken token);
+        JsonToken endContainer(char closing);
+        JsonToken completeValue(JsonToken token);
+        JsonToken fail(StringView message);
+        void appendText(const char *data, u32 length);
+
+    private:
+        FileHandle m_file;     ///< INVALID_ID when reading from memory.
+        char *m_chunk;         ///< The chunk buffer (file mode only).
+        const char *m_data;    ///< The characters which are currently available.
+        u32 m_length;          ///< The number of available characters.
+        u32 m_position;        ///< The index of the next character inside `m_data`.
+        u32 m_consumed;        ///< The number of characters consumed from the previous chunks (for error messages).
+
+        Array<char> m_containers; ///< '{' or '[' for each open container.
+        State m_state;
+        JsonToken m_token;
+        StringView m_value;  ///< The text of the current token.
+        Array<char> m_text;  ///< Storage for the current token when it can not point into the input.
+        String m_error;
+    };
+
+    /**
+     * @brief Writes a JSON document token by token, either into memory or straight into a file opened for writing. In
+     *      file mode the output is flushed chunk by chunk, so the whole document never has to be in memory.
+     *
+     * @example
+     * ```cpp
+     * JsonWriter writer(file, JsonFormat::PRETTY);
+     * writer.BeginObject();
+     * writer.Key("name");
+     * writer.Value(project.GetName());
+     * writer.EndObject();
+     * writer.Flush();
+     * ```
+     */
+    class JsonWriter
+    {
+    public:
+        /**
+         * @brief Writes into memory, get the result with `Build`.
+         */
+        explicit JsonWriter(JsonFormat format = JsonFormat::COMPACT);
+
+        /**
+         * @brief Writes into a file opened for writing.
+         */
+        explicit JsonWriter(FileHandle file, JsonFormat format = JsonFormat::COMPACT);
+
+        /**
+         * @note In file mode `Flush` must be called before the file is closed.
+         */
+        ~JsonWriter();
+
+        JsonWriter(const JsonWriter &) = delete;
+        JsonWriter &operator=(const JsonWriter &) = delete;
+
+    public:
+        void BeginObject();
+        void EndObject();
+        void BeginArray();
+        void EndArray();
+
+        /**
+         * @brief Writes the key of the next object member.
+         */
+        void Key(StringView key);
+
+        /**
+         * @brief Writes `null`.
+         */
+        void Null();
+
+        /**
+         * @brief Writes a value. Supports `b8`, the integer and floating point types and anything convertible to
+         *      `StringView`.
+         */
+        template <typename T>
+        void Value(const T &value)
+        {
+            beginValue();
+
+            if constexpr (std::is_same_v<T, b8>)
+            {
+                write(value ? StringView("true", 4) : StringView("false", 5));
+            }
+            else if constexpr (std::is_integral_v<T> && std::is_signed_v<T>)
+            {
+                writeSigned(static_cast<i64>(value));
+            }
+            else if constexpr (std::is_integral_v<T>)
+            {
+                writeUnsigned(static_cast<u64>(value));
+            }
+            else if constexpr (std::is_same_v<T, f32>)
+            {
+                writeFloat(value);
+            }
+            else if constexpr (std::is_floating_point_v<T>)
+            {
+                writeFloat(static_cast<f64>(value));
+            }
+            else
+            {
+                static_assert(std::is_convertible_v<const T &, StringView>, "JsonWriter::Value does not support this type");
+                writeString(StringView(value));
+            }
+        }
+
+        /**
+         * @brief Writes every element of the array as a JSON array.
+         */
+        template <typename T>
+        void ValueArray(const Array<T> &values)
+        {
+            BeginArray();
+            u32 count = values.Size();
+            for (u32 i = 0; i < count; i++)
+            {
+                Value(values[i]);
+            }
+            EndArray();
+        }
+
+        /**
+         * @brief Copies the value which starts at the current token of the reader (a whole container for
+         *      BEGIN_OBJECT/BEGIN_ARRAY). The reader is left on the last token of the value.
+         */
+        void Copy(JsonReader &reader);
+
+        /**
+         * @brief Writes the buffered output into the file (file mode only).
+         */
+        void Flush();
+
+        /**
+         * @brief Moves the written document out (memory mode only). The writer is empty afterwards.
+         */
+        String Build();
+
+    private:
+        void beginValue();
+        void beginContainer(char opening);
+        void endContainer(char closing);
+        void writeNewline();
+        void writeSigned(i64 value);
+        void writeUnsigned(u64 value);
+        void writeFloat(f32 value);
+        void writeFloat(f64 value);
+        void writeString(StringView value);
+        void write(StringView value);
+        void write(char value);
+
+    private:
+        FileHandle m_file; ///< INVALID_ID when writing into memory.
+        u32 m_indent;      ///< The number of spaces per nesting level, 0 for the compact format.
+        StringBuilder m_builder; ///< The output in memory mode, the pending chunk in file mode.
+
+        Array<u32> m_counts; ///< The number of members/elements written in each open container.
+        b8 m_afterKey;       ///< TRUE if the next value belongs to the key just written.
+    };
+
+    /**
+     * @brief Appends records to a JSON Lines file (one compact document per line), opened with `FILE_MODE_APPEND`. A
+     *      record only costs its own size whatever the size of the file, and each record is flushed as a whole, so a
+     *      crash loses at most the record being written.
+     *
+     * @example
+     * ```cpp
+     * FileHandle file = FileSystem::OpenFile("results.jsonl", FILE_MODE_APPEND);
+     * JsonLinesWriter results(file);
+     * JsonWriter &record = results.BeginRecord();
+     * record.BeginObject();
+     * record.Key("name");
+     * record.Value(testName);
+     * record.EndObject();
+     * results.EndRecord();
+     * FileSystem::CloseFile(file);
+     * ```
+     */
+    class JsonLinesWriter
+    {
+    public:
+        explicit JsonLinesWriter(FileHandle file);
+
+        JsonLinesWriter(const JsonLinesWriter &) = delete;
+        JsonLinesWriter &operator=(const JsonLinesWriter &) = delete;
+
+    public:
+        /**
+         * @brief Starts a record. Exactly one value (usually an object) must be written into the returned writer before
+         *      `EndRecord` is called.
+         */
+        JsonWriter &BeginRecord();
+
+        /**
+         * @brief Appends the record started with `BeginRecord` to the file.
+         */
+        void EndRecord();
+
+        /**
+         * @brief Appends a value as one record (see `WriteJson`).
+         */
+        template <typename T>
+        void Append(const T &value);
+
+    private:
+        FileHandle m_file;
+        JsonWriter m_record; ///< The compact record being written.
+        b8 m_inRecord;
+    };
+
+    /**
+     * @brief Writes a value as JSON through the writer. Autogen generates the specializations for the structs annotated
+     *      with `RPP_JSON` (fields annotated with `RPP_JSON_KEY`).
+     */
+    template <typename T>
+    void WriteJson(JsonWriter &writer, const T &value);
+
+    /**
+     * @brief Reads the next value of the reader into `outValue`. Autogen generates the specializations for the structs
+     *      annotated with `RPP_JSON`: missing keys keep the current value and unknown keys are skipped.
+     *
+     * @return FALSE if the value is not an object or the input is invalid.
+     */
+    template <typename T>
+    b8 ReadJson(JsonReader &reader, T &outValue);
+
+    template <typename T>
+    void JsonLinesWriter::Append(const T &value)
+    {
+        WriteJson(BeginRecord(), value);
+        EndRecord();
+    }
+} // namespace rpp
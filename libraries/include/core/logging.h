@@ -5,6 +5,8 @@
 #include "containers/array.h"
 #include "format.h"
 
+#define RPP_LOG_BUFFER_SIZE 1024
+
 namespace rpp
 {
     /**
@@ -25,12 +27,15 @@ namespace rpp
     /**
      * @brief an object which stores all needed information for a single log entry. This object must be handled
      *      by the handler of the logging system.
+     *
+     * @note The message and file only view the caller's buffers, they are valid during `Handler::HandleImpl` only.
+     *      Copy them into a String if the record must be kept.
      */
     struct LogRecord
     {
-        LogLevel level; ///< The severity level of the log message.
-        String message; ///< The log message to be recorded.
-        String file;    ///< The name of the source file where the log message originated.
+        LogLevel level;     ///< The severity level of the log message.
+        StringView message; ///< The log message to be recorded.
+        StringView file;    ///< The name of the source file where the log message originated.
         u32 line;       ///< The line number in the source file where the log message originated.
         u64 timestamp;  ///< The timestamp when the log message was created.
         u32 threadId;   ///< The ID of the thread that generated the log message.
@@ -65,7 +70,7 @@ namespace rpp
         void Handle(const LogRecord &record);
 
         inline LogLevel GetLevel() const { return m_level; }
-        inline void SetLevel(LogLevel level) { m_level = level; }
+        void SetLevel(LogLevel level);
 
     protected:
         /**
@@ -109,7 +114,46 @@ namespace rpp
          * @param file The name of the source file where the log message originated.
          * @param line The line number in the source file where the log message originated.
          */
-        void Log(LogLevel level, const String &message, const String &file, i32 line);
+        void Log(LogLevel level, StringView message, StringView file, i32 line);
+
+        /**
+         * @brief Formats the message into a thread-local buffer and logs it. Used by the `RPP_LOG_*` macros, which
+         *      check `IsEnabled` first so that disabled levels never format their arguments.
+         *
+         * @note Messages longer than RPP_LOG_BUFFER_SIZE fall back to a heap allocated String.
+         */
+        template <typename... Args>
+        void LogFormat(LogLevel level, StringView file, i32 line, StringView formatMessage, const Args &...args)
+        {
+            ThreadBuffer buffer;
+            if (buffer.Get() == nullptr)
+            {
+                // logged while formatting or handling another message, which still uses the buffer
+                Log(level, Format(formatMessage, args...), file, line);
+                return;
+            }
+
+            u32 length = FormatTo(buffer.Get(), RPP_LOG_BUFFER_SIZE, formatMessage, args...);
+            if (length < RPP_LOG_BUFFER_SIZE)
+            {
+                Log(level, StringView(buffer.Get(), length), file, line);
+            }
+            else
+            {
+                Log(level, Format(formatMessage, args...), file, line);
+            }
+        }
+
+        /**
+         * @brief Checks whether at least one handler processes the given level. Costs a single comparison.
+         */
+        static inline b8 IsEnabled(LogLevel level) { return level >= s_minLevel; }
+
+        /**
+         * @brief Recomputes the lowest level among the handlers. Called automatically when a handler is added or
+         *      its level changes.
+         */
+        void RefreshMinLevel();
 
         /**
          * @brief Set up a new handler for processing log records. The logging system takes ownership of the handler.
@@ -117,24 +161,54 @@ namespace rpp
          */
         void SetupHandler(Scope<Handler> &&handler);
 
+    private:
+        /**
+         * Lends the formatting buffer (RPP_LOG_BUFFER_SIZE bytes) of the calling thread for one message. A nested log
+         * call, from a `ToString` or a handler, finds it taken and gets nullptr.
+         */
+        class ThreadBuffer
+        {
+        public:
+            ThreadBuffer();
+            ~ThreadBuffer();
+
+            ThreadBuffer(const ThreadBuffer &) = delete;
+            ThreadBuffer &operator=(const ThreadBuffer &) = delete;
+
+            inline char *Get() const { return m_buffer; }
+
+        private:
+            char *m_buffer; ///< nullptr if an outer log call of the thread already holds the buffer.
+        };
+
     private:
         Array<Scope<Handler>> m_handlers; ///< Array of handlers to process log records.
+        static LogLevel s_minLevel;       ///< The lowest level among the handlers, COUNT when there is no handler.
     };
 } // namespace rpp
 
 #if !defined(RPP_LIBRARIES_TEST)
+#define RPP_LOG_AT_LEVEL(level, msg, ...)                                                              \
+    do                                                                                                 \
+    {                                                                                                  \
+        if (rpp::Logging::IsEnabled(level))                                                            \
+        {                                                                                              \
+            rpp::Logging::GetInstance()->LogFormat(level, __FILE__, __LINE__, msg, ##__VA_ARGS__); \
+        }                                                                                              \
+    } while (0)
+
 #if defined(RPP_DEBUG)
-#define RPP_LOG_TRACE(msg, ...) rpp::Logging::GetInstance()->Log(rpp::LogLevel::TRACE, Format(msg, ##__VA_ARGS__), __FILE__, __LINE__)
-#define RPP_LOG_DEBUG(msg, ...) rpp::Logging::GetInstance()->Log(rpp::LogLevel::DEBUG, Format(msg, ##__VA_ARGS__), __FILE__, __LINE__)
+#define RPP_LOG_TRACE(msg, ...) RPP_LOG_AT_LEVEL(rpp::LogLevel::TRACE, msg, ##__VA_ARGS__)
+#define RPP_LOG_DEBUG(msg, ...) RPP_LOG_AT_LEVEL(rpp::LogLevel::DEBUG, msg, ##__VA_ARGS__)
 #else
 #define RPP_LOG_TRACE(msg, ...)
 #define RPP_LOG_DEBUG(msg, ...)
 #endif
 
-#define RPP_LOG_INFO(msg, ...) rpp::Logging::GetInstance()->Log(rpp::LogLevel::INFO, Format(msg, ##__VA_ARGS__), __FILE__, __LINE__)
-#define RPP_LOG_WARNING(msg, ...) rpp::Logging::GetInstance()->Log(rpp::LogLevel::WARNING, Format(msg, ##__VA_ARGS__), __FILE__, __LINE__)
-#define RPP_LOG_ERROR(msg, ...) rpp::Logging::GetInstance()->Log(rpp::LogLevel::ERROR, Format(msg, ##__VA_ARGS__), __FILE__, __LINE__)
-#define RPP_LOG_FATAL(msg, ...) rpp::Logging::GetInstance()->Log(rpp::LogLevel::FATAL, Format(msg, ##__VA_ARGS__), __FILE__, __LINE__)
+#define RPP_LOG_INFO(msg, ...) RPP_LOG_AT_LEVEL(rpp::LogLevel::INFO, msg, ##__VA_ARGS__)
+#define RPP_LOG_WARNING(msg, ...) RPP_LOG_AT_LEVEL(rpp::LogLevel::WARNING, msg, ##__VA_ARGS__)
+#define RPP_LOG_ERROR(msg, ...) RPP_LOG_AT_LEVEL(rpp::LogLevel::ERROR, msg, ##__VA_ARGS__)
+#define RPP_LOG_FATAL(msg, ...) RPP_LOG_AT_LEVEL(rpp::LogLevel::FATAL, msg, ##__VA_ARGS__)
 #else
 #define RPP_LOG_TRACE(msg, ...)
 #define RPP_LOG_DEBUG(msg, ...)
@@ -0,0 +1,115 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "string.h"
+#include "string_view.h"
+
+namespace rpp
+{
+    /**
+     * @brief A file or directory path, normalized once at construction: the separators are forward slashes, the
+     *      repeated separators, the trailing separator and the "." parts are dropped, and the ".." parts are folded
+     *      into their parent when there is one. The hash is computed once too, so the paths are cheap to compare and
+     *      to use as cache keys.
+     *
+     * @example
+     * ```cpp
+     * Path path("assets\\textures/./robot.png");
+     * path.GetString();    // "assets/textures/robot.png"
+     * path.GetParent();    // "assets/textures"
+     * path.GetExtension(); // ".png"
+     * ```
+     *
+     * @note The path is not resolved against the filesystem (no symbolic links, no current directory).
+     */
+    class Path
+    {
+    public:
+        /**
+         * @brief Default constructor for an empty path.
+         */
+        Path();
+
+        Path(const char *path);
+        Path(StringView path);
+        Path(const String &path);
+
+    public:
+        /**
+         * @brief Get the normalized path.
+         */
+        inline const String &GetString() const { return m_path; }
+
+        /**
+         * @brief Get the normalized path as a null-terminated string.
+         */
+        inline const char *CStr() const { return m_path.CStr(); }
+
+        /**
+         * @brief Get the length of the normalized path.
+         */
+        inline u32 Length() const { return m_path.Length(); }
+
+        /**
+         * @brief Check if the path is empty.
+         */
+        inline b8 Empty() const { return m_path.Length() == 0; }
+
+        /**
+         * @brief Get the hash of the normalized path, see `Path::Hash`.
+         */
+        inline u32 GetHash() const { return m_hash; }
+
+        inline operator StringView() const { return StringView(m_path.CStr(), m_path.Length()); }
+
+        /**
+         * @brief Check if the path starts from a root ("/") or a drive ("C:").
+         */
+        b8 IsAbsolute() const;
+
+        /**
+         * @brief Get the last part of the path ("robot.png" for "assets/robot.png"). The view is valid as long as the
+         *      path is.
+         */
+        StringView GetFileName() const;
+
+        /**
+         * @brief Get the extension of the last part, with its dot (".png"), empty if the last part has none.
+         */
+        StringView GetExtension() const;
+
+        /**
+         * @brief Get the path without its last part, empty for a relative path of a single part. The parent of a root
+         *      is the root itself.
+         */
+        Path GetParent() const;
+
+        /**
+         * @brief Appends a relative path. The result is normalized, so ".." parts climb up from this path.
+         */
+        Path Join(StringView relativePath) const;
+
+        inline Path operator/(StringView relativePath) const { return Join(relativePath); }
+
+        inline b8 operator==(const Path &other) const { return m_hash == other.m_hash && m_path == other.m_path; }
+        inline b8 operator!=(const Path &other) const { return !(*this == other); }
+
+    public:
+        /**
+         * @brief Hashes the characters of a path (FNV-1a), without normalizing them. `Path::GetHash` returns the hash
+         *      of the normalized path.
+         */
+        static u32 Hash(StringView path);
+
+    private:
+        /**
+         * @brief Builds a path which is already normalized (a part of a normalized path).
+         */
+        static Path fromNormalized(StringView path);
+
+        void normalize(StringView path);
+
+    private:
+        String m_path; ///< The normalized path.
+        u32 m_hash;    ///< The hash of `m_path`.
+    };
+} // namespace rpp
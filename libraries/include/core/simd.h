@@ -0,0 +1,72 @@
+#pragma once
+#include "core/common.h"
+#include "platforms/platforms.h"
+
+namespace rpp
+{
+    /**
+     * @brief The instruction sets which the string kernels can use. Ordered from the slowest to the fastest.
+     */
+    enum class SimdLevel : u8
+    {
+        SCALAR, ///< Plain C++ (also used on non-x86 platforms).
+        SSE2,   ///< 16 bytes per step, available on every x86-64 CPU (including the Atom based controllers).
+        AVX2,   ///< 32 bytes per step.
+        COUNT RPP_HIDE,
+    };
+
+    /**
+     * @brief Vectorized kernels for the hot string operations (search, case folding, line splitting). The best
+     *      instruction set is detected once at runtime, so the same binary runs on CPUs without AVX2.
+     *
+     * @example
+     * ```cpp
+     * const char *newline = Simd::FindChar(data, length, '\n');
+     * Simd::ToLower(buffer, buffer, length); // in place
+     * ```
+     */
+    class Simd
+    {
+    public:
+        /**
+         * @brief Returns the instruction set used by the kernels.
+         */
+        static SimdLevel GetLevel();
+
+        /**
+         * @brief Returns the best instruction set supported by the running CPU.
+         */
+        static SimdLevel GetSupportedLevel();
+
+        /**
+         * @brief Forces the kernels to use a lower instruction set (mostly for testing and benchmarking). The level is
+         *      clamped to the supported one.
+         */
+        static void SetLevel(SimdLevel level);
+
+    public:
+        /**
+         * @brief Finds the first occurrence of a character.
+         *
+         * @return The pointer to the character inside `data` or nullptr if not found.
+         */
+        static const char *FindChar(const char *data, u32 length, char character);
+
+        /**
+         * @brief Finds the first occurrence of `needle` inside `haystack`.
+         *
+         * @return The index of the first occurrence, or -1 if not found. An empty needle is found at 0.
+         */
+        static i32 Find(const char *haystack, u32 haystackLength, const char *needle, u32 needleLength);
+
+        /**
+         * @brief Converts the ASCII letters to lowercase. `destination` may be the same as `source`.
+         */
+        static void ToLower(char *destination, const char *source, u32 length);
+
+        /**
+         * @brief Converts the ASCII letters to uppercase. `destination` may be the same as `source`.
+         */
+        static void ToUpper(char *destination, const char *source, u32 length);
+    };
+} // namespace rpp
@@ -3,6 +3,7 @@
 #include "platforms/platforms.h"
 #include "containers/array.h"
 #include "string.h"
+#include "string_id.h"
 
 namespace rpp
 {
@@ -15,7 +16,7 @@ namespace rpp
 
     struct SingletonEntry
     {
-        String name;                      ///< Name of the singleton object.
+        StringId name;                    ///< Interned name of the singleton object.
         void *instance;                   ///< Pointer to the singleton object instance.
         SingletonDestroyFunc destroyFunc; ///< Function to destroy the singleton object.
     };
@@ -54,7 +55,7 @@ namespace rpp
          * @param instance Pointer to the singleton object instance.
          * @param destroyFunc Function to destroy the singleton object.
          */
-        static void RegisterSingleton(const String &name, void *instance, SingletonDestroyFunc destroyFunc);
+        static void RegisterSingleton(StringView name, void *instance, SingletonDestroyFunc destroyFunc);
 
     private:
         static Scope<Array<SingletonEntry>> s_singletonEntries; ///< Array of all registered singleton objects.
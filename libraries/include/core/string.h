@@ -1,11 +1,19 @@
 #pragma once
 #include "platforms/platforms.h"
 #include "containers/array.h"
+#include "string_view.h"
+
+/**
+ * The number of characters (without the null terminator) which can be stored inside the `String` object itself
+ * without any heap allocation (small string optimization).
+ */
+#define RPP_STRING_SSO_CAPACITY 22
 
 namespace rpp
 {
     /**
-     * @brief A simple wrapper around C-style strings.
+     * @brief A simple wrapper around C-style strings. The length and the capacity are cached, and short strings
+     *      (up to `RPP_STRING_SSO_CAPACITY` characters) are stored inline without any heap allocation.
      */
     class String
     {
@@ -22,11 +30,22 @@ namespace rpp
          */
         String(const char *str);
 
+        /**
+         * @brief Constructs a String from the first `length` characters of a character buffer.
+         *
+         * @param str The character buffer to copy from (does not need to be null-terminated).
+         * @param length The number of characters to copy.
+         */
+        String(const char *str, u32 length);
+
         /**
          * @brief Copy constructor.
          */
         String(const String &other);
 
+        /**
+         * @brief Move constructor. The heap buffer (if any) is stolen, the other string becomes empty.
+         */
         String(String &&other) noexcept;
 
         ~String();
@@ -37,12 +56,30 @@ namespace rpp
          *
          * @return The length of the string.
          */
-        u32 Length() const;
+        inline u32 Length() const { return m_length; }
+
+        /**
+         * @brief Returns the number of characters which can be stored without reallocation.
+         */
+        inline u32 Capacity() const { return m_capacity; }
+
+        /**
+         * @brief Makes sure the string can hold at least `capacity` characters (without the null terminator) without reallocation.
+         *      The current content is kept. Does nothing if the current capacity is already large enough.
+         *
+         * @param capacity The minimum number of characters the string should be able to hold.
+         */
+        void Reserve(u32 capacity);
 
         /**
          * @brief Returns the underlying C-style string.
          */
-        const char *CStr() const;
+        inline const char *CStr() const { return m_data; }
+
+        /**
+         * @brief Returns a non-owning view over the whole string. The view is invalidated when the string is modified.
+         */
+        inline operator StringView() const { return StringView(m_data, m_length); }
 
         // operator
     public:
@@ -56,25 +93,30 @@ namespace rpp
          */
         void operator=(const String &other);
 
+        /**
+         * @brief Move assignment operator. The heap buffer (if any) is stolen, the other string becomes empty.
+         */
+        void operator=(String &&other) noexcept;
+
         /**
          * @brief Concatenation operator. Returns a new String that is the concatenation of this string and another.
          */
-        String operator+(const String &other);
+        String operator+(StringView other);
 
         /**
-         * @brief Concatenation operator with C-style string. Returns a new String that is the concatenation of this string and the C-style string.
+         * @brief Appends another string in place. The capacity grows geometrically, so repeated appends are amortized O(1) per character.
          */
-        void operator+=(const String &other);
+        void operator+=(StringView other);
 
         /**
          * @brief Equality operator. Compares this string with another for equality.
          */
-        b8 operator==(const String &other) const;
+        b8 operator==(StringView other) const;
 
         /**
          * @brief Inequality operator. Compares this string with another for inequality.
          */
-        inline b8 operator!=(const String &other) const { return !(*this == other); }
+        inline b8 operator!=(StringView other) const { return !(*this == other); }
 
     public:
         /**
@@ -85,7 +127,7 @@ namespace rpp
          *
          * @return The index of the first occurrence of the substring, or -1 if not found.
          */
-        i32 Find(const String &substr, u32 startIndex = 0) const;
+        i32 Find(StringView substr, u32 startIndex = 0) const;
 
         /**
          * @brief Extracts a substring from the string.
@@ -106,7 +148,7 @@ namespace rpp
          *
          * @return TRUE if at least one replacement was made, FALSE otherwise.
          */
-        String Replace(const String &oldSubstr, const String &newSubstr, b8 replaceAll = FALSE);
+        String Replace(StringView oldSubstr, StringView newSubstr, b8 replaceAll = FALSE);
 
         /**
          * @brief Concatenates this string with another string and returns the result as a new String object.
@@ -114,21 +156,35 @@ namespace rpp
          * @param other The string to concatenate with.
          * @return A new String object containing the concatenated result.
          */
-        String Concat(const String &other) const;
+        String Concat(StringView other) const;
 
         /**
          * Split the string into an array of substrings based on a delimiter.
          * @param delimiter The delimiter string to split by.
          * @param outParts The array to store the resulting substrings.
          */
-        void Split(Array<String> &outParts, const String &delimiter) const;
+        void Split(Array<String> &outParts, StringView delimiter) const;
+
+        /**
+         * Split the string into an array of views based on a delimiter, without allocating any string.
+         * @param delimiter The delimiter string to split by.
+         * @param outParts The array to store the resulting views (pointing into this string).
+         */
+        void Split(Array<StringView> &outParts, StringView delimiter) const;
+
+        /**
+         * @brief Checks if the string starts with the specified prefix.
+         * @param prefix The prefix to check.
+         * @return TRUE if the string starts with the prefix, FALSE otherwise.
+         */
+        b8 StartsWith(StringView prefix) const;
 
         /**
          * @brief Checks if the string ends with the specified suffix.
          * @param suffix The suffix to check.
          * @return TRUE if the string ends with the suffix, FALSE otherwise.
          */
-        b8 EndsWith(const String &suffix) const;
+        b8 EndsWith(StringView suffix) const;
 
         /**
          * @brief Converts the string to lowercase.
@@ -137,16 +193,41 @@ namespace rpp
          */
         String ToLowerCase() const;
 
+        /**
+         * @brief Converts the string to uppercase.
+         * @return A new String object containing the uppercase version of the string.
+         * @note This function does not modify the original string. Only ASCII letters are converted.
+         */
+        String ToUpperCase() const;
+
         /**
          * @brief Joins an array of strings into a single string with a specified delimiter.
          * @param parts The array of strings to join.
          * @param delimiter The delimiter to insert between each string.
          * @return A new String object containing the joined result.
          */
-        static String Join(const Array<String> &parts, const String &delimiter);
+        static String Join(const Array<String> &parts, StringView delimiter);
+
+    private:
+        friend class StringBuilder; ///< formats straight into the spare capacity of its buffer
+
+        /**
+         * Replaces the current content with the first `length` characters of `str`.
+         */
+        void assign(const char *str, u32 length);
+
+        /**
+         * Releases the heap buffer (if any) and resets the string to the empty inline state.
+         */
+        void release();
+
+        inline b8 isInline() const { return m_data == m_inlineData; }
 
     private:
-        char *m_data;
+        char *m_data;                                  ///< Points to either `m_inlineData` or a heap buffer, always null-terminated.
+        u32 m_length;                                  ///< The number of characters (without the null terminator).
+        u32 m_capacity;                                ///< The number of characters which can be stored without reallocation.
+        char m_inlineData[RPP_STRING_SSO_CAPACITY + 1]; ///< Inline storage for short strings.
     };
 
     /**
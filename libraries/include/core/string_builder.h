@@ -0,0 +1,90 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "string.h"
+#include "format.h"
+
+namespace rpp
+{
+    /**
+     * @brief Accumulates string pieces into one growing buffer. Prefer it over chains of `String + String` when
+     *      building long text (log lines, serialized data, reports) since each piece is copied exactly once.
+     *
+     * @example
+     * ```cpp
+     * StringBuilder builder;
+     * builder.Reserve(64);
+     * builder.Append("Hello, ");
+     * builder.AppendFormat("{} ({})", name, age);
+     * String result = builder.Build(); // the builder is empty afterwards
+     * ```
+     */
+    class StringBuilder
+    {
+    public:
+        StringBuilder();
+        ~StringBuilder();
+
+    public:
+        /**
+         * @brief Makes sure the builder can hold at least `capacity` characters without reallocation.
+         */
+        void Reserve(u32 capacity);
+
+        /**
+         * @brief Appends a sequence of characters to the end of the buffer.
+         */
+        StringBuilder &Append(StringView value);
+
+        /**
+         * @brief Appends a single character to the end of the buffer.
+         */
+        StringBuilder &Append(char value);
+
+        /**
+         * @brief Appends the formatted message to the end of the buffer. Uses the same placeholders as `Format`, the
+         *      output is written straight into the buffer (no temporary String).
+         */
+        template <typename... Args>
+        StringBuilder &AppendFormat(StringView formatMessage, const Args &...args)
+        {
+            const details::FormatArgument arguments[] = {{&args, &details::WriteFormatArgument<Args>}..., {nullptr, nullptr}};
+            return appendFormat(formatMessage, arguments, sizeof...(Args));
+        }
+
+        /**
+         * @brief Removes all the content and releases the buffer.
+         */
+        void Clear();
+
+        /**
+         * @brief Removes all the content but keeps the buffer, for a builder which is filled again right away.
+         */
+        void Reset();
+
+        /**
+         * @brief Returns the number of characters appended so far.
+         */
+        inline u32 Length() const { return m_buffer.Length(); }
+
+        /**
+         * @brief Returns the number of characters the buffer can hold without reallocation.
+         */
+        inline u32 Capacity() const { return m_buffer.Capacity(); }
+
+        /**
+         * @brief Returns a view over the current content. The view is invalidated by the next append.
+         */
+        inline StringView View() const { return m_buffer; }
+
+        /**
+         * @brief Moves the accumulated content out as a String. The builder is empty afterwards.
+         */
+        String Build();
+
+    private:
+        StringBuilder &appendFormat(StringView formatMessage, const details::FormatArgument *arguments, u32 argumentCount);
+
+    private:
+        String m_buffer;
+    };
+} // namespace rpp
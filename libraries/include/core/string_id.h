@@ -0,0 +1,67 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "string_view.h"
+
+namespace rpp
+{
+    /**
+     * @brief The handle of a string stored in the `StringPool`. Two ids are equal if and only if their strings are
+     *      equal, so names can be compared and used as map keys with integer operations.
+     */
+    struct StringId
+    {
+        u32 hash;  ///< The hash of the string content.
+        u32 index; ///< The position of the string inside the pool, `u32(-1)` for an invalid id.
+
+        inline b8 IsValid() const { return index != u32(-1); }
+
+        inline b8 operator==(StringId other) const { return index == other.index; }
+        inline b8 operator!=(StringId other) const { return index != other.index; }
+        inline b8 operator<(StringId other) const { return index < other.index; }
+    };
+
+    /**
+     * @brief The id returned when a string cannot be found in the pool.
+     */
+    constexpr StringId INVALID_STRING_ID = {0, u32(-1)};
+
+    /**
+     * @brief Global, thread-safe table of interned strings. Each distinct string is stored once and gets a stable
+     *      `StringId`, which can be resolved back to the characters at any time.
+     *
+     * @note Interned strings are never released, only intern names and keys (not user content) to keep the pool small.
+     *      The pool lives outside the tracked allocations for the same reason, so it does not need to be initialized
+     *      or shut down.
+     *
+     * @example
+     * ```cpp
+     * StringId id = StringPool::Intern("uTranslate");
+     * id == StringPool::Intern(String("uTranslate")); // TRUE, an integer compare
+     * StringPool::Resolve(id);                       // "uTranslate"
+     * ```
+     */
+    class StringPool
+    {
+    public:
+        /**
+         * @brief Returns the id of the string, adding it to the pool at the first call.
+         */
+        static StringId Intern(StringView value);
+
+        /**
+         * @brief Returns the id of the string if it is already in the pool, otherwise `INVALID_STRING_ID`. Never adds.
+         */
+        static StringId Find(StringView value);
+
+        /**
+         * @brief Returns the characters of an interned string. The view stays valid until the program exits and
+         *      is null-terminated.
+         */
+        static StringView Resolve(StringId id);
+
+        /**
+         * @brief Returns the number of distinct strings in the pool.
+         */
+        static u32 Count();
+    };
+} // namespace rpp
@@ -0,0 +1,128 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "containers/array.h"
+
+namespace rpp
+{
+    /**
+     * @brief A non-owning view (pointer + length) into a character buffer. Used for searching, comparing and
+     *      tokenizing strings without any allocation.
+     *
+     * @note The viewed buffer must outlive the view, and the data is NOT guaranteed to be null-terminated.
+     *
+     * @example
+     * ```cpp
+     * String path = "folder/subfolder/file.txt";
+     * Array<StringView> parts;
+     * StringView(path).Split(parts, "/"); // parts point into `path`, no string is allocated
+     * ```
+     */
+    class StringView
+    {
+    public:
+        /**
+         * @brief Default constructor. Initializes an empty view.
+         */
+        StringView();
+
+        /**
+         * @brief Constructs a view over a null-terminated C-style string.
+         *
+         * @param str The C-style string to view. If nullptr, the view is empty.
+         */
+        StringView(const char *str);
+
+        /**
+         * @brief Constructs a view over the first `length` characters of a buffer.
+         *
+         * @param str The buffer to view.
+         * @param length The number of characters in the view.
+         */
+        StringView(const char *str, u32 length);
+
+    public:
+        /**
+         * @brief Returns the pointer to the first character of the view (not null-terminated).
+         */
+        inline const char *Data() const { return m_data; }
+
+        /**
+         * @brief Returns the number of characters in the view.
+         */
+        inline u32 Length() const { return m_length; }
+
+        /**
+         * @brief Checks whether the view contains no character.
+         */
+        inline b8 Empty() const { return m_length == 0; }
+
+        // operator
+    public:
+        /**
+         * @brief Accesses the character at the specified index. Throws std::out_of_range if index is invalid.
+         */
+        char operator[](u32 index) const;
+
+        /**
+         * @brief Equality operator. Compares the characters of both views.
+         */
+        b8 operator==(StringView other) const;
+
+        /**
+         * @brief Inequality operator. Compares the characters of both views.
+         */
+        inline b8 operator!=(StringView other) const { return !(*this == other); }
+
+    public:
+        /**
+         * @brief Finds the first occurrence of a substring within the view, starting from an optional index.
+         *
+         * @param substr The substring to search for.
+         * @param startIndex The index to start the search from. Default is 0.
+         *
+         * @return The index of the first occurrence of the substring, or -1 if not found.
+         */
+        i32 Find(StringView substr, u32 startIndex = 0) const;
+
+        /**
+         * @brief Finds the first occurrence of a character within the view, starting from an optional index.
+         *
+         * @param character The character to search for.
+         * @param startIndex The index to start the search from. Default is 0.
+         *
+         * @return The index of the first occurrence of the character, or -1 if not found.
+         */
+        i32 Find(char character, u32 startIndex = 0) const;
+
+        /**
+         * @brief Returns a view over a part of this view.
+         * @param startIndex The starting index of the sub view.
+         * @param length The length of the sub view. If -1, extends to the end of the view.
+         *
+         * @note Same clamping rules as `String::SubString`.
+         */
+        StringView SubView(u32 startIndex, i32 length = -1) const;
+
+        /**
+         * @brief Checks if the view starts with the specified prefix.
+         */
+        b8 StartsWith(StringView prefix) const;
+
+        /**
+         * @brief Checks if the view ends with the specified suffix.
+         */
+        b8 EndsWith(StringView suffix) const;
+
+        /**
+         * Split the view into an array of sub views based on a delimiter. The resulting views point into the
+         * same buffer as this view.
+         * @param outParts The array to store the resulting views (appended, not cleared).
+         * @param delimiter The delimiter to split by.
+         */
+        void Split(Array<StringView> &outParts, StringView delimiter) const;
+
+    private:
+        const char *m_data; ///< The first character of the view.
+        u32 m_length;       ///< The number of characters in the view.
+    };
+} // namespace rpp
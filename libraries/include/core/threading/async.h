@@ -0,0 +1,81 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "thread.h"
+#include "signal.h"
+#include <functional>
+
+namespace rpp
+{
+    /**
+     * @brief The work executed on the worker thread. It must not touch the objects owned by the main thread (the
+     *      renderers, the ImGui state, the structures being edited), only copies of what it needs.
+     */
+    typedef std::function<void()> AsyncWork;
+
+    /**
+     * @brief Executed on the main thread by `Async::ProcessCompletions` once the work is done.
+     */
+    typedef std::function<void()> AsyncCompletion;
+
+    /**
+     * Runs slow jobs (file I/O, parsing) on a single worker `Thread`, in submission order, and hands their completion
+     * back to the main thread: `GraphicSessionManager::Update` calls `ProcessCompletions` every frame.
+     *
+     * @example
+     * ```cpp
+     * auto pResult = CreateRef<String>();
+     * Async::Run([pResult]() { *pResult = LoadSomething(); },
+     *            [pResult]() { Use(*pResult); });
+     * ```
+     *
+     * @note `Thread` and `Signal` must be initialized before `Initialize` and shut down after `Shutdown`.
+     */
+    class Async
+    {
+    public:
+        /**
+         * @brief Starts the worker thread.
+         */
+        static void Initialize();
+
+        /**
+         * @brief Waits for the queued work then stops the worker thread. The completions which were not processed yet
+         *      are dropped (their results are released without being used).
+         */
+        static void Shutdown();
+
+    public:
+        /**
+         * @brief Queues the work for the worker thread, and the completion for the main thread once the work is done.
+         *
+         * @param work Executed on the worker thread.
+         * @param completion Executed on the main thread by `ProcessCompletions`. Can be nullptr.
+         */
+        static void Run(AsyncWork work, AsyncCompletion completion = nullptr);
+
+        /**
+         * @brief Executes the completions of the finished work, on the calling thread (the main thread). Does nothing
+         *      if `Initialize` has not been called.
+         *
+         * @return The number of executed completions.
+         */
+        static u32 ProcessCompletions();
+
+        /**
+         * @brief Blocks the calling thread until all the queued work is done (its completions are still left to
+         *      `ProcessCompletions`).
+         *
+         * @param timeout The maximum time to wait in milliseconds. A value of ``INFINITE_WAIT`` means to wait indefinitely.
+         * @return TRUE if everything is done, FALSE if the timeout expired.
+         */
+        static b8 WaitIdle(u32 timeout = INFINITE_WAIT);
+
+        /**
+         * @brief The number of jobs whose completion has not been executed yet (queued, running or finished).
+         */
+        static u32 GetPendingCount();
+
+    private:
+        static void workerEntry(void *pParam);
+    };
+} // namespace rpp
@@ -0,0 +1,122 @@
+#pragma once
+#include "platforms/platforms.h"
+#include "core/containers/array.h"
+#include "core/string.h"
+#include "thread.h"
+#include "signal.h"
+#include <functional>
+
+/// The number of worker threads started by `IOQueue::Initialize` when none is given.
+#define RPP_IO_QUEUE_DEFAULT_WORKER_COUNT 4
+
+namespace rpp
+{
+    /**
+     * @brief The outcome of one read of the `IOQueue`.
+     */
+    struct FileReadResult
+    {
+        String filePath;
+        b8 success;      ///< FALSE if the file could not be opened or read, `bytes` is empty then.
+        Array<u8> bytes; ///< The exact content of the file.
+    };
+
+    /**
+     * @brief Executed on the main thread by `IOQueue::ProcessCompletions` once the file is read. The bytes can be moved
+     *      out of the result.
+     */
+    typedef std::function<void(FileReadResult &result)> FileReadCallback;
+
+    /**
+     * @brief Executed on the main thread by `IOQueue::ProcessCompletions` once every file of the batch is read. The
+     *      results are in the order of the requested paths.
+     */
+    typedef std::function<void(Array<FileReadResult> &results)> FileBatchReadCallback;
+
+    /**
+     * @brief Executed on the main thread by `IOQueue::ProcessCompletions` once the file is written.
+     */
+    typedef std::function<void(b8 success)> FileWriteCallback;
+
+    /**
+     * Reads and writes whole files on a pool of worker `Thread`s, so that many small files (textures, function files)
+     * are fetched concurrently instead of one after the other, which hides most of the latency of a network-mounted
+     * project directory. The callbacks are handed back to the main thread like the ones of `Async`:
+     * `GraphicSessionManager::Update` calls `ProcessCompletions` every frame.
+     *
+     * The requests on the same path are executed in submission order (a read queued after a write sees the written
+     * content), the requests on different paths are not ordered.
+     *
+     * @example
+     * ```cpp
+     * IOQueue::ReadAsync(paths, [](Array<FileReadResult> &results) { for (auto &result : results) { Load(result); } });
+     * ```
+     *
+     * @note `Thread`, `Signal` and `FileSystem` must be initialized before `Initialize` and shut down after `Shutdown`.
+     */
+    class IOQueue
+    {
+    public:
+        /**
+         * @brief Starts the worker threads.
+         */
+        static void Initialize(u32 workerCount = RPP_IO_QUEUE_DEFAULT_WORKER_COUNT);
+
+        /**
+         * @brief Waits for the queued requests then stops the worker threads. The callbacks which were not processed
+         *      yet are dropped.
+         */
+        static void Shutdown();
+
+    public:
+        /**
+         * @brief Queues the read of a whole file.
+         *
+         * @param callback Executed on the main thread by `ProcessCompletions` with the content of the file.
+         */
+        static void ReadAsync(const String &filePath, FileReadCallback callback);
+
+        /**
+         * @brief Queues the reads of several files, which are spread over the workers. The callback is executed once,
+         *      when all of them are done.
+         *
+         * @param callback Executed on the main thread by `ProcessCompletions` with one result per path.
+         */
+        static void ReadAsync(const Array<String> &filePaths, FileBatchReadCallback callback);
+
+        /**
+         * @brief Queues the write of a whole file. The bytes are written to a temporary file next to it, which then
+         *      replaces the file, so that a failed write never leaves a truncated file behind.
+         *
+         * @param bytes The content of the file, moved into the request.
+         * @param callback Executed on the main thread by `ProcessCompletions`. Can be nullptr.
+         */
+        static void WriteAsync(const String &filePath, Array<u8> bytes, FileWriteCallback callback = nullptr);
+
+        /**
+         * @brief Executes the callbacks of the finished requests, on the calling thread (the main thread). Does
+         *      nothing if `Initialize` has not been called.
+         *
+         * @return The number of executed callbacks.
+         */
+        static u32 ProcessCompletions();
+
+        /**
+         * @brief Blocks the calling thread until all the queued requests are done (their callbacks are still left to
+         *      `ProcessCompletions`).
+         *
+         * @param timeout The maximum time to wait in milliseconds. A value of ``INFINITE_WAIT`` means to wait indefinitely.
+         * @return TRUE if everything is done, FALSE if the timeout expired.
+         */
+        static b8 WaitIdle(u32 timeout = INFINITE_WAIT);
+
+        /**
+         * @brief The number of requests whose callback has not been executed yet (queued, running or finished). A batch
+         *      counts as one request.
+         */
+        static u32 GetPendingCount();
+
+    private:
+        static void workerEntry(void *pParam);
+    };
+} // namespace rpp
@@ -1,4 +1,6 @@
 #pragma once
 
 #include "signal.h"
-#include "thread.h"
\ No newline at end of file
+#include "thread.h"
+#include "async.h"
+#include "io_queue.h"
\ No newline at end of file
@@ -10,13 +10,23 @@ namespace rpp
     class Program
     {
     private:
+        /**
+         * @brief The location of one uniform, looked up by the graphics backend the first time it is set.
+         */
+        struct UniformLocation
+        {
+            StringId name;
+            i32 location; ///< `UNIFORM_LOCATION_UNKNOWN` until the first lookup.
+        };
+
         /**
          * @brief All information related to a graphics pipeline (shader program).
          */
         struct ProgramData
         {
-            u32 rendererId; ///< The ID of the renderer that created this program.
-            u32 programId;  ///< The unique identifier for the program in the graphics API.
+            u32 rendererId;                  ///< The ID of the renderer that created this program.
+            u32 programId;                   ///< The unique identifier for the program in the graphics API.
+            Array<UniformLocation> uniforms; ///< The uniforms set so far, a program only has a handful of them.
         };
 
     public:
@@ -52,11 +62,26 @@ namespace rpp
         /**
          * @brief Set a float uniform variable in the shader program. The current program must be active (used) before calling this method.
          *
-         * @param name The name of the uniform variable in the shader.
+         * @param name The interned name of the uniform variable in the shader. The location is looked up once per program.
          * @param value The value to set for the uniform variable.
          */
         template <typename T>
-        static void SetUniform(const String &name, T value);
+        static void SetUniform(StringId name, T value);
+
+        /**
+         * @brief Same as above but interns the name first. Prefer keeping the `StringId` for uniforms set every frame.
+         */
+        template <typename T>
+        static void SetUniform(StringView name, T value)
+        {
+            SetUniform<T>(StringPool::Intern(name), value);
+        }
+
+    private:
+        /**
+         * @brief Returns the cached location of a uniform of a program, added as unknown the first time.
+         */
+        static i32 *getUniformLocation(ProgramData *data, StringId name);
 
     private:
         static Scope<Storage<ProgramData>> s_programs; ///< Storage for all created program IDs.
@@ -64,7 +64,7 @@ namespace rpp
          * @param slot The texture slot to activate the texture on (e.g., 0 for GL_TEXTURE0).
          * @param program The shader program that will use this texture. The program must be active (used) before calling this method.
          */
-        static void Activate(u32 textureId, const String &name, u32 slot);
+        static void Activate(u32 textureId, StringView name, u32 slot);
 
     private:
         static Scope<Storage<TextureData>> s_textureStorage; ///< Storage for managing texture data.
@@ -7,9 +7,14 @@ namespace rpp
     /**
      * System data for editor application.
      */
-    struct RPP_JSON EditorDataDescription
+    struct RPP_JSON RPP_JSON_VERSION(1) EditorDataDescription
     {
         Array<String> recentProjects RPP_JSON_KEY("recentProjects"); ///< List of recent projects opened in the editor.
+
+        /**
+         * @brief Upgrades an editor data file written with an older version, see `JsonMigration`.
+         */
+        static b8 Migrate(u32 fromVersion, Json &document);
     };
 
     /**
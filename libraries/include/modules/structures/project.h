@@ -7,10 +7,25 @@ namespace rpp
     /**
      * @brief The needed information which are used for creating a project object. This is used in Python binding and JSON mapping.
      */
-    struct RPP_JSON ProjectDescription
+    struct RPP_JSON RPP_JSON_VERSION(1) ProjectDescription
     {
         String name RPP_JSON_KEY("name"); ///< The name of the project.
         Array<String> functionNames RPP_JSON_KEY("functionNames"); ///< The list of function names in the project.
+
+        /**
+         * @brief Upgrades a project file written with an older version, see `JsonMigration`.
+         */
+        static b8 Migrate(u32 fromVersion, Json &document);
+    };
+
+    /**
+     * @brief The parts of a project which are tracked separately by `Project::SaveChanges`, one per JSON key.
+     */
+    enum class ProjectSection : u8
+    {
+        NAME,      ///< `name`
+        FUNCTIONS, ///< `functionNames`
+        COUNT RPP_HIDE,
     };
 
     /**
@@ -38,9 +53,42 @@ namespace rpp
          */
         void AddNewFunction(const String& functionName = "NewFunction");
 
+    public:
+        /**
+         * @brief Marks a section as modified, it is encoded again by the next `SaveChanges`. The editor calls it from
+         *      the `HistoryManager` callbacks because commands modify the arrays returned by the non-const getters.
+         */
+        void MarkDirty(ProjectSection section);
+
+        /**
+         * @brief Marks the project as identical to the file (right after it has been loaded from it).
+         */
+        void MarkClean(const String &filePath);
+
+        /**
+         * @brief Checks if something changed since the project was loaded or saved.
+         */
+        inline b8 IsDirty() const { return m_dirtySections != 0; }
+
+        /**
+         * @brief Saves the project in the same format as `Save`, but does nothing when the file is up to date, and only
+         *      encodes again the sections marked as dirty (the others reuse the text of the previous save). The file is
+         *      written next to the target and renamed over it, so it is never left half-written.
+         *
+         * @return TRUE if the file was written.
+         */
+        b8 SaveChanges(const String &filePath);
+
+    private:
+        void encodeSection(ProjectSection section);
+
     private:
         String m_name; ///< The name of the project.
         Array<String> m_functionNames; ///< The list of function names in the project.
+
+        u32 m_dirtySections; ///< One bit per `ProjectSection` modified since the last save.
+        String m_cleanFilePath; ///< The file which matches the current content (empty if none).
+        String m_encodedSections[u32(ProjectSection::COUNT)]; ///< The JSON text of each section at the last save.
     };
 
     const String &Project::GetName()
@@ -1,20 +1,27 @@
 #pragma once
 #include "core/core.h"
 
-#define STRUCTURE_SAVE_LOAD_DEFINE(className)                     \
-public:                                                           \
-    className();                                                  \
-    className(const className##Description &desc);                \
-    className(const className &other);                            \
-    ~className();                                                 \
-                                                                  \
-public:                                                           \
-    static className *Create();                                   \
-    static className *Create(const className##Description &desc); \
-    static className *Create(const String &filePath);             \
-    void Save(const String &filePath) const;                      \
-                                                                  \
-public:                                                           \
+#define STRUCTURE_SAVE_LOAD_DEFINE(className)                           \
+public:                                                                 \
+    className();                                                        \
+    className(const className##Description &desc);                      \
+    className(const className &other);                                  \
+    ~className();                                                       \
+                                                                        \
+public:                                                                 \
+    static className *Create();                                         \
+    static className *Create(const className##Description &desc);       \
+    static className *Create(const String &filePath);                   \
+    static void CreateAsync(const String &filePath,                     \
+                            std::function<void(className *)> callback); \
+    static b8 LoadDescription(const String &filePath,                   \
+                              className##Description &outDesc);         \
+    b8 Save(const String &filePath) const;                              \
+    void SaveAsync(const String &filePath,                              \
+                   std::function<void(b8)> callback = nullptr) const;   \
+    b8 SaveBinary(const String &filePath) const;                        \
+                                                                        \
+public:                                                                 \
     className##Description ToDescription() const;
 
 /**
@@ -38,19 +45,154 @@ public:                                                           \
     className *className::Create(const String &filePath)                            \
     {                                                                               \
         RPP_PROFILE_SCOPE();                                                        \
-        RPP_ASSERT(FileSystem::PathExists(filePath));                               \
+        className##Description desc = {};                                           \
+        b8 loaded = LoadDescription(filePath, desc);                                \
+        RPP_ASSERT_MSG(loaded, "Cannot load {}", filePath);                         \
+        RPP_UNUSED(loaded);                                                         \
                                                                                     \
-        FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_READ);           \
-        String fileContent = FileSystem::Read(file);                                \
+        return RPP_NEW(className, desc);                                            \
+    }                                                                               \
+                                                                                    \
+    void className::CreateAsync(const String &filePath,                             \
+                                std::function<void(className *)> callback)          \
+    {                                                                               \
+        RPP_PROFILE_SCOPE();                                                        \
+        RPP_ASSERT(callback != nullptr);                                            \
+                                                                                    \
+        /* parsed on the worker, the object is built on the main thread */          \
+        auto pDesc = CreateRef<className##Description>();                           \
+        auto pLoaded = CreateRef<b8>(FALSE);                                        \
+        Async::Run(                                                                 \
+            [filePath, pDesc, pLoaded]()                                            \
+            { *pLoaded = LoadDescription(filePath, *pDesc); },                      \
+            [pDesc, pLoaded, callback]()                                            \
+            { callback(*pLoaded ? RPP_NEW(className, *pDesc) : nullptr); });        \
+    }                                                                               \
+                                                                                    \
+    b8 className::LoadDescription(const String &filePath,                           \
+                                  className##Description &outDesc)                  \
+    {                                                                               \
+        /* no profiling scope: this also runs on the Async worker, and the profiler \
+           is not thread-safe */                                                    \
+        if (!FileSystem::PathExists(filePath))                                      \
+        {                                                                           \
+            return FALSE;                                                           \
+        }                                                                           \
+                                                                                    \
+        FileHandle file = FileSystem::MapFile(filePath);                            \
+        b8 loaded = FileSystem::IsFileOpen(file);                                   \
+        if (loaded)                                                                 \
+        {                                                                           \
+            /* both formats are decoded in place from the mapping */                \
+            BinaryReader reader(file);                                              \
+            if (reader.ReadHeader())                                                \
+            {                                                                       \
+                loaded = ReadBinary(reader, outDesc);                               \
+            }                                                                       \
+            else                                                                    \
+            {                                                                       \
+                StringView content(                                                 \
+                    reinterpret_cast<const char *>(FileSystem::GetMappedData(file)),\
+                    FileSystem::GetMappedSize(file));                               \
+                String error;                                                       \
+                loaded = ReadVersionedJson(content, outDesc, error);                \
+                if (!loaded)                                                        \
+                {                                                                   \
+                    RPP_LOG_ERROR("Cannot load {}: {}", filePath, error);           \
+                }                                                                   \
+            }                                                                       \
+        }                                                                           \
         FileSystem::CloseFile(file);                                                \
                                                                                     \
-        return RPP_NEW(className, FromString<className##Description>(fileContent)); \
+        return loaded;                                                              \
     }                                                                               \
                                                                                     \
-    void className::Save(const String &filePath) const                              \
+    b8 className::Save(const String &filePath) const                                \
     {                                                                               \
         RPP_PROFILE_SCOPE();                                                        \
-        FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE);          \
-        FileSystem::Write(file, ToString(this->ToDescription()));                   \
+        /* written next to the target then renamed over it, never left truncated */ \
+        String tempFilePath = Format("{}.tmp", filePath);                           \
+        FileHandle file = FileSystem::OpenFile(tempFilePath, FILE_MODE_WRITE);      \
+        if (!FileSystem::IsFileOpen(file))                                          \
+        {                                                                           \
+            FileSystem::CloseFile(file);                                            \
+            RPP_LOG_ERROR("Cannot write {}", tempFilePath);                         \
+            return FALSE;                                                           \
+        }                                                                           \
+        {                                                                           \
+            JsonWriter writer(file, JsonFormat::PRETTY);                            \
+            WriteJson(writer, this->ToDescription());                               \
+            writer.Flush();                                                         \
+        }                                                                           \
         FileSystem::CloseFile(file);                                                \
+                                                                                    \
+        if (!FileSystem::RenameFile(tempFilePath, filePath))                        \
+        {                                                                           \
+            RPP_LOG_ERROR("Cannot replace {}", filePath);                           \
+            return FALSE;                                                           \
+        }                                                                           \
+        return TRUE;                                                                \
+    }                                                                               \
+                                                                                    \
+    void className::SaveAsync(const String &filePath,                               \
+                              std::function<void(b8)> callback) const               \
+    {                                                                               \
+        RPP_PROFILE_SCOPE();                                                        \
+        /* snapshot taken now, the object can be modified while the worker writes */\
+        auto pDesc = CreateRef<className##Description>(this->ToDescription());      \
+        auto pSaved = CreateRef<b8>(FALSE);                                         \
+        Async::Run(                                                                 \
+            [filePath, pDesc, pSaved]()                                             \
+            {                                                                       \
+                String tempFilePath = Format("{}.tmp", filePath);                   \
+                FileHandle file = FileSystem::OpenFile(tempFilePath,                \
+                                                       FILE_MODE_WRITE);            \
+                if (!FileSystem::IsFileOpen(file))                                  \
+                {                                                                   \
+                    FileSystem::CloseFile(file);                                    \
+                    return;                                                         \
+                }                                                                   \
+                {                                                                   \
+                    JsonWriter writer(file, JsonFormat::PRETTY);                    \
+                    WriteJson(writer, *pDesc);                                      \
+                    writer.Flush();                                                 \
+                }                                                                   \
+                FileSystem::CloseFile(file);                                        \
+                                                                                    \
+                *pSaved = FileSystem::RenameFile(tempFilePath, filePath);           \
+            },                                                                      \
+            [pSaved, callback]()                                                    \
+            {                                                                       \
+                if (callback != nullptr)                                            \
+                {                                                                   \
+                    callback(*pSaved);                                              \
+                }                                                                   \
+            });                                                                     \
+    }                                                                               \
+                                                                                    \
+    b8 className::SaveBinary(const String &filePath) const                          \
+    {                                                                               \
+        RPP_PROFILE_SCOPE();                                                        \
+        BinaryWriter writer;                                                        \
+        writer.WriteHeader();                                                       \
+        WriteBinary(writer, this->ToDescription());                                 \
+                                                                                    \
+        String tempFilePath = Format("{}.tmp", filePath);                           \
+        FileHandle file = FileSystem::OpenFile(tempFilePath,                        \
+                                               FILE_MODE_WRITE | FILE_MODE_BINARY); \
+        if (!FileSystem::IsFileOpen(file))                                          \
+        {                                                                           \
+            FileSystem::CloseFile(file);                                            \
+            RPP_LOG_ERROR("Cannot write {}", tempFilePath);                         \
+            return FALSE;                                                           \
+        }                                                                           \
+        writer.WriteTo(file);                                                       \
+        FileSystem::CloseFile(file);                                                \
+                                                                                    \
+        if (!FileSystem::RenameFile(tempFilePath, filePath))                        \
+        {                                                                           \
+            RPP_LOG_ERROR("Cannot replace {}", filePath);                           \
+            return FALSE;                                                           \
+        }                                                                           \
+        return TRUE;                                                                \
     }
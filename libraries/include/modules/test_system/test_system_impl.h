@@ -23,7 +23,7 @@ namespace rpp
         /**
          * Starting the test system with the given scripts (these scripts is python scripts).
          *
-         * @param resultFilePath The path to the result file where test results will be written (json format). This parameter is required.
+         * @param resultFilePath The path to the result file where test results will be written (JSON Lines format, one record appended per test case). This parameter is required.
          * @param updateFilePath The path to the update script (optional).
          * @param runTestCaseName The name of the test case to run (optional).
          *
@@ -231,9 +231,12 @@ namespace rpp
         COUNT,
     };
 
+#define UNIFORM_LOCATION_UNKNOWN i32(-2) ///< The location of a uniform which was not looked up yet (-1 means the program has no such uniform).
+
     struct UniformDescription
     {
         const char *name; ///< The name of the uniform variable in the shader.
+        i32 *pLocation;   ///< The location cached by the caller for this program, `UNIFORM_LOCATION_UNKNOWN` until the first lookup. nullptr disables the cache.
         UniformType type; ///< The type of the uniform variable.
         void *pData;      ///< Pointer to the data to be set for the uniform variable.
     };
@@ -51,6 +51,13 @@ namespace rpp
             m_tempAddedSessions->Clear();
         }
 
+        // Hand the results of the background jobs (project loading, saving), of the file requests and the changes of the
+        // watched directories back to the main thread, before the sessions render them. The callbacks activate the
+        // renderer they need.
+        Async::ProcessCompletions();
+        IOQueue::ProcessCompletions();
+        FileSystem::ProcessWatchEvents();
+
         b8 shouldApplicationClose = TRUE;
         u32 numberOfSessions = m_sessions->Size();
 
@@ -0,0 +1,232 @@
+#include "core/binary_stream.h"
+#include "core/assertions.h"
+
+namespace rpp
+{
+    namespace
+    {
+        const u8 s_binaryMagic[4] = {'R', 'P', 'P', 'B'};
+    } // namespace
+
+    // ----------------- BinaryWriter -----------------
+
+    BinaryWriter::BinaryWriter()
+        : m_data(nullptr), m_size(0), m_capacity(0)
+    {
+    }
+
+    BinaryWriter::~BinaryWriter()
+    {
+        if (m_data != nullptr)
+        {
+            RPP_FREE(m_data);
+            m_data = nullptr;
+        }
+    }
+
+    void BinaryWriter::WriteHeader()
+    {
+        writeBytes(s_binaryMagic, sizeof(s_binaryMagic));
+        writeUnsigned(RPP_BINARY_FORMAT_VERSION, sizeof(u32));
+    }
+
+    u32 BinaryWriter::BeginStruct()
+    {
+        return reserveSize();
+    }
+
+    void BinaryWriter::EndStruct(u32 marker)
+    {
+        patchSize(marker);
+    }
+
+    void BinaryWriter::WriteTo(FileHandle file) const
+    {
+        if (m_size > 0)
+        {
+            FileSystem::WriteChunk(file, reinterpret_cast<const char *>(m_data), m_size);
+        }
+    }
+
+    void BinaryWriter::writeUnsigned(u64 value, u32 byteCount)
+    {
+        // always little-endian, whatever the host is
+        u8 bytes[8];
+        for (u32 i = 0; i < byteCount; i++)
+        {
+            bytes[i] = static_cast<u8>(value >> (i * 8));
+        }
+        writeBytes(bytes, byteCount);
+    }
+
+    void BinaryWriter::writeBytes(const void *data, u32 length)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+
+        grow(length);
+        memcpy(m_data + m_size, data, length);
+        m_size += length;
+    }
+
+    u32 BinaryWriter::reserveSize()
+    {
+        u32 marker = m_size;
+        writeUnsigned(0, sizeof(u32));
+        return marker;
+    }
+
+    void BinaryWriter::patchSize(u32 marker)
+    {
+        u32 size = m_size - marker - static_cast<u32>(sizeof(u32));
+        for (u32 i = 0; i < sizeof(u32); i++)
+        {
+            m_data[marker + i] = static_cast<u8>(size >> (i * 8));
+        }
+    }
+
+    void BinaryWriter::grow(u32 additional)
+    {
+        if (m_size + additional <= m_capacity)
+        {
+            return;
+        }
+
+        u32 newCapacity = m_capacity < 256 ? 256 : m_capacity * 2;
+        while (newCapacity < m_size + additional)
+        {
+            newCapacity *= 2;
+        }
+
+        u8 *newData = static_cast<u8 *>(RPP_MALLOC(newCapacity));
+        if (m_data != nullptr)
+        {
+            memcpy(newData, m_data, m_size);
+            RPP_FREE(m_data);
+        }
+        m_data = newData;
+        m_capacity = newCapacity;
+    }
+
+    // ----------------- BinaryReader -----------------
+
+    BinaryReader::BinaryReader(const u8 *data, u32 size)
+        : m_data(data), m_size(size), m_position(0), m_error(FALSE)
+    {
+    }
+
+    BinaryReader::BinaryReader(FileHandle file)
+        : m_data(nullptr), m_size(0), m_position(0), m_error(FALSE)
+    {
+        RPP_ASSERT(FileSystem::IsFileOpen(file));
+
+        if (FileSystem::IsFileMapped(file))
+        {
+            m_data = FileSystem::GetMappedData(file);
+            m_size = FileSystem::GetMappedSize(file);
+            return;
+        }
+
+        // sized once and read with a single call
+        if (!FileSystem::ReadBytes(file, m_ownedData))
+        {
+            m_error = TRUE;
+        }
+
+        m_data = m_ownedData.Data();
+        m_size = m_ownedData.Size();
+    }
+
+    BinaryReader::~BinaryReader()
+    {
+    }
+
+    b8 BinaryReader::ReadHeader()
+    {
+        const u8 *magic = readBytes(sizeof(s_binaryMagic));
+        if (magic == nullptr || memcmp(magic, s_binaryMagic, sizeof(s_binaryMagic)) != 0)
+        {
+            m_error = TRUE;
+            return FALSE;
+        }
+
+        if (readUnsigned(sizeof(u32)) != RPP_BINARY_FORMAT_VERSION)
+        {
+            m_error = TRUE;
+        }
+        return !m_error;
+    }
+
+    b8 BinaryReader::BeginStruct(u32 &outEnd)
+    {
+        u32 size = static_cast<u32>(readUnsigned(sizeof(u32)));
+        if (m_error || size > m_size - m_position)
+        {
+            m_error = TRUE;
+            return FALSE;
+        }
+
+        outEnd = m_position + size;
+        return TRUE;
+    }
+
+    b8 BinaryReader::NextField(u32 structEnd, u32 &outKey, u32 &outFieldEnd)
+    {
+        if (m_error || m_position >= structEnd)
+        {
+            return FALSE;
+        }
+
+        outKey = static_cast<u32>(readUnsigned(sizeof(u32)));
+        u32 size = static_cast<u32>(readUnsigned(sizeof(u32)));
+        if (m_error || size > structEnd - m_position)
+        {
+            m_error = TRUE;
+            return FALSE;
+        }
+
+        outFieldEnd = m_position + size;
+        return TRUE;
+    }
+
+    void BinaryReader::Seek(u32 position)
+    {
+        if (position > m_size)
+        {
+            m_error = TRUE;
+            return;
+        }
+        m_position = position;
+    }
+
+    u64 BinaryReader::readUnsigned(u32 byteCount)
+    {
+        const u8 *bytes = readBytes(byteCount);
+        if (bytes == nullptr)
+        {
+            return 0;
+        }
+
+        u64 value = 0;
+        for (u32 i = 0; i < byteCount; i++)
+        {
+            value |= static_cast<u64>(bytes[i]) << (i * 8);
+        }
+        return value;
+    }
+
+    const u8 *BinaryReader::readBytes(u32 length)
+    {
+        if (m_error || length > m_size - m_position)
+        {
+            m_error = TRUE;
+            return nullptr;
+        }
+
+        const u8 *bytes = m_data + m_position;
+        m_position += length;
+        return bytes;
+    }
+} // namespace rpp
@@ -1,13 +1,40 @@
 #include "core/filesystem.h"
+#include "core/path.h"
+#include "core/format.h"
+#include "core/containers/lru_cache.h"
+#include <algorithm>
+#include <cstring>
 #include <fstream>
 #include <filesystem>
+#include <mutex>
+#include <sstream>
 #include "core/assertions.h"
+#include "core/simd.h"
 
 #if defined(RPP_PLATFORM_WINDOWS)
 #include <direct.h>
+#include <windows.h>
+#undef CreateDirectory
+#undef DeleteFile
 #else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
 #endif
 
+/// Internal mode of the entries created by `MapFile`, never combined with the other modes.
+#define FILE_MODE_MAPPED u32(0x08)
+
+/// Internal mode of the entries which read a file of a memory or archive mount, see `openVirtualFile`.
+#define FILE_MODE_VIRTUAL u32(0x10)
+
+/// Internal mode of the entries which write a file of a memory mount, see `openVirtualWriteFile`.
+#define FILE_MODE_VIRTUAL_WRITE u32(0x20)
+
+/// The number of physical paths, and of existing directories, remembered by the path caches.
+#define FILESYSTEM_PATH_CACHE_CAPACITY 256
+
 /**
  * @note not using the FileSystem interface because it can be messed up with the testing environment
  *
@@ -16,6 +43,143 @@
 
 namespace rpp
 {
+    namespace
+    {
+        /**
+         * The object behind `FileEntry::pFileHandle` for the entries created by `MapFile`.
+         */
+        struct MappedFile
+        {
+            u8 *pData;     ///< The mapped content, nullptr for an empty file.
+            u32 size;      ///< The size of the content in bytes.
+            b8 isWritable; ///< Mapped with `FILE_MODE_READ_WRITE`.
+            b8 isCopy;     ///< `pData` is a heap copy of a mounted file (`mapVirtualFile`), not a mapping.
+#if defined(RPP_PLATFORM_WINDOWS)
+            HANDLE mapping; ///< The file mapping object which owns the view.
+#endif
+        };
+
+        void UnmapFile(MappedFile *pMappedFile)
+        {
+            if (pMappedFile->isCopy)
+            {
+                RPP_FREE(pMappedFile->pData);
+            }
+            else if (pMappedFile->pData != nullptr)
+            {
+#if defined(RPP_PLATFORM_WINDOWS)
+                UnmapViewOfFile(pMappedFile->pData);
+                CloseHandle(pMappedFile->mapping);
+#else
+                munmap(pMappedFile->pData, pMappedFile->size);
+#endif
+            }
+            RPP_DELETE(pMappedFile);
+        }
+
+        /**
+         * @brief Returns the stream of an entry opened for reading.
+         */
+        std::istream *GetInputStream(void *pFileHandle, u8 mode)
+        {
+            switch (mode)
+            {
+            case FILE_MODE_READ:
+                return static_cast<std::ifstream *>(pFileHandle);
+            case FILE_MODE_READ_WRITE:
+                return static_cast<std::fstream *>(pFileHandle);
+            case FILE_MODE_VIRTUAL:
+                return static_cast<std::istringstream *>(pFileHandle);
+            default:
+                RPP_UNREACHABLE();
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Returns the stream of an entry opened for writing.
+         */
+        std::ostream *GetOutputStream(void *pFileHandle, u8 mode)
+        {
+            switch (mode)
+            {
+            case FILE_MODE_WRITE:
+            case FILE_MODE_APPEND:
+                return static_cast<std::ofstream *>(pFileHandle);
+            case FILE_MODE_READ_WRITE:
+                return static_cast<std::fstream *>(pFileHandle);
+            case FILE_MODE_VIRTUAL_WRITE:
+                return static_cast<std::ostringstream *>(pFileHandle);
+            default:
+                RPP_UNREACHABLE();
+            }
+            return nullptr;
+        }
+
+        /// Protects `s_fileEntries`: the files can be opened and closed from the `Async` worker thread too.
+        std::mutex s_fileEntriesMutex;
+
+        u32 HashCachedPath(const void *pPath)
+        {
+            return Path::Hash(*static_cast<const String *>(pPath));
+        }
+
+        typedef LRUCache<String, String, HashCachedPath> PhysicalPathCache;
+        typedef LRUCache<String, b8, HashCachedPath> DirectoryCache;
+
+        /// Protects the path caches, the paths are translated from the `Async` and `IOQueue` workers too.
+        std::mutex s_pathCachesMutex;
+
+        /// The physical path of the logical paths (as given by the caller) used recently, in the testing environment.
+        Scope<PhysicalPathCache> s_pPhysicalPaths = nullptr;
+
+        /// The physical directories known to exist, so that opening a file for writing does not check its parents
+        /// again. Cleared when the module deletes or renames anything, the directories removed by other programs
+        /// are only noticed when an open fails.
+        Scope<DirectoryCache> s_pExistingDirectories = nullptr;
+
+        /**
+         * @brief Turns the drive of a normalized path into a folder name ("C:/work" into "c/work"), in the testing
+         *      environment.
+         */
+        String ConvertDriveLetter(const String &path)
+        {
+            const char *data = path.CStr();
+            if (path.Length() < 2 || data[1] != ':')
+            {
+                return path;
+            }
+
+            char drive = data[0] >= 'A' && data[0] <= 'Z' ? static_cast<char>(data[0] - 'A' + 'a') : data[0];
+            return Format("{}{}", StringView(&drive, 1), StringView(data + 2, path.Length() - 2));
+        }
+
+        b8 IsDirectoryCached(const String &path)
+        {
+            std::lock_guard<std::mutex> lock(s_pathCachesMutex);
+            b8 exists = FALSE;
+            return s_pExistingDirectories->Get(path, exists) && exists;
+        }
+
+        void CacheDirectory(const String &path)
+        {
+            std::lock_guard<std::mutex> lock(s_pathCachesMutex);
+            s_pExistingDirectories->Put(path, TRUE);
+        }
+
+        void ForgetDirectory(const String &path)
+        {
+            std::lock_guard<std::mutex> lock(s_pathCachesMutex);
+            s_pExistingDirectories->Remove(path);
+        }
+
+        void ForgetDirectories()
+        {
+            std::lock_guard<std::mutex> lock(s_pathCachesMutex);
+            s_pExistingDirectories->Clear();
+        }
+    } // namespace
+
     Scope<Storage<FileSystem::FileEntry>> FileSystem::s_fileEntries = nullptr;
     String FileSystem::s_temporaryPathRoot = "";
     String FileSystem::s_cwd = "";
@@ -32,15 +196,7 @@ namespace rpp
             s_cwd = cwd;
 
             // TODO: Need a better way to handle drive letters in paths, maybe use Regex? And avoid hardcoding for all drive letters and duplicated code.
-            s_convertedCWD = s_cwd;
-            s_convertedCWD = s_convertedCWD.Replace("\\", "/", TRUE);
-            s_convertedCWD = s_convertedCWD.Replace("C:/", "c/");
-            s_convertedCWD = s_convertedCWD.Replace("D:/", "d/");
-            s_convertedCWD = s_convertedCWD.Replace("E:/", "e/");
-            s_convertedCWD = s_convertedCWD.Replace("F:/", "f/");
-            s_convertedCWD = s_convertedCWD.Replace("G:/", "g/");
-            s_convertedCWD = s_convertedCWD.Replace("H:/", "h/");
-            s_convertedCWD = s_convertedCWD.Replace("I:/", "i/");
+            s_convertedCWD = ConvertDriveLetter(Path(s_cwd).GetString());
 
             // create the temporary directory if it does not exist
 #if defined(RPP_PLATFORM_WINDOWS) && 0
@@ -83,6 +239,23 @@ namespace rpp
                 case FILE_MODE_READ_WRITE:
                     RPP_DELETE(static_cast<std::fstream *>(pFileEntry->pFileHandle));
                     break;
+                case FILE_MODE_MAPPED:
+                    UnmapFile(static_cast<MappedFile *>(pFileEntry->pFileHandle));
+                    break;
+                case FILE_MODE_VIRTUAL:
+                    RPP_DELETE(static_cast<std::istringstream *>(pFileEntry->pFileHandle));
+                    break;
+                case FILE_MODE_VIRTUAL_WRITE:
+                {
+                    // nothing is dropped if the mount went away in the meantime
+                    std::ostringstream *pStream = static_cast<std::ostringstream *>(pFileEntry->pFileHandle);
+                    std::string content = pStream->str();
+                    b8 written = FALSE;
+                    tryWriteMounted(pFileEntry->name, reinterpret_cast<const u8 *>(content.data()),
+                                    static_cast<u32>(content.size()), written);
+                    RPP_DELETE(pStream);
+                    break;
+                }
 
                 default:
                     RPP_UNREACHABLE();
@@ -94,13 +267,23 @@ namespace rpp
         };
 
         s_fileEntries = CreateScope<Storage<FileEntry>>(DeallocateFileEntry);
+
+        s_pPhysicalPaths = CreateScope<PhysicalPathCache>(FILESYSTEM_PATH_CACHE_CAPACITY);
+        s_pExistingDirectories = CreateScope<DirectoryCache>(FILESYSTEM_PATH_CACHE_CAPACITY);
+
+        initializeWatches();
+        initializeMounts();
     }
 
     void FileSystem::Shutdown()
     {
         RPP_ASSERT(s_fileEntries != nullptr);
 
+        shutdownMounts();
+        shutdownWatches();
         s_fileEntries.reset();
+        s_pPhysicalPaths.reset();
+        s_pExistingDirectories.reset();
 
         // clean up the temporary directory if in testing environment
         if (s_temporaryPathRoot.Length() > 0)
@@ -119,37 +302,44 @@ namespace rpp
 
     String FileSystem::getPhysicalPath(const String &path)
     {
+        // the directory mounts come first, the testing environment is the mount of everything else
+        String physicalPath;
+        if (tryResolveDirectoryMount(path, physicalPath))
+        {
+            return physicalPath;
+        }
+
         if (s_temporaryPathRoot.Length() == 0)
         {
             return path;
         }
 
-        String physicalPath = path;
+        {
+            std::lock_guard<std::mutex> lock(s_pathCachesMutex);
+            if (s_pPhysicalPaths->Get(path, physicalPath))
+            {
+                return physicalPath;
+            }
+        }
 
         // In testing environment, prepend the temporary path root
 #if RPP_PLATFORM_WINDOWS
-        // TODO: Need a better way to handle drive letters in paths, maybe use Regex?
-
-        physicalPath = physicalPath.Replace("\\", "/", TRUE);
-        physicalPath = physicalPath.Replace("C:/", "c/");
-        physicalPath = physicalPath.Replace("D:/", "d/");
-        physicalPath = physicalPath.Replace("E:/", "e/");
-        physicalPath = physicalPath.Replace("F:/", "f/");
-        physicalPath = physicalPath.Replace("G:/", "g/");
-        physicalPath = physicalPath.Replace("H:/", "h/");
-        physicalPath = physicalPath.Replace("I:/", "i/");
-
+        physicalPath = ConvertDriveLetter(Path(path).GetString());
 #else
+        physicalPath = Path(path).GetString();
 #endif
 
-        if (physicalPath.SubString(0, s_convertedCWD.Length()) != s_convertedCWD)
+        if (!physicalPath.StartsWith(s_convertedCWD))
         {
-            physicalPath = s_temporaryPathRoot + "/" + s_convertedCWD + "/" + physicalPath;
+            physicalPath = Format("{}/{}/{}", s_temporaryPathRoot, s_convertedCWD, physicalPath);
         }
         else
         {
-            physicalPath = s_temporaryPathRoot + "/" + physicalPath;
+            physicalPath = Format("{}/{}", s_temporaryPathRoot, physicalPath);
         }
+
+        std::lock_guard<std::mutex> lock(s_pathCachesMutex);
+        s_pPhysicalPaths->Put(path, physicalPath);
         return physicalPath;
     }
 
@@ -165,6 +355,11 @@ namespace rpp
 
     void FileSystem::CreatePhysicalDirectory(const String &path)
     {
+        if (IsDirectoryCached(path))
+        {
+            return;
+        }
+
         Array<String> parts;
         SplitPath(parts, path);
         u32 partsCount = parts.Size();
@@ -191,46 +386,155 @@ namespace rpp
             std::filesystem::create_directory(currentFolder.CStr());
 #endif
         }
+
+        if (IsPhysicalPathDirectory(path))
+        {
+            CacheDirectory(path);
+        }
     }
 
     void FileSystem::DeletePhysicalFile(const String &path)
     {
+        // the path may be an (empty) directory, or the last file of a directory removed by the caller next
+        ForgetDirectories();
         std::filesystem::remove(path.CStr());
     }
 
     void FileSystem::DeleteFile(const String &path)
     {
+        if (tryDeleteMounted(path))
+        {
+            return;
+        }
         DeletePhysicalFile(getPhysicalPath(path));
     }
 
+    b8 FileSystem::RenameFile(const String &sourcePath, const String &destinationPath)
+    {
+        b8 renamed = FALSE;
+        if (tryRenameMounted(sourcePath, destinationPath, renamed))
+        {
+            return renamed;
+        }
+
+        ForgetDirectories();
+
+        std::error_code error;
+        std::filesystem::rename(getPhysicalPath(sourcePath).CStr(), getPhysicalPath(destinationPath).CStr(), error);
+        return !error;
+    }
+
     FileHandle FileSystem::OpenFile(const String &filePath, u32 mode)
     {
+        if ((mode & ~FILE_MODE_BINARY) == FILE_MODE_READ)
+        {
+            Array<u8> content;
+            b8 read = FALSE;
+            if (tryReadMounted(filePath, content, read))
+            {
+                return openVirtualFile(filePath, read ? &content : nullptr);
+            }
+        }
+        else
+        {
+            b8 exists = FALSE;
+            b8 isDirectory = FALSE;
+            if (tryFindMounted(filePath, exists, isDirectory))
+            {
+                return openVirtualWriteFile(filePath, mode & ~FILE_MODE_BINARY);
+            }
+        }
+
         return OpenPhysicalFile(getPhysicalPath(filePath), mode);
     }
 
+    FileHandle FileSystem::openVirtualFile(const String &filePath, const Array<u8> *pContent)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+
+        FileHandle fileHandle = createFileEntry();
+        FileEntry *pFileEntry = getFileEntry(fileHandle);
+        RPP_ASSERT(pFileEntry != nullptr);
+
+        pFileEntry->id = fileHandle;
+        pFileEntry->name = filePath;
+        pFileEntry->mode = FILE_MODE_VIRTUAL;
+        pFileEntry->pFileHandle = nullptr;
+
+        if (pContent != nullptr)
+        {
+            std::string content(reinterpret_cast<const char *>(pContent->Data()), pContent->Size());
+            pFileEntry->pFileHandle = RPP_NEW(std::istringstream, std::move(content), std::ios::in | std::ios::binary);
+        }
+        return fileHandle;
+    }
+
+    FileHandle FileSystem::openVirtualWriteFile(const String &filePath, u32 mode)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+
+        FileHandle fileHandle = createFileEntry();
+        FileEntry *pFileEntry = getFileEntry(fileHandle);
+        RPP_ASSERT(pFileEntry != nullptr);
+
+        pFileEntry->id = fileHandle;
+        pFileEntry->name = filePath;
+        pFileEntry->mode = FILE_MODE_VIRTUAL_WRITE;
+        pFileEntry->pFileHandle = nullptr;
+
+        if (mode != FILE_MODE_WRITE && mode != FILE_MODE_APPEND)
+        {
+            return fileHandle;
+        }
+
+        Array<u8> content;
+        b8 read = FALSE;
+        if (mode == FILE_MODE_APPEND)
+        {
+            tryReadMounted(filePath, content, read);
+        }
+
+        // the file is created (or truncated) right away, like a physical one, which also tells if the mount is writable
+        b8 written = FALSE;
+        tryWriteMounted(filePath, content.Data(), content.Size(), written);
+        if (written)
+        {
+            std::string initialContent(reinterpret_cast<const char *>(content.Data()), content.Size());
+            pFileEntry->pFileHandle = RPP_NEW(std::ostringstream, std::move(initialContent),
+                                              std::ios::out | std::ios::binary | std::ios::ate);
+        }
+        return fileHandle;
+    }
+
     FileHandle FileSystem::OpenPhysicalFile(const String &filePath, u32 mode)
     {
         RPP_ASSERT(s_fileEntries != nullptr);
 
-        FileHandle fileHandle = s_fileEntries->Create();
-        FileEntry *pFileEntry = s_fileEntries->Get(fileHandle);
+        FileHandle fileHandle = createFileEntry();
+        FileEntry *pFileEntry = getFileEntry(fileHandle);
         RPP_ASSERT(pFileEntry != nullptr);
 
+        // the binary flag only changes how the stream is opened, the entry keeps the access mode
+        std::ios_base::openmode binaryMode = (mode & FILE_MODE_BINARY) != 0 ? std::ios::binary : std::ios_base::openmode();
+        mode &= ~FILE_MODE_BINARY;
+
         pFileEntry->id = fileHandle;
         pFileEntry->name = filePath;
         pFileEntry->mode = mode;
 
+        // ensure the directory exists, known directories are not checked again
+        String directoryPath;
         if (mode == FILE_MODE_WRITE || mode == FILE_MODE_APPEND || mode == FILE_MODE_READ_WRITE)
         {
-            // ensure the directory exists
-
-            // TODO: Another interface for creating directory?
-            Array<String> pathParts;
-            SplitPath(pathParts, filePath);
+            i32 lastSeparatorIndex = static_cast<i32>(filePath.Length()) - 1;
+            while (lastSeparatorIndex >= 0 && filePath.CStr()[lastSeparatorIndex] != '/' && filePath.CStr()[lastSeparatorIndex] != '\\')
+            {
+                lastSeparatorIndex--;
+            }
 
-            if (pathParts.Size() > 1)
+            if (lastSeparatorIndex > 0)
             {
-                String directoryPath = String::Join(pathParts, "/").SubString(0, filePath.Length() - pathParts[pathParts.Size() - 1].Length() - 1);
+                directoryPath = filePath.SubString(0, lastSeparatorIndex);
                 CreatePhysicalDirectory(directoryPath);
             }
         }
@@ -241,8 +545,8 @@ namespace rpp
         {
         case FILE_MODE_READ:
         {
-            pFileEntry->pFileHandle = new std::ifstream(filePath.CStr(), std::ios::in);
-            openMode = std::ios::in;
+            openMode = std::ios::in | binaryMode;
+            pFileEntry->pFileHandle = new std::ifstream(filePath.CStr(), openMode);
             if (!static_cast<std::ifstream *>(pFileEntry->pFileHandle)->is_open())
             {
                 pFileEntry->pFileHandle = nullptr;
@@ -252,7 +556,7 @@ namespace rpp
         }
         case FILE_MODE_WRITE:
         {
-            openMode = std::ios::out | std::ios::trunc;
+            openMode = std::ios::out | std::ios::trunc | binaryMode;
             pFileEntry->pFileHandle = new std::ofstream(filePath.CStr(), openMode);
             if (!static_cast<std::ofstream *>(pFileEntry->pFileHandle)->is_open())
             {
@@ -262,7 +566,7 @@ namespace rpp
         }
         case FILE_MODE_APPEND:
         {
-            openMode = std::ios::out | std::ios::app;
+            openMode = std::ios::out | std::ios::app | binaryMode;
             pFileEntry->pFileHandle = new std::ofstream(filePath.CStr(), openMode);
             if (!static_cast<std::ofstream *>(pFileEntry->pFileHandle)->is_open())
             {
@@ -272,7 +576,7 @@ namespace rpp
         }
         case FILE_MODE_READ_WRITE:
         {
-            openMode = std::ios::in | std::ios::out;
+            openMode = std::ios::in | std::ios::out | binaryMode;
             pFileEntry->pFileHandle = new std::fstream(filePath.CStr(), openMode);
             if (!static_cast<std::fstream *>(pFileEntry->pFileHandle)->is_open())
             {
@@ -284,13 +588,240 @@ namespace rpp
             RPP_UNREACHABLE();
         }
 
+        if (pFileEntry->pFileHandle == nullptr && directoryPath.Length() > 0)
+        {
+            // the directory may have been removed by another program, check it again the next time
+            ForgetDirectory(directoryPath);
+        }
+
+        return fileHandle;
+    }
+
+    FileHandle FileSystem::MapFile(const String &filePath, u32 mode)
+    {
+        Array<u8> content;
+        b8 read = FALSE;
+        if (tryReadMounted(filePath, content, read))
+        {
+            // the mounts are not written through a mapping
+            return mapVirtualFile(filePath, read && mode == FILE_MODE_READ ? &content : nullptr);
+        }
+
+        return MapPhysicalFile(getPhysicalPath(filePath), mode);
+    }
+
+    FileHandle FileSystem::mapVirtualFile(const String &filePath, const Array<u8> *pContent)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+
+        FileHandle fileHandle = createFileEntry();
+        FileEntry *pFileEntry = getFileEntry(fileHandle);
+        RPP_ASSERT(pFileEntry != nullptr);
+
+        pFileEntry->id = fileHandle;
+        pFileEntry->name = filePath;
+        pFileEntry->mode = FILE_MODE_MAPPED;
+        pFileEntry->pFileHandle = nullptr;
+
+        if (pContent != nullptr)
+        {
+            MappedFile *pMappedFile = RPP_NEW(MappedFile);
+            pMappedFile->pData = nullptr;
+            pMappedFile->size = pContent->Size();
+            pMappedFile->isWritable = FALSE;
+            pMappedFile->isCopy = TRUE;
+#if defined(RPP_PLATFORM_WINDOWS)
+            pMappedFile->mapping = NULL;
+#endif
+            if (pMappedFile->size > 0)
+            {
+                pMappedFile->pData = static_cast<u8 *>(RPP_MALLOC(pMappedFile->size));
+                memcpy(pMappedFile->pData, pContent->Data(), pMappedFile->size);
+            }
+            pFileEntry->pFileHandle = pMappedFile;
+        }
+        return fileHandle;
+    }
+
+    FileHandle FileSystem::MapPhysicalFile(const String &filePath, u32 mode)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        RPP_ASSERT_MSG(mode == FILE_MODE_READ || mode == FILE_MODE_READ_WRITE, "A file can only be mapped for reading or reading and writing");
+        b8 isWritable = mode == FILE_MODE_READ_WRITE;
+
+        FileHandle fileHandle = createFileEntry();
+        FileEntry *pFileEntry = getFileEntry(fileHandle);
+        RPP_ASSERT(pFileEntry != nullptr);
+
+        pFileEntry->id = fileHandle;
+        pFileEntry->name = filePath;
+        pFileEntry->mode = FILE_MODE_MAPPED;
+        pFileEntry->pFileHandle = nullptr;
+
+#if defined(RPP_PLATFORM_WINDOWS)
+        DWORD access = isWritable ? GENERIC_READ | GENERIC_WRITE : GENERIC_READ;
+        HANDLE file = CreateFileA(filePath.CStr(), access, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_ATTRIBUTE_NORMAL, NULL);
+        if (file == INVALID_HANDLE_VALUE)
+        {
+            return fileHandle;
+        }
+
+        LARGE_INTEGER fileSize;
+        if (!GetFileSizeEx(file, &fileSize) || fileSize.QuadPart > LONGLONG(u32(-1)))
+        {
+            CloseHandle(file);
+            return fileHandle;
+        }
+
+        MappedFile *pMappedFile = RPP_NEW(MappedFile);
+        pMappedFile->pData = nullptr;
+        pMappedFile->size = static_cast<u32>(fileSize.QuadPart);
+        pMappedFile->isWritable = isWritable;
+        pMappedFile->isCopy = FALSE;
+        pMappedFile->mapping = NULL;
+
+        // a file of 0 bytes can not be mapped, it is still a valid (empty) mapping
+        if (pMappedFile->size > 0)
+        {
+            pMappedFile->mapping = CreateFileMappingA(file, NULL, isWritable ? PAGE_READWRITE : PAGE_READONLY, 0, 0, NULL);
+            if (pMappedFile->mapping != NULL)
+            {
+                DWORD viewAccess = isWritable ? FILE_MAP_WRITE : FILE_MAP_READ;
+                pMappedFile->pData = static_cast<u8 *>(MapViewOfFile(pMappedFile->mapping, viewAccess, 0, 0, 0));
+            }
+
+            if (pMappedFile->pData == nullptr)
+            {
+                if (pMappedFile->mapping != NULL)
+                {
+                    CloseHandle(pMappedFile->mapping);
+                }
+                RPP_DELETE(pMappedFile);
+                CloseHandle(file);
+                return fileHandle;
+            }
+        }
+
+        // the mapping keeps the file alive
+        CloseHandle(file);
+#else
+        i32 fd = open(filePath.CStr(), isWritable ? O_RDWR : O_RDONLY);
+        if (fd < 0)
+        {
+            return fileHandle;
+        }
+
+        struct stat fileStat;
+        if (fstat(fd, &fileStat) != 0 || !S_ISREG(fileStat.st_mode) || u64(fileStat.st_size) > u64(u32(-1)))
+        {
+            close(fd);
+            return fileHandle;
+        }
+
+        MappedFile *pMappedFile = RPP_NEW(MappedFile);
+        pMappedFile->pData = nullptr;
+        pMappedFile->size = static_cast<u32>(fileStat.st_size);
+        pMappedFile->isWritable = isWritable;
+        pMappedFile->isCopy = FALSE;
+
+        // a file of 0 bytes can not be mapped, it is still a valid (empty) mapping
+        if (pMappedFile->size > 0)
+        {
+            // a shared mapping writes the changes back to the file
+            i32 protection = isWritable ? PROT_READ | PROT_WRITE : PROT_READ;
+            void *pData = mmap(nullptr, pMappedFile->size, protection, isWritable ? MAP_SHARED : MAP_PRIVATE, fd, 0);
+            if (pData == MAP_FAILED)
+            {
+                RPP_DELETE(pMappedFile);
+                close(fd);
+                return fileHandle;
+            }
+            pMappedFile->pData = static_cast<u8 *>(pData);
+        }
+
+        // the mapping keeps the file alive
+        close(fd);
+#endif
+
+        pFileEntry->pFileHandle = pMappedFile;
         return fileHandle;
     }
 
+    b8 FileSystem::IsFileMapped(FileHandle file)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+
+        return pFileEntry->mode == FILE_MODE_MAPPED;
+    }
+
+    const u8 *FileSystem::GetMappedData(FileHandle file)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+        RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_MAPPED);
+
+        return static_cast<MappedFile *>(pFileEntry->pFileHandle)->pData;
+    }
+
+    u32 FileSystem::GetMappedSize(FileHandle file)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+        RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_MAPPED);
+
+        return static_cast<MappedFile *>(pFileEntry->pFileHandle)->size;
+    }
+
+    Span<const u8> FileSystem::GetMappedBytes(FileHandle file)
+    {
+        return Span<const u8>(GetMappedData(file), GetMappedSize(file));
+    }
+
+    Span<u8> FileSystem::GetMappedWritableBytes(FileHandle file)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+        RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_MAPPED);
+
+        MappedFile *pMappedFile = static_cast<MappedFile *>(pFileEntry->pFileHandle);
+        RPP_ASSERT_MSG(pMappedFile->isWritable, "The file {} is mapped for reading only", pFileEntry->name);
+
+        return Span<u8>(pMappedFile->pData, pMappedFile->size);
+    }
+
+    b8 FileSystem::FlushMappedFile(FileHandle file)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+        RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_MAPPED);
+
+        MappedFile *pMappedFile = static_cast<MappedFile *>(pFileEntry->pFileHandle);
+        if (!pMappedFile->isWritable || pMappedFile->pData == nullptr)
+        {
+            return TRUE; // nothing can have changed
+        }
+
+#if defined(RPP_PLATFORM_WINDOWS)
+        return FlushViewOfFile(pMappedFile->pData, 0) != 0;
+#else
+        return msync(pMappedFile->pData, pMappedFile->size, MS_SYNC) == 0;
+#endif
+    }
+
     b8 FileSystem::IsFileOpen(FileHandle file)
     {
         RPP_ASSERT(s_fileEntries != nullptr);
-        FileEntry *pFileEntry = s_fileEntries->Get(file);
+        FileEntry *pFileEntry = getFileEntry(file);
         RPP_ASSERT(pFileEntry != nullptr);
 
         return pFileEntry->pFileHandle != nullptr;
@@ -299,21 +830,36 @@ namespace rpp
     String FileSystem::Read(FileHandle file)
     {
         RPP_ASSERT(s_fileEntries != nullptr);
-        FileEntry *pFileEntry = s_fileEntries->Get(file);
+        FileEntry *pFileEntry = getFileEntry(file);
         RPP_ASSERT(pFileEntry != nullptr);
         RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
-        RPP_ASSERT(pFileEntry->mode == FILE_MODE_READ || pFileEntry->mode == FILE_MODE_READ_WRITE);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_READ || pFileEntry->mode == FILE_MODE_READ_WRITE ||
+                   pFileEntry->mode == FILE_MODE_VIRTUAL);
 
+        Array<u8> raw;
+        ReadBytes(file, raw);
+
+        // same output as joining std::getline results: lines are joined by '\n', the last newline is dropped
+        // and empty lines before the first non-empty one are skipped
         String content;
-        std::ifstream *pFileStream = static_cast<std::ifstream *>(pFileEntry->pFileHandle);
-        std::string line;
-        while (std::getline(*pFileStream, line))
+        content.Reserve(raw.Size());
+
+        const char *data = reinterpret_cast<const char *>(raw.Data());
+        u32 length = raw.Size();
+        u32 lineStart = 0;
+
+        while (lineStart < length)
         {
+            const char *newline = Simd::FindChar(data + lineStart, length - lineStart, '\n');
+            u32 lineEnd = newline != nullptr ? static_cast<u32>(newline - data) : length;
+
             if (content.Length() > 0)
             {
                 content += "\n";
             }
-            content += line.c_str();
+            content += StringView(data + lineStart, lineEnd - lineStart);
+
+            lineStart = lineEnd + 1;
         }
 
         return content;
@@ -322,60 +868,272 @@ namespace rpp
     void FileSystem::Write(FileHandle file, const String &data)
     {
         RPP_ASSERT(s_fileEntries != nullptr);
-        FileEntry *pFileEntry = s_fileEntries->Get(file);
+        FileEntry *pFileEntry = getFileEntry(file);
         RPP_ASSERT(pFileEntry != nullptr);
         RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
-        RPP_ASSERT(pFileEntry->mode == FILE_MODE_WRITE || pFileEntry->mode == FILE_MODE_APPEND || pFileEntry->mode == FILE_MODE_READ_WRITE);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_WRITE || pFileEntry->mode == FILE_MODE_APPEND ||
+                   pFileEntry->mode == FILE_MODE_READ_WRITE || pFileEntry->mode == FILE_MODE_VIRTUAL_WRITE);
+
+        std::ostream *pFileStream = GetOutputStream(pFileEntry->pFileHandle, pFileEntry->mode);
+        (*pFileStream) << data.CStr();
+        pFileStream->flush();
+    }
+
+    u32 FileSystem::ReadChunk(FileHandle file, char *buffer, u32 capacity)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+        RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_READ || pFileEntry->mode == FILE_MODE_READ_WRITE ||
+                   pFileEntry->mode == FILE_MODE_VIRTUAL);
+
+        std::istream *pFileStream = GetInputStream(pFileEntry->pFileHandle, pFileEntry->mode);
+
+        pFileStream->read(buffer, capacity);
+        return static_cast<u32>(pFileStream->gcount());
+    }
+
+    void FileSystem::WriteChunk(FileHandle file, const char *data, u32 length)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+        RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_WRITE || pFileEntry->mode == FILE_MODE_APPEND ||
+                   pFileEntry->mode == FILE_MODE_READ_WRITE || pFileEntry->mode == FILE_MODE_VIRTUAL_WRITE);
+
+        std::ostream *pFileStream = GetOutputStream(pFileEntry->pFileHandle, pFileEntry->mode);
+        pFileStream->write(data, length);
+    }
+
+    b8 FileSystem::ReadBytes(FileHandle file, Array<u8> &outBytes)
+    {
+        RPP_ASSERT(s_fileEntries != nullptr);
+        FileEntry *pFileEntry = getFileEntry(file);
+        RPP_ASSERT(pFileEntry != nullptr);
+        RPP_ASSERT(pFileEntry->pFileHandle != nullptr);
+        RPP_ASSERT(pFileEntry->mode == FILE_MODE_READ || pFileEntry->mode == FILE_MODE_READ_WRITE ||
+                   pFileEntry->mode == FILE_MODE_VIRTUAL);
+
+        std::istream *pFileStream = GetInputStream(pFileEntry->pFileHandle, pFileEntry->mode);
 
-        switch (pFileEntry->mode)
+        outBytes.Clear();
+        if (pFileStream->eof())
         {
-        case FILE_MODE_WRITE:
-        case FILE_MODE_APPEND:
+            return !pFileStream->bad(); // everything was already read
+        }
+
+        std::streampos start = pFileStream->tellg();
+        pFileStream->seekg(0, std::ios::end);
+        std::streampos end = pFileStream->tellg();
+        pFileStream->seekg(start);
+        if (start == std::streampos(-1) || end == std::streampos(-1) || !(*pFileStream) ||
+            u64(end - start) > u64(u32(-1)))
         {
-            std::ofstream *pFileStream = static_cast<std::ofstream *>(pFileEntry->pFileHandle);
-            (*pFileStream) << data.CStr();
-            pFileStream->flush();
-            break;
+            return FALSE;
         }
-        case FILE_MODE_READ_WRITE:
+
+        u32 size = static_cast<u32>(end - start);
+        if (size == 0)
+        {
+            return TRUE;
+        }
+
+        outBytes.Resize(size);
+        pFileStream->read(reinterpret_cast<char *>(outBytes.Data()), size);
+
+        // without FILE_MODE_BINARY the newlines may be translated, and fewer bytes are read than the size
+        outBytes.Resize(static_cast<u32>(pFileStream->gcount()));
+        return !pFileStream->bad();
+    }
+
+    void FileSystem::WriteBytes(FileHandle file, const u8 *data, u32 length)
+    {
+        WriteChunk(file, reinterpret_cast<const char *>(data), length);
+    }
+
+    b8 FileSystem::ReadAll(const String &filePath, Array<u8> &outBytes)
+    {
+        b8 read = FALSE;
+        if (tryReadMounted(filePath, outBytes, read))
+        {
+            return read;
+        }
+
+        outBytes.Clear();
+
+        FileHandle file = OpenPhysicalFile(getPhysicalPath(filePath), FILE_MODE_READ | FILE_MODE_BINARY);
+        read = IsFileOpen(file) && ReadBytes(file, outBytes);
+        CloseFile(file);
+
+        return read;
+    }
+
+    b8 FileSystem::WriteAll(const String &filePath, const u8 *data, u32 length)
+    {
+        b8 written = FALSE;
+        if (tryWriteMounted(filePath, data, length, written))
+        {
+            return written;
+        }
+
+        FileHandle file = OpenPhysicalFile(getPhysicalPath(filePath), FILE_MODE_WRITE | FILE_MODE_BINARY);
+        written = IsFileOpen(file);
+        if (written)
         {
-            std::fstream *pFileStream = static_cast<std::fstream *>(pFileEntry->pFileHandle);
-            (*pFileStream) << data.CStr();
+            std::ofstream *pFileStream = static_cast<std::ofstream *>(getFileEntry(file)->pFileHandle);
+            pFileStream->write(reinterpret_cast<const char *>(data), length);
             pFileStream->flush();
-            break;
+            written = !pFileStream->fail();
         }
-        default:
-            RPP_UNREACHABLE();
-        };
+        CloseFile(file);
 
-        RPP_UNUSED(data);
+        return written;
     }
 
     void FileSystem::CloseFile(FileHandle file)
     {
         RPP_ASSERT(s_fileEntries != nullptr);
 
+        std::lock_guard<std::mutex> lock(s_fileEntriesMutex);
         s_fileEntries->Free(file);
     }
 
+    FileHandle FileSystem::createFileEntry()
+    {
+        std::lock_guard<std::mutex> lock(s_fileEntriesMutex);
+        return s_fileEntries->Create();
+    }
+
+    FileSystem::FileEntry *FileSystem::getFileEntry(FileHandle file)
+    {
+        std::lock_guard<std::mutex> lock(s_fileEntriesMutex);
+        return s_fileEntries->Get(file);
+    }
+
     b8 FileSystem::PathExists(const String &path)
     {
-        RPP_UNUSED(path);
+        b8 exists = FALSE;
+        b8 isDirectory = FALSE;
+        if (tryFindMounted(path, exists, isDirectory))
+        {
+            return exists;
+        }
         return IsPhysicalPathExists(getPhysicalPath(path));
     }
 
     b8 FileSystem::IsDirectory(const String &path)
     {
+        b8 exists = FALSE;
+        b8 isDirectory = FALSE;
+        if (tryFindMounted(path, exists, isDirectory))
+        {
+            return isDirectory;
+        }
+
         String physicalPath = getPhysicalPath(path);
         return IsPhysicalPathDirectory(physicalPath);
     }
 
     void FileSystem::CreateDirectory(const String &path)
     {
+        // the directories of the memory and archive mounts only exist through their files
+        b8 exists = FALSE;
+        b8 isDirectory = FALSE;
+        if (tryFindMounted(path, exists, isDirectory))
+        {
+            return;
+        }
+
         String physicalPath = getPhysicalPath(path);
         CreatePhysicalDirectory(physicalPath);
     }
 
+    b8 FileSystem::ListDirectory(const String &directoryPath, Array<DirectoryEntry> &outEntries, StringView pattern)
+    {
+        b8 listed = FALSE;
+        if (tryListMounted(directoryPath, outEntries, pattern, listed))
+        {
+            return listed;
+        }
+
+        outEntries.Clear();
+
+        std::error_code error;
+        std::filesystem::directory_iterator iterator(getPhysicalPath(directoryPath).CStr(), error);
+        if (error)
+        {
+            return FALSE;
+        }
+
+        for (; iterator != std::filesystem::directory_iterator(); iterator.increment(error))
+        {
+            if (error)
+            {
+                return FALSE;
+            }
+
+            std::string name = iterator->path().filename().string();
+            StringView nameView(name.c_str(), static_cast<u32>(name.size()));
+            if (!MatchGlob(nameView, pattern))
+            {
+                continue;
+            }
+
+            DirectoryEntry entry = {};
+            entry.name = String(nameView.Data(), nameView.Length());
+            entry.isDirectory = iterator->is_directory(error);
+            outEntries.Push(std::move(entry));
+        }
+
+        // the order of the iterator depends on the filesystem
+        std::sort(outEntries.Data(), outEntries.Data() + outEntries.Size(),
+                  [](const DirectoryEntry &a, const DirectoryEntry &b)
+                  { return strcmp(a.name.CStr(), b.name.CStr()) < 0; });
+        return TRUE;
+    }
+
+    b8 FileSystem::MatchGlob(StringView name, StringView pattern)
+    {
+        u32 nameIndex = 0;
+        u32 patternIndex = 0;
+
+        // where to resume after the last `*` when the rest does not match: it swallows one more character
+        u32 starPatternIndex = u32(-1);
+        u32 starNameIndex = 0;
+
+        while (nameIndex < name.Length())
+        {
+            if (patternIndex < pattern.Length() && pattern[patternIndex] == '*')
+            {
+                starPatternIndex = patternIndex++;
+                starNameIndex = nameIndex;
+            }
+            else if (patternIndex < pattern.Length() &&
+                     (pattern[patternIndex] == '?' || pattern[patternIndex] == name[nameIndex]))
+            {
+                patternIndex++;
+                nameIndex++;
+            }
+            else if (starPatternIndex != u32(-1))
+            {
+                patternIndex = starPatternIndex + 1;
+                nameIndex = ++starNameIndex;
+            }
+            else
+            {
+                return FALSE;
+            }
+        }
+
+        while (patternIndex < pattern.Length() && pattern[patternIndex] == '*')
+        {
+            patternIndex++;
+        }
+        return patternIndex == pattern.Length();
+    }
+
     String FileSystem::CWD()
     {
         return s_cwd;
@@ -385,36 +1143,41 @@ namespace rpp
     {
         outParts.Clear();
 
-        String finalPath = path;
-        finalPath = finalPath.Replace("\\", "/", TRUE); // replace all backslashes with forward slashes
-
-        finalPath.Split(outParts, "/");
+        const char *pathData = path.CStr();
+        u32 pathLength = path.Length();
+        b8 isTestingEnvironment = s_temporaryPathRoot.Length() > 0;
+        u32 partStart = 0;
 
-        if (s_temporaryPathRoot != "")
+        // both forward and backward slashes are treated as separators, parts are views into `path` until pushed
+        for (u32 charIndex = 0; charIndex <= pathLength; ++charIndex)
         {
-            u32 partsCount = outParts.Size();
-            u32 index = 0;
+            if (charIndex < pathLength && pathData[charIndex] != '/' && pathData[charIndex] != '\\')
+            {
+                continue;
+            }
+
+            StringView part(pathData + partStart, charIndex - partStart);
+            partStart = charIndex + 1;
 
-            while (index < outParts.Size())
+            if (isTestingEnvironment)
             {
 #if RPP_PLATFORM_WINDOWS
-                if (outParts[index].Length() == 0)
+                if (part.Empty())
 #else
-                if (outParts[index].Length() == 0 && index > 0)
+                if (part.Empty() && outParts.Size() > 0)
 #endif
                 {
-                    outParts.Erase(index);
+                    continue;
                 }
-                else
+
+                if (part.EndsWith(":"))
                 {
-                    if (outParts[index].EndsWith(":"))
-                    {
-                        outParts[index] = outParts[index].ToLowerCase();
-                        outParts[index] = outParts[index].SubString(0, outParts[index].Length() - 1);
-                    }
-                    index++;
+                    outParts.Push(String(part.Data(), part.Length() - 1).ToLowerCase());
+                    continue;
                 }
             }
+
+            outParts.Push(String(part.Data(), part.Length()));
         }
     }
 } // namespace rpp
@@ -0,0 +1,935 @@
+#include "core/filesystem.h"
+#include "core/path.h"
+#include "core/format.h"
+#include "core/assertions.h"
+#include <algorithm>
+#include <cstring>
+#include <filesystem>
+#include <fstream>
+#include <mutex>
+
+/// The first bytes of an archive created by `FileSystem::CreateArchive`.
+#define ARCHIVE_MAGIC "RPAK"
+
+/// The layout of the archives written by this version, increased when the layout changes.
+#define ARCHIVE_FORMAT_VERSION 1
+
+/// The magic, the format version, the number of entries and the offset of the table of contents.
+#define ARCHIVE_HEADER_SIZE 16
+
+/// The smallest match of the LZ compression, shorter repetitions are stored as literals.
+#define LZ_MIN_MATCH 4
+
+/// The bytes at the end of the input which are always stored as literals (the matcher reads 4 bytes ahead).
+#define LZ_LAST_LITERALS 5
+
+/// log2 of the number of entries of the match finder of the LZ compression.
+#define LZ_HASH_BITS 12
+
+/// The most bytes one compressed byte can expand to (a length byte of 255), bounds the size of the LZ entries.
+#define LZ_MAX_EXPANSION 255
+
+namespace rpp
+{
+    namespace
+    {
+        enum class MountType : u8
+        {
+            DIRECTORY,
+            MEMORY,
+            ARCHIVE,
+            COUNT RPP_HIDE,
+        };
+
+        enum class ArchiveCompression : u8
+        {
+            NONE,
+            LZ,
+            COUNT RPP_HIDE,
+        };
+
+        struct MemoryFile
+        {
+            Path path; ///< Relative to the mount point.
+            Array<u8> bytes;
+        };
+
+        /**
+         * One file of the table of contents of an archive.
+         */
+        struct ArchiveEntry
+        {
+            Path path;      ///< Relative to the root of the archive.
+            u32 offset;     ///< The position of the stored bytes in the archive.
+            u32 storedSize; ///< The number of stored bytes (compressed or not).
+            u32 size;       ///< The size of the file once decompressed.
+            ArchiveCompression compression;
+        };
+
+        /**
+         * The open file of an archive mount. Shared with the reads in progress, which seek and read it without holding
+         * `s_mountsMutex`.
+         */
+        struct ArchiveFile
+        {
+            std::mutex mutex; ///< Protects the position of `stream`.
+            std::ifstream stream;
+        };
+
+        struct Mount
+        {
+            Path mountPoint;
+            MountType type;
+
+            String physicalDirectoryPath; ///< DIRECTORY: the directory which replaces the mount point.
+            Array<MemoryFile> files;      ///< MEMORY: the files written to the mount.
+
+            Array<ArchiveEntry> entries; ///< ARCHIVE: the table of contents, sorted by the hash of the paths.
+            Ref<ArchiveFile> pArchive;   ///< ARCHIVE: kept open, every read is one seek.
+        };
+
+        /// Protects `s_pMounts` and the content of the mounts: the files are read from the `IOQueue` workers too. The
+        /// archive entries are read and decompressed after it is released.
+        std::mutex s_mountsMutex;
+
+        Scope<Array<Mount *>> s_pMounts = nullptr;
+
+        /**
+         * @brief Finds the mount which holds a path, the deepest one when mount points are nested.
+         * @param outRelativePath The rest of the path after the mount point, empty for the mount point itself.
+         */
+        Mount *FindMount(const Path &path, String &outRelativePath)
+        {
+            Mount *pFound = nullptr;
+            StringView pathView = path;
+            for (u32 i = 0; i < s_pMounts->Size(); i++)
+            {
+                Mount *pMount = (*s_pMounts)[i];
+                StringView mountPoint = pMount->mountPoint;
+                if (pathView.Length() < mountPoint.Length() ||
+                    memcmp(pathView.Data(), mountPoint.Data(), mountPoint.Length()) != 0)
+                {
+                    continue;
+                }
+
+                // the mount point must end on a separator of the path ("/assets" does not hold "/assets2")
+                u32 restStart = mountPoint.Length();
+                b8 endsWithSeparator = mountPoint.Length() > 0 && mountPoint[mountPoint.Length() - 1] == '/';
+                if (restStart < pathView.Length() && !endsWithSeparator)
+                {
+                    if (pathView[restStart] != '/')
+                    {
+                        continue;
+                    }
+                    restStart++;
+                }
+
+                if (pFound == nullptr || pFound->mountPoint.Length() < mountPoint.Length())
+                {
+                    pFound = pMount;
+                    outRelativePath = String(pathView.Data() + restStart, pathView.Length() - restStart);
+                }
+            }
+            return pFound;
+        }
+
+        /**
+         * @brief Finds the memory or archive mount which holds a path (the directory mounts are resolved by
+         *      `getPhysicalPath`).
+         */
+        Mount *FindVirtualMount(const String &path, String &outRelativePath)
+        {
+            if (s_pMounts == nullptr || s_pMounts->Size() == 0)
+            {
+                return nullptr;
+            }
+
+            Mount *pMount = FindMount(Path(path), outRelativePath);
+            return pMount != nullptr && pMount->type != MountType::DIRECTORY ? pMount : nullptr;
+        }
+
+        const ArchiveEntry *FindArchiveEntry(const Mount &mount, const Path &path)
+        {
+            const ArchiveEntry *pBegin = mount.entries.Data();
+            const ArchiveEntry *pEnd = pBegin + mount.entries.Size();
+            const ArchiveEntry *pEntry = std::lower_bound(pBegin, pEnd, path.GetHash(),
+                                                          [](const ArchiveEntry &entry, u32 hash)
+                                                          { return entry.path.GetHash() < hash; });
+            for (; pEntry != pEnd && pEntry->path.GetHash() == path.GetHash(); pEntry++)
+            {
+                if (pEntry->path == path)
+                {
+                    return pEntry;
+                }
+            }
+            return nullptr;
+        }
+
+        MemoryFile *FindMemoryFile(Mount &mount, const Path &path)
+        {
+            for (u32 i = 0; i < mount.files.Size(); i++)
+            {
+                if (mount.files[i].path == path)
+                {
+                    return &mount.files[i];
+                }
+            }
+            return nullptr;
+        }
+
+        /**
+         * @brief Calls `visitor(relativePath)` for every file of a memory or archive mount.
+         */
+        template <typename Visitor>
+        void VisitMountedFiles(const Mount &mount, Visitor visitor)
+        {
+            if (mount.type == MountType::MEMORY)
+            {
+                for (u32 i = 0; i < mount.files.Size(); i++)
+                {
+                    visitor(mount.files[i].path.GetString());
+                }
+            }
+            else
+            {
+                for (u32 i = 0; i < mount.entries.Size(); i++)
+                {
+                    visitor(mount.entries[i].path.GetString());
+                }
+            }
+        }
+
+        /**
+         * @brief Checks if a file of a mount is inside a directory of the same mount, and returns the part of its path
+         *      after the directory.
+         */
+        b8 GetPathInsideDirectory(const String &filePath, const String &directoryPath, StringView &outRest)
+        {
+            if (directoryPath.Length() == 0)
+            {
+                outRest = filePath;
+                return TRUE;
+            }
+
+            if (filePath.Length() <= directoryPath.Length() + 1 || !filePath.StartsWith(directoryPath) ||
+                filePath.CStr()[directoryPath.Length()] != '/')
+            {
+                return FALSE;
+            }
+
+            outRest = StringView(filePath.CStr() + directoryPath.Length() + 1,
+                                 filePath.Length() - directoryPath.Length() - 1);
+            return TRUE;
+        }
+
+        /**
+         * @brief Appends a block of bytes with one copy, the capacity grows geometrically like `Array::Push`.
+         */
+        void AppendBytes(Array<u8> &bytes, const u8 *data, u32 length)
+        {
+            if (length == 0)
+            {
+                return;
+            }
+
+            u32 size = bytes.Size();
+            if (size + length > bytes.Capacity())
+            {
+                bytes.Reallocate(std::max(bytes.Capacity() * 2, size + length));
+            }
+            bytes.Resize(size + length);
+            memcpy(bytes.Data() + size, data, length);
+        }
+
+        void AppendU32(Array<u8> &bytes, u32 value)
+        {
+            u8 encoded[4] = {u8(value), u8(value >> 8), u8(value >> 16), u8(value >> 24)};
+            AppendBytes(bytes, encoded, sizeof(encoded));
+        }
+
+        u32 ReadU32(const u8 *data)
+        {
+            return u32(data[0]) | (u32(data[1]) << 8) | (u32(data[2]) << 16) | (u32(data[3]) << 24);
+        }
+
+        void AppendLength(Array<u8> &output, u32 length)
+        {
+            for (; length >= 255; length -= 255)
+            {
+                output.Push(255);
+            }
+            output.Push(u8(length));
+        }
+
+        void AppendSequence(Array<u8> &output, const u8 *literals, u32 literalCount, u32 matchOffset, u32 matchLength)
+        {
+            u32 extraMatch = matchLength > 0 ? matchLength - LZ_MIN_MATCH : 0;
+            output.Push(u8((literalCount < 15 ? literalCount : 15) << 4 | (extraMatch < 15 ? extraMatch : 15)));
+            if (literalCount >= 15)
+            {
+                AppendLength(output, literalCount - 15);
+            }
+
+            AppendBytes(output, literals, literalCount);
+
+            if (matchLength > 0)
+            {
+                output.Push(u8(matchOffset));
+                output.Push(u8(matchOffset >> 8));
+                if (extraMatch >= 15)
+                {
+                    AppendLength(output, extraMatch - 15);
+                }
+            }
+        }
+
+        /**
+         * @brief Compresses with a LZ77 scheme (the block layout of LZ4): every sequence is a token, the literals, then
+         *      a 16-bit offset back to the repeated bytes; the last sequence only has literals.
+         */
+        void CompressLZ(const u8 *data, u32 size, Array<u8> &output)
+        {
+            output.Clear();
+
+            u32 table[1 << LZ_HASH_BITS];
+            for (u32 i = 0; i < (1 << LZ_HASH_BITS); i++)
+            {
+                table[i] = u32(-1);
+            }
+
+            u32 anchor = 0;
+            u32 index = 0;
+            while (size >= LZ_MIN_MATCH + LZ_LAST_LITERALS && index <= size - LZ_MIN_MATCH - LZ_LAST_LITERALS)
+            {
+                u32 sequence;
+                memcpy(&sequence, data + index, sizeof(sequence));
+                u32 hash = (sequence * 2654435761u) >> (32 - LZ_HASH_BITS);
+                u32 candidate = table[hash];
+                table[hash] = index;
+
+                if (candidate == u32(-1) || index - candidate > 0xFFFF || memcmp(data + candidate, data + index, LZ_MIN_MATCH) != 0)
+                {
+                    index++;
+                    continue;
+                }
+
+                u32 matchLength = LZ_MIN_MATCH;
+                while (index + matchLength < size - LZ_LAST_LITERALS && data[candidate + matchLength] == data[index + matchLength])
+                {
+                    matchLength++;
+                }
+
+                AppendSequence(output, data + anchor, index - anchor, index - candidate, matchLength);
+                index += matchLength;
+                anchor = index;
+            }
+
+            AppendSequence(output, data + anchor, size - anchor, 0, 0);
+        }
+
+        b8 ReadLength(const u8 *input, u32 inputSize, u32 &index, u32 &length)
+        {
+            u8 byte = 255;
+            while (byte == 255)
+            {
+                if (index >= inputSize)
+                {
+                    return FALSE;
+                }
+                byte = input[index++];
+                length += byte;
+            }
+            return TRUE;
+        }
+
+        /**
+         * @brief Reverses `CompressLZ`. The input comes from a file, every length and offset is checked.
+         * @return FALSE if the input is corrupted or does not decompress to exactly `outputSize` bytes.
+         */
+        b8 DecompressLZ(const u8 *input, u32 inputSize, u8 *output, u32 outputSize)
+        {
+            u32 inputIndex = 0;
+            u32 outputIndex = 0;
+            while (inputIndex < inputSize)
+            {
+                u8 token = input[inputIndex++];
+
+                u32 literalCount = token >> 4;
+                if (literalCount == 15 && !ReadLength(input, inputSize, inputIndex, literalCount))
+                {
+                    return FALSE;
+                }
+                if (literalCount > inputSize - inputIndex || literalCount > outputSize - outputIndex)
+                {
+                    return FALSE;
+                }
+                memcpy(output + outputIndex, input + inputIndex, literalCount);
+                inputIndex += literalCount;
+                outputIndex += literalCount;
+
+                if (inputIndex == inputSize)
+                {
+                    break; // the last sequence has no match
+                }
+
+                if (inputSize - inputIndex < 2)
+                {
+                    return FALSE;
+                }
+                u32 offset = u32(input[inputIndex]) | (u32(input[inputIndex + 1]) << 8);
+                inputIndex += 2;
+
+                u32 matchLength = token & 0x0F;
+                if (matchLength == 15 && !ReadLength(input, inputSize, inputIndex, matchLength))
+                {
+                    return FALSE;
+                }
+                matchLength += LZ_MIN_MATCH;
+
+                if (offset == 0 || offset > outputIndex || matchLength > outputSize - outputIndex)
+                {
+                    return FALSE;
+                }
+
+                // byte by byte: the match may overlap the bytes it produces
+                for (u32 i = 0; i < matchLength; i++, outputIndex++)
+                {
+                    output[outputIndex] = output[outputIndex - offset];
+                }
+            }
+
+            return outputIndex == outputSize;
+        }
+
+        b8 ReadArchiveEntry(ArchiveFile &archive, const ArchiveEntry &entry, Array<u8> &outBytes)
+        {
+            Array<u8> stored;
+            stored.Resize(entry.storedSize);
+
+            {
+                std::lock_guard<std::mutex> lock(archive.mutex);
+                archive.stream.clear();
+                archive.stream.seekg(entry.offset);
+                archive.stream.read(reinterpret_cast<char *>(stored.Data()), entry.storedSize);
+                if (static_cast<u32>(archive.stream.gcount()) != entry.storedSize)
+                {
+                    return FALSE;
+                }
+            }
+
+            if (entry.compression == ArchiveCompression::NONE)
+            {
+                outBytes = std::move(stored);
+                return TRUE;
+            }
+
+            outBytes.Resize(entry.size);
+            return DecompressLZ(stored.Data(), stored.Size(), outBytes.Data(), entry.size);
+        }
+
+        /**
+         * @brief Reads and checks the table of contents of an archive.
+         */
+        b8 LoadArchive(Mount &mount, const String &physicalPath)
+        {
+            mount.pArchive = CreateRef<ArchiveFile>();
+            std::ifstream &archive = mount.pArchive->stream;
+            archive.open(physicalPath.CStr(), std::ios::in | std::ios::binary);
+            if (!archive.is_open())
+            {
+                return FALSE;
+            }
+
+            archive.seekg(0, std::ios::end);
+            u64 archiveSize = static_cast<u64>(archive.tellg());
+            archive.seekg(0);
+
+            u8 header[ARCHIVE_HEADER_SIZE];
+            archive.read(reinterpret_cast<char *>(header), ARCHIVE_HEADER_SIZE);
+            if (archive.gcount() != ARCHIVE_HEADER_SIZE || memcmp(header, ARCHIVE_MAGIC, 4) != 0 ||
+                ReadU32(header + 4) != ARCHIVE_FORMAT_VERSION)
+            {
+                return FALSE;
+            }
+
+            u32 entryCount = ReadU32(header + 8);
+            u32 tableOffset = ReadU32(header + 12);
+            if (tableOffset < ARCHIVE_HEADER_SIZE || tableOffset > archiveSize)
+            {
+                return FALSE;
+            }
+
+            Array<u8> table;
+            table.Resize(static_cast<u32>(archiveSize - tableOffset));
+            archive.seekg(tableOffset);
+            archive.read(reinterpret_cast<char *>(table.Data()), table.Size());
+            if (static_cast<u32>(archive.gcount()) != table.Size())
+            {
+                return FALSE;
+            }
+
+            // every entry: offset, stored size, size, compression, path length, path
+            u32 index = 0;
+            for (u32 i = 0; i < entryCount; i++)
+            {
+                if (table.Size() - index < 17)
+                {
+                    return FALSE;
+                }
+
+                ArchiveEntry entry = {};
+                entry.offset = ReadU32(table.Data() + index);
+                entry.storedSize = ReadU32(table.Data() + index + 4);
+                entry.size = ReadU32(table.Data() + index + 8);
+                entry.compression = ArchiveCompression(table[index + 12]);
+                u32 pathLength = ReadU32(table.Data() + index + 13);
+                index += 17;
+
+                if (pathLength > table.Size() - index || entry.compression >= ArchiveCompression::COUNT ||
+                    u64(entry.offset) + entry.storedSize > tableOffset)
+                {
+                    return FALSE;
+                }
+
+                // the size is used for the allocation of the read, it must be reachable from the stored bytes
+                b8 isSizeValid = entry.compression == ArchiveCompression::NONE
+                                     ? entry.size == entry.storedSize
+                                     : u64(entry.size) <= u64(entry.storedSize) * LZ_MAX_EXPANSION;
+                if (!isSizeValid)
+                {
+                    return FALSE;
+                }
+
+                entry.path = Path(StringView(reinterpret_cast<const char *>(table.Data() + index), pathLength));
+                index += pathLength;
+                mount.entries.Push(std::move(entry));
+            }
+
+            std::sort(mount.entries.Data(), mount.entries.Data() + mount.entries.Size(),
+                      [](const ArchiveEntry &a, const ArchiveEntry &b)
+                      { return a.path.GetHash() < b.path.GetHash(); });
+            return TRUE;
+        }
+
+        b8 AddMount(Mount *pMount)
+        {
+            std::lock_guard<std::mutex> lock(s_mountsMutex);
+            for (u32 i = 0; i < s_pMounts->Size(); i++)
+            {
+                if ((*s_pMounts)[i]->mountPoint == pMount->mountPoint)
+                {
+                    RPP_DELETE(pMount);
+                    return FALSE;
+                }
+            }
+
+            s_pMounts->Push(pMount);
+            return TRUE;
+        }
+    } // namespace
+
+    void FileSystem::initializeMounts()
+    {
+        RPP_ASSERT(s_pMounts == nullptr);
+        s_pMounts = CreateScope<Array<Mount *>>();
+    }
+
+    void FileSystem::shutdownMounts()
+    {
+        RPP_ASSERT(s_pMounts != nullptr);
+
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        for (u32 i = 0; i < s_pMounts->Size(); i++)
+        {
+            RPP_DELETE((*s_pMounts)[i]);
+        }
+        s_pMounts.reset();
+    }
+
+    b8 FileSystem::MountDirectory(const String &mountPoint, const String &physicalDirectoryPath)
+    {
+        RPP_ASSERT(s_pMounts != nullptr);
+
+        if (!IsPhysicalPathDirectory(physicalDirectoryPath))
+        {
+            return FALSE;
+        }
+
+        Mount *pMount = RPP_NEW(Mount);
+        pMount->mountPoint = Path(mountPoint);
+        pMount->type = MountType::DIRECTORY;
+        pMount->physicalDirectoryPath = Path(physicalDirectoryPath).GetString();
+
+        return AddMount(pMount);
+    }
+
+    b8 FileSystem::MountMemory(const String &mountPoint)
+    {
+        RPP_ASSERT(s_pMounts != nullptr);
+
+        Mount *pMount = RPP_NEW(Mount);
+        pMount->mountPoint = Path(mountPoint);
+        pMount->type = MountType::MEMORY;
+        return AddMount(pMount);
+    }
+
+    b8 FileSystem::MountArchive(const String &mountPoint, const String &archivePath)
+    {
+        RPP_ASSERT(s_pMounts != nullptr);
+
+        Mount *pMount = RPP_NEW(Mount);
+        pMount->mountPoint = Path(mountPoint);
+        pMount->type = MountType::ARCHIVE;
+        if (!LoadArchive(*pMount, getPhysicalPath(archivePath)))
+        {
+            RPP_DELETE(pMount);
+            return FALSE;
+        }
+        return AddMount(pMount);
+    }
+
+    b8 FileSystem::Unmount(const String &mountPoint)
+    {
+        RPP_ASSERT(s_pMounts != nullptr);
+
+        Path path(mountPoint);
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        for (u32 i = 0; i < s_pMounts->Size(); i++)
+        {
+            if ((*s_pMounts)[i]->mountPoint == path)
+            {
+                RPP_DELETE((*s_pMounts)[i]);
+                s_pMounts->Erase(static_cast<i32>(i));
+                return TRUE;
+            }
+        }
+        return FALSE;
+    }
+
+    b8 FileSystem::CreateArchive(const String &archivePath, const String &sourceDirectoryPath, b8 compress)
+    {
+        String physicalSource = getPhysicalPath(sourceDirectoryPath);
+
+        // sorted, so that the same files always give the same archive
+        Array<String> relativePaths;
+        std::error_code error;
+        std::filesystem::recursive_directory_iterator iterator(physicalSource.CStr(), error);
+        if (error)
+        {
+            return FALSE;
+        }
+        for (; iterator != std::filesystem::recursive_directory_iterator(); iterator.increment(error))
+        {
+            if (error)
+            {
+                return FALSE;
+            }
+            if (iterator->is_regular_file(error))
+            {
+                std::string relativePath = iterator->path().lexically_relative(physicalSource.CStr()).generic_string();
+                relativePaths.Push(Path(StringView(relativePath.c_str(), static_cast<u32>(relativePath.size()))).GetString());
+            }
+        }
+        std::sort(relativePaths.Data(), relativePaths.Data() + relativePaths.Size(),
+                  [](const String &a, const String &b)
+                  { return strcmp(a.CStr(), b.CStr()) < 0; });
+
+        Array<u8> archive;
+        archive.Resize(ARCHIVE_HEADER_SIZE);
+
+        Array<u8> table;
+        Array<u8> bytes;
+        Array<u8> compressed;
+        for (u32 i = 0; i < relativePaths.Size(); i++)
+        {
+            FileHandle file = OpenPhysicalFile(Format("{}/{}", physicalSource, relativePaths[i]),
+                                               FILE_MODE_READ | FILE_MODE_BINARY);
+            b8 read = IsFileOpen(file) && ReadBytes(file, bytes);
+            CloseFile(file);
+            if (!read)
+            {
+                return FALSE;
+            }
+
+            // the entries which do not shrink are stored as they are
+            ArchiveCompression compression = ArchiveCompression::NONE;
+            if (compress)
+            {
+                CompressLZ(bytes.Data(), bytes.Size(), compressed);
+                compression = compressed.Size() < bytes.Size() ? ArchiveCompression::LZ : ArchiveCompression::NONE;
+            }
+            const Array<u8> &stored = compression == ArchiveCompression::LZ ? compressed : bytes;
+
+            AppendU32(table, archive.Size());
+            AppendU32(table, stored.Size());
+            AppendU32(table, bytes.Size());
+            table.Push(u8(compression));
+            AppendU32(table, relativePaths[i].Length());
+            AppendBytes(table, reinterpret_cast<const u8 *>(relativePaths[i].CStr()), relativePaths[i].Length());
+
+            AppendBytes(archive, stored.Data(), stored.Size());
+        }
+
+        u32 tableOffset = archive.Size();
+        AppendBytes(archive, table.Data(), table.Size());
+
+        memcpy(archive.Data(), ARCHIVE_MAGIC, 4);
+        u8 *pHeader = archive.Data() + 4;
+        u32 headerValues[3] = {ARCHIVE_FORMAT_VERSION, relativePaths.Size(), tableOffset};
+        for (u32 v = 0; v < 3; v++)
+        {
+            for (u32 i = 0; i < 4; i++)
+            {
+                pHeader[v * 4 + i] = u8(headerValues[v] >> (i * 8));
+            }
+        }
+
+        return WriteAll(archivePath, archive.Data(), archive.Size());
+    }
+
+    b8 FileSystem::tryResolveDirectoryMount(const String &path, String &outPhysicalPath)
+    {
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        if (s_pMounts == nullptr || s_pMounts->Size() == 0)
+        {
+            return FALSE;
+        }
+
+        String relativePath;
+        Mount *pMount = FindMount(Path(path), relativePath);
+        if (pMount == nullptr || pMount->type != MountType::DIRECTORY)
+        {
+            return FALSE;
+        }
+
+        outPhysicalPath = relativePath.Length() > 0 ? Format("{}/{}", pMount->physicalDirectoryPath, relativePath)
+                                                    : pMount->physicalDirectoryPath;
+        return TRUE;
+    }
+
+    b8 FileSystem::tryReadMounted(const String &path, Array<u8> &outBytes, b8 &outRead)
+    {
+        // the entry is copied under the lock, the archive file is kept alive by its reference if the mount goes away
+        ArchiveEntry entry = {};
+        Ref<ArchiveFile> pArchive = nullptr;
+        {
+            std::lock_guard<std::mutex> lock(s_mountsMutex);
+            String relativePath;
+            Mount *pMount = FindVirtualMount(path, relativePath);
+            if (pMount == nullptr)
+            {
+                return FALSE;
+            }
+
+            outRead = FALSE;
+            outBytes.Clear();
+            if (pMount->type == MountType::MEMORY)
+            {
+                MemoryFile *pFile = FindMemoryFile(*pMount, Path(relativePath));
+                if (pFile != nullptr)
+                {
+                    outBytes = pFile->bytes;
+                    outRead = TRUE;
+                }
+                return TRUE;
+            }
+
+            const ArchiveEntry *pEntry = FindArchiveEntry(*pMount, Path(relativePath));
+            if (pEntry == nullptr)
+            {
+                return TRUE;
+            }
+            entry = *pEntry;
+            pArchive = pMount->pArchive;
+        }
+
+        outRead = ReadArchiveEntry(*pArchive, entry, outBytes);
+        return TRUE;
+    }
+
+    b8 FileSystem::tryWriteMounted(const String &path, const u8 *data, u32 length, b8 &outWritten)
+    {
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        String relativePath;
+        Mount *pMount = FindVirtualMount(path, relativePath);
+        if (pMount == nullptr)
+        {
+            return FALSE;
+        }
+
+        // the archives are read-only
+        outWritten = pMount->type == MountType::MEMORY && relativePath.Length() > 0;
+        if (outWritten)
+        {
+            Path filePath(relativePath);
+            MemoryFile *pFile = FindMemoryFile(*pMount, filePath);
+            if (pFile == nullptr)
+            {
+                MemoryFile file = {};
+                file.path = filePath;
+                pMount->files.Push(std::move(file));
+                pFile = &pMount->files[pMount->files.Size() - 1];
+            }
+
+            pFile->bytes.Clear();
+            AppendBytes(pFile->bytes, data, length);
+        }
+        return TRUE;
+    }
+
+    b8 FileSystem::tryDeleteMounted(const String &path)
+    {
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        String relativePath;
+        Mount *pMount = FindVirtualMount(path, relativePath);
+        if (pMount == nullptr)
+        {
+            return FALSE;
+        }
+
+        if (pMount->type == MountType::MEMORY)
+        {
+            Path filePath(relativePath);
+            for (u32 i = 0; i < pMount->files.Size(); i++)
+            {
+                if (pMount->files[i].path == filePath)
+                {
+                    pMount->files.Erase(static_cast<i32>(i));
+                    break;
+                }
+            }
+        }
+        return TRUE;
+    }
+
+    b8 FileSystem::tryRenameMounted(const String &sourcePath, const String &destinationPath, b8 &outRenamed)
+    {
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        String sourceRelativePath;
+        String destinationRelativePath;
+        Mount *pMount = FindVirtualMount(sourcePath, sourceRelativePath);
+        Mount *pDestinationMount = FindVirtualMount(destinationPath, destinationRelativePath);
+        if (pMount == nullptr && pDestinationMount == nullptr)
+        {
+            return FALSE;
+        }
+
+        // the files only move inside a memory mount
+        outRenamed = FALSE;
+        if (pMount != pDestinationMount || pMount->type != MountType::MEMORY || destinationRelativePath.Length() == 0)
+        {
+            return TRUE;
+        }
+
+        Path sourceFilePath(sourceRelativePath);
+        Path destinationFilePath(destinationRelativePath);
+        i32 sourceIndex = -1;
+        i32 destinationIndex = -1;
+        for (u32 i = 0; i < pMount->files.Size(); i++)
+        {
+            if (pMount->files[i].path == sourceFilePath)
+            {
+                sourceIndex = static_cast<i32>(i);
+            }
+            else if (pMount->files[i].path == destinationFilePath)
+            {
+                destinationIndex = static_cast<i32>(i);
+            }
+        }
+
+        outRenamed = sourceIndex >= 0;
+        if (!outRenamed)
+        {
+            return TRUE;
+        }
+
+        // the destination is replaced
+        pMount->files[static_cast<u32>(sourceIndex)].path = destinationFilePath;
+        if (destinationIndex >= 0)
+        {
+            pMount->files.Erase(destinationIndex);
+        }
+        return TRUE;
+    }
+
+    b8 FileSystem::tryFindMounted(const String &path, b8 &outExists, b8 &outIsDirectory)
+    {
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        String relativePath;
+        Mount *pMount = FindVirtualMount(path, relativePath);
+        if (pMount == nullptr)
+        {
+            return FALSE;
+        }
+
+        // the directories of a mount are the parents of its files, the mount point always exists
+        outExists = relativePath.Length() == 0;
+        outIsDirectory = outExists;
+        VisitMountedFiles(*pMount, [&](const String &filePath)
+                          {
+                              StringView rest;
+                              if (filePath == relativePath)
+                              {
+                                  outExists = TRUE;
+                              }
+                              else if (GetPathInsideDirectory(filePath, relativePath, rest))
+                              {
+                                  outExists = TRUE;
+                                  outIsDirectory = TRUE;
+                              } });
+        return TRUE;
+    }
+
+    b8 FileSystem::tryListMounted(const String &path, Array<DirectoryEntry> &outEntries, StringView pattern,
+                                  b8 &outListed)
+    {
+        std::lock_guard<std::mutex> lock(s_mountsMutex);
+        String relativePath;
+        Mount *pMount = FindVirtualMount(path, relativePath);
+        if (pMount == nullptr)
+        {
+            return FALSE;
+        }
+
+        outEntries.Clear();
+        outListed = relativePath.Length() == 0;
+        VisitMountedFiles(*pMount, [&](const String &filePath)
+                          {
+                              StringView rest;
+                              if (!GetPathInsideDirectory(filePath, relativePath, rest))
+                              {
+                                  return;
+                              }
+                              outListed = TRUE;
+
+                              // only the first part of the rest, the deeper files show up as their directory
+                              u32 nameLength = 0;
+                              while (nameLength < rest.Length() && rest[nameLength] != '/')
+                              {
+                                  nameLength++;
+                              }
+                              StringView name(rest.Data(), nameLength);
+                              if (!MatchGlob(name, pattern))
+                              {
+                                  return;
+                              }
+
+                              for (u32 i = 0; i < outEntries.Size(); i++)
+                              {
+                                  if (outEntries[i].name == name)
+                                  {
+                                      return;
+                                  }
+                              }
+
+                              DirectoryEntry entry = {};
+                              entry.name = String(name.Data(), name.Length());
+                              entry.isDirectory = nameLength < rest.Length();
+                              outEntries.Push(std::move(entry)); });
+
+        std::sort(outEntries.Data(), outEntries.Data() + outEntries.Size(),
+                  [](const DirectoryEntry &a, const DirectoryEntry &b)
+                  { return strcmp(a.name.CStr(), b.name.CStr()) < 0; });
+        return TRUE;
+    }
+} // namespace rpp
@@ -0,0 +1,435 @@
+#include "core/filesystem.h"
+#include "core/format.h"
+#include "core/assertions.h"
+#include <chrono>
+
+#if defined(RPP_PLATFORM_WINDOWS)
+#include <windows.h>
+#undef CreateDirectory
+#undef DeleteFile
+#else
+#include <sys/inotify.h>
+#include <unistd.h>
+#endif
+
+/// How long the changes of a file are held after its last change (in milliseconds), so that a save made of several
+/// writes is reported once.
+#define FILESYSTEM_WATCH_COALESCE_DELAY 50
+
+/// The size of the buffer receiving the notifications of the OS.
+#define FILESYSTEM_WATCH_BUFFER_SIZE 16384
+
+namespace rpp
+{
+    namespace
+    {
+        /**
+         * One directory watched with `FileSystem::Watch`.
+         */
+        struct WatchEntry
+        {
+            String directoryPath; ///< The logical path given to `Watch`.
+            FileWatchCallback callback;
+#if defined(RPP_PLATFORM_WINDOWS)
+            HANDLE directory;
+            OVERLAPPED overlapped; ///< The pending `ReadDirectoryChangesW`, its event is set when changes are ready.
+            DWORD buffer[FILESYSTEM_WATCH_BUFFER_SIZE / sizeof(DWORD)];
+#else
+            i32 descriptor; ///< The inotify watch descriptor, shared by the entries watching the same directory.
+#endif
+        };
+
+        /**
+         * The changes of one file received from the OS and not dispatched yet.
+         */
+        struct PendingChange
+        {
+            WatchHandle watch;
+            String name;
+            u8 changes;
+            std::chrono::steady_clock::time_point lastChangeTime;
+        };
+
+        /**
+         * The state of the watches, only used from the main thread.
+         */
+        struct WatchState
+        {
+            Array<WatchEntry *> watches; ///< Indexed by the handles, nullptr for a stopped watch (its handle is reused).
+            Array<PendingChange> pendingChanges;
+#if !defined(RPP_PLATFORM_WINDOWS)
+            i32 inotifyDescriptor; ///< Created with the first watch, -1 before.
+#endif
+        };
+
+        Scope<WatchState> s_pWatchState = nullptr;
+
+        WatchEntry *GetWatchEntry(WatchHandle watch)
+        {
+            return watch < s_pWatchState->watches.Size() ? s_pWatchState->watches[watch] : nullptr;
+        }
+
+        WatchHandle CreateWatchEntry()
+        {
+            Array<WatchEntry *> &watches = s_pWatchState->watches;
+            WatchEntry *pEntry = RPP_NEW(WatchEntry);
+            for (u32 i = 0; i < watches.Size(); i++)
+            {
+                if (watches[i] == nullptr)
+                {
+                    watches[i] = pEntry;
+                    return i;
+                }
+            }
+            watches.Push(pEntry);
+            return watches.Size() - 1;
+        }
+
+        void DestroyWatchEntry(WatchHandle watch)
+        {
+            RPP_DELETE(s_pWatchState->watches[watch]);
+            s_pWatchState->watches[watch] = nullptr;
+        }
+
+        /**
+         * @brief Merges a change into the pending change of the same file, which restarts its delay.
+         */
+        void QueueChange(WatchHandle watch, StringView name, u8 changes)
+        {
+            auto now = std::chrono::steady_clock::now();
+
+            Array<PendingChange> &pendingChanges = s_pWatchState->pendingChanges;
+            for (u32 i = 0; i < pendingChanges.Size(); i++)
+            {
+                PendingChange &pendingChange = pendingChanges[i];
+                if (pendingChange.watch == watch && pendingChange.name == name)
+                {
+                    pendingChange.changes |= changes;
+                    pendingChange.lastChangeTime = now;
+                    return;
+                }
+            }
+
+            PendingChange pendingChange = {};
+            pendingChange.watch = watch;
+            pendingChange.name = String(name.Data(), name.Length());
+            pendingChange.changes = changes;
+            pendingChange.lastChangeTime = now;
+            pendingChanges.Push(std::move(pendingChange));
+        }
+
+#if defined(RPP_PLATFORM_WINDOWS)
+        b8 RequestChanges(WatchEntry *pEntry)
+        {
+            DWORD filter = FILE_NOTIFY_CHANGE_FILE_NAME | FILE_NOTIFY_CHANGE_DIR_NAME | FILE_NOTIFY_CHANGE_LAST_WRITE |
+                           FILE_NOTIFY_CHANGE_SIZE;
+            ResetEvent(pEntry->overlapped.hEvent);
+            return ReadDirectoryChangesW(pEntry->directory, pEntry->buffer, sizeof(pEntry->buffer), FALSE, filter,
+                                         nullptr, &pEntry->overlapped, nullptr) != 0;
+        }
+
+        void StopWatching(WatchEntry *pEntry)
+        {
+            CancelIoEx(pEntry->directory, &pEntry->overlapped);
+            DWORD transferred = 0;
+            GetOverlappedResult(pEntry->directory, &pEntry->overlapped, &transferred, TRUE);
+            CloseHandle(pEntry->overlapped.hEvent);
+            CloseHandle(pEntry->directory);
+        }
+
+        void ReadChanges(WatchHandle watch, WatchEntry *pEntry)
+        {
+            DWORD transferred = 0;
+            if (!GetOverlappedResult(pEntry->directory, &pEntry->overlapped, &transferred, FALSE))
+            {
+                return; // nothing yet (ERROR_IO_INCOMPLETE)
+            }
+
+            // 0 bytes means the buffer overflowed and the changes are lost
+            const u8 *pData = reinterpret_cast<const u8 *>(pEntry->buffer);
+            while (transferred > 0)
+            {
+                const FILE_NOTIFY_INFORMATION *pInfo = reinterpret_cast<const FILE_NOTIFY_INFORMATION *>(pData);
+
+                char name[MAX_PATH * 4];
+                i32 nameLength = WideCharToMultiByte(CP_UTF8, 0, pInfo->FileName, pInfo->FileNameLength / sizeof(WCHAR),
+                                                     name, sizeof(name), nullptr, nullptr);
+                for (i32 i = 0; i < nameLength; i++)
+                {
+                    name[i] = name[i] == '\\' ? '/' : name[i];
+                }
+
+                switch (pInfo->Action)
+                {
+                case FILE_ACTION_ADDED:
+                case FILE_ACTION_RENAMED_NEW_NAME:
+                    QueueChange(watch, StringView(name, nameLength), FILE_CHANGE_CREATED);
+                    break;
+                case FILE_ACTION_MODIFIED:
+                    QueueChange(watch, StringView(name, nameLength), FILE_CHANGE_MODIFIED);
+                    break;
+                case FILE_ACTION_REMOVED:
+                case FILE_ACTION_RENAMED_OLD_NAME:
+                    QueueChange(watch, StringView(name, nameLength), FILE_CHANGE_DELETED);
+                    break;
+                default:
+                    break;
+                }
+
+                if (pInfo->NextEntryOffset == 0)
+                {
+                    break;
+                }
+                pData += pInfo->NextEntryOffset;
+            }
+
+            RequestChanges(pEntry);
+        }
+#else
+        void StopWatching(WatchEntry *pEntry)
+        {
+            // the descriptor is shared by the entries watching the same directory
+            for (u32 i = 0; i < s_pWatchState->watches.Size(); i++)
+            {
+                WatchEntry *pOther = s_pWatchState->watches[i];
+                if (pOther != nullptr && pOther != pEntry && pOther->descriptor == pEntry->descriptor)
+                {
+                    return;
+                }
+            }
+            inotify_rm_watch(s_pWatchState->inotifyDescriptor, pEntry->descriptor);
+        }
+
+        void ReadChanges()
+        {
+            if (s_pWatchState->inotifyDescriptor < 0)
+            {
+                return;
+            }
+
+            alignas(inotify_event) char buffer[FILESYSTEM_WATCH_BUFFER_SIZE];
+            while (TRUE)
+            {
+                // non-blocking, fails with EAGAIN once everything is read
+                ssize_t length = read(s_pWatchState->inotifyDescriptor, buffer, sizeof(buffer));
+                if (length <= 0)
+                {
+                    return;
+                }
+
+                for (ssize_t offset = 0; offset < length;)
+                {
+                    const inotify_event *pEvent = reinterpret_cast<const inotify_event *>(buffer + offset);
+                    offset += sizeof(inotify_event) + pEvent->len;
+
+                    u8 changes = 0;
+                    if ((pEvent->mask & (IN_CREATE | IN_MOVED_TO)) != 0)
+                    {
+                        changes |= FILE_CHANGE_CREATED;
+                    }
+                    if ((pEvent->mask & (IN_MODIFY | IN_CLOSE_WRITE)) != 0)
+                    {
+                        changes |= FILE_CHANGE_MODIFIED;
+                    }
+                    if ((pEvent->mask & (IN_DELETE | IN_MOVED_FROM | IN_DELETE_SELF)) != 0)
+                    {
+                        changes |= FILE_CHANGE_DELETED;
+                    }
+                    if (changes == 0)
+                    {
+                        continue;
+                    }
+
+                    // the name is empty for the changes of the watched directory itself
+                    StringView name = pEvent->len > 0 ? StringView(pEvent->name) : StringView();
+                    for (u32 i = 0; i < s_pWatchState->watches.Size(); i++)
+                    {
+                        WatchEntry *pEntry = s_pWatchState->watches[i];
+                        if (pEntry != nullptr && pEntry->descriptor == pEvent->wd)
+                        {
+                            QueueChange(i, name, changes);
+                        }
+                    }
+                }
+            }
+        }
+#endif
+    } // namespace
+
+    void FileSystem::initializeWatches()
+    {
+        RPP_ASSERT(s_pWatchState == nullptr);
+
+        s_pWatchState = CreateScope<WatchState>();
+#if !defined(RPP_PLATFORM_WINDOWS)
+        s_pWatchState->inotifyDescriptor = -1;
+#endif
+    }
+
+    void FileSystem::shutdownWatches()
+    {
+        RPP_ASSERT(s_pWatchState != nullptr);
+
+        for (u32 i = 0; i < s_pWatchState->watches.Size(); i++)
+        {
+            if (s_pWatchState->watches[i] != nullptr)
+            {
+                Unwatch(i);
+            }
+        }
+
+#if !defined(RPP_PLATFORM_WINDOWS)
+        if (s_pWatchState->inotifyDescriptor >= 0)
+        {
+            close(s_pWatchState->inotifyDescriptor);
+        }
+#endif
+        s_pWatchState.reset();
+    }
+
+    WatchHandle FileSystem::Watch(const String &directoryPath, FileWatchCallback callback)
+    {
+        RPP_ASSERT(s_pWatchState != nullptr);
+        RPP_ASSERT(callback != nullptr);
+
+        String physicalPath = getPhysicalPath(directoryPath);
+        if (!IsPhysicalPathDirectory(physicalPath))
+        {
+            return INVALID_ID;
+        }
+
+#if defined(RPP_PLATFORM_WINDOWS)
+        HANDLE directory = CreateFileA(physicalPath.CStr(), FILE_LIST_DIRECTORY,
+                                       FILE_SHARE_READ | FILE_SHARE_WRITE | FILE_SHARE_DELETE, nullptr, OPEN_EXISTING,
+                                       FILE_FLAG_BACKUP_SEMANTICS | FILE_FLAG_OVERLAPPED, nullptr);
+        if (directory == INVALID_HANDLE_VALUE)
+        {
+            return INVALID_ID;
+        }
+
+        WatchHandle watch = CreateWatchEntry();
+        WatchEntry *pEntry = GetWatchEntry(watch);
+        pEntry->directory = directory;
+        pEntry->overlapped = {};
+        pEntry->overlapped.hEvent = CreateEventA(nullptr, TRUE, FALSE, nullptr);
+        if (!RequestChanges(pEntry))
+        {
+            CloseHandle(pEntry->overlapped.hEvent);
+            CloseHandle(directory);
+            DestroyWatchEntry(watch);
+            return INVALID_ID;
+        }
+#else
+        if (s_pWatchState->inotifyDescriptor < 0)
+        {
+            s_pWatchState->inotifyDescriptor = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+            if (s_pWatchState->inotifyDescriptor < 0)
+            {
+                return INVALID_ID;
+            }
+        }
+
+        u32 mask = IN_CREATE | IN_MODIFY | IN_CLOSE_WRITE | IN_DELETE | IN_MOVED_FROM | IN_MOVED_TO | IN_DELETE_SELF;
+        i32 descriptor = inotify_add_watch(s_pWatchState->inotifyDescriptor, physicalPath.CStr(), mask);
+        if (descriptor < 0)
+        {
+            return INVALID_ID;
+        }
+
+        WatchHandle watch = CreateWatchEntry();
+        WatchEntry *pEntry = GetWatchEntry(watch);
+        pEntry->descriptor = descriptor;
+#endif
+
+        pEntry->directoryPath = directoryPath;
+        pEntry->callback = std::move(callback);
+        return watch;
+    }
+
+    void FileSystem::Unwatch(WatchHandle watch)
+    {
+        RPP_ASSERT(s_pWatchState != nullptr);
+
+        WatchEntry *pEntry = GetWatchEntry(watch);
+        if (pEntry == nullptr)
+        {
+            return;
+        }
+
+        StopWatching(pEntry);
+        DestroyWatchEntry(watch);
+
+        Array<PendingChange> &pendingChanges = s_pWatchState->pendingChanges;
+        for (i32 i = static_cast<i32>(pendingChanges.Size()) - 1; i >= 0; i--)
+        {
+            if (pendingChanges[i].watch == watch)
+            {
+                pendingChanges.Erase(i);
+            }
+        }
+    }
+
+    u32 FileSystem::ProcessWatchEvents()
+    {
+        if (s_pWatchState == nullptr)
+        {
+            return 0;
+        }
+
+#if defined(RPP_PLATFORM_WINDOWS)
+        for (u32 i = 0; i < s_pWatchState->watches.Size(); i++)
+        {
+            WatchEntry *pEntry = s_pWatchState->watches[i];
+            if (pEntry != nullptr)
+            {
+                ReadChanges(i, pEntry);
+            }
+        }
+#else
+        ReadChanges();
+#endif
+
+        // taken out of the pending changes first: a callback may watch or unwatch directories
+        auto now = std::chrono::steady_clock::now();
+        Array<FileChangeEvent> events;
+        Array<PendingChange> &pendingChanges = s_pWatchState->pendingChanges;
+        u32 keptCount = 0; // the changes still coalescing are compacted to the front, in order
+        for (u32 i = 0; i < pendingChanges.Size(); i++)
+        {
+            PendingChange &pendingChange = pendingChanges[i];
+            if (now - pendingChange.lastChangeTime < std::chrono::milliseconds(FILESYSTEM_WATCH_COALESCE_DELAY))
+            {
+                if (keptCount != i)
+                {
+                    pendingChanges[keptCount] = std::move(pendingChange);
+                }
+                keptCount++;
+                continue;
+            }
+
+            const String &directoryPath = GetWatchEntry(pendingChange.watch)->directoryPath;
+            FileChangeEvent event = {};
+            event.watch = pendingChange.watch;
+            event.filePath = pendingChange.name.Length() > 0 ? Format("{}/{}", directoryPath, pendingChange.name)
+                                                             : directoryPath;
+            event.changes = pendingChange.changes;
+            events.Push(std::move(event)); // kept in the order of the first change
+        }
+        pendingChanges.Resize(keptCount);
+
+        u32 processedCount = 0;
+        for (u32 i = 0; i < events.Size(); i++)
+        {
+            // the watch may have been stopped by a previous callback
+            WatchEntry *pEntry = GetWatchEntry(events[i].watch);
+            if (pEntry != nullptr)
+            {
+                FileWatchCallback callback = pEntry->callback;
+                callback(events[i]);
+                processedCount++;
+            }
+        }
+
+        return processedCount;
+    }
+} // namespace rpp
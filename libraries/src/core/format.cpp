@@ -1,52 +1,427 @@
 #include "core/format.h"
-#include <string>
+#include <charconv>
+#include <cstring>
+
+#define FORMAT_STACK_BUFFER_SIZE 256
+
+/// The largest precision of the floats, so that the scientific notation always fits the digits buffer.
+#define FORMAT_MAX_FLOAT_PRECISION 100
 
 namespace rpp
 {
-    String Format(const String &formatMessage)
+    namespace
+    {
+        template <typename T>
+        u32 NumberToChars(char *buffer, u32 capacity, T value)
+        {
+            std::to_chars_result result = std::to_chars(buffer, buffer + capacity, value);
+            return result.ec == std::errc() ? static_cast<u32>(result.ptr - buffer) : 0;
+        }
+
+        template <typename T>
+        u32 FloatToChars(char *buffer, u32 capacity, T value)
+        {
+            std::to_chars_result result = std::to_chars(buffer, buffer + capacity, value, std::chars_format::general);
+            return result.ec == std::errc() ? static_cast<u32>(result.ptr - buffer) : 0;
+        }
+
+        template <typename T>
+        b8 NumberFromChars(StringView text, T &outValue)
+        {
+            const char *first = text.Data();
+            const char *last = text.Data() + text.Length();
+
+            if (first != last && *first == '+')
+            {
+                first++;
+                if (first != last && *first == '-')
+                {
+                    return FALSE;
+                }
+            }
+
+            if (first == last)
+            {
+                return FALSE;
+            }
+
+            T value;
+            std::from_chars_result result;
+            if constexpr (std::is_floating_point_v<T>)
+            {
+                result = std::from_chars(first, last, value, std::chars_format::general);
+            }
+            else
+            {
+                result = std::from_chars(first, last, value);
+            }
+
+            if (result.ec != std::errc() || result.ptr != last)
+            {
+                return FALSE;
+            }
+
+            outValue = value;
+            return TRUE;
+        }
+    } // namespace
+
+    u32 ToChars(char *buffer, u32 capacity, i32 value) { return NumberToChars(buffer, capacity, value); }
+    u32 ToChars(char *buffer, u32 capacity, u32 value) { return NumberToChars(buffer, capacity, value); }
+    u32 ToChars(char *buffer, u32 capacity, i64 value) { return NumberToChars(buffer, capacity, value); }
+    u32 ToChars(char *buffer, u32 capacity, u64 value) { return NumberToChars(buffer, capacity, value); }
+    u32 ToChars(char *buffer, u32 capacity, f32 value) { return FloatToChars(buffer, capacity, value); }
+    u32 ToChars(char *buffer, u32 capacity, f64 value) { return FloatToChars(buffer, capacity, value); }
+
+    b8 FromChars(StringView text, u8 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, u16 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, u32 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, u64 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, i8 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, i16 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, i32 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, i64 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, f32 &outValue) { return NumberFromChars(text, outValue); }
+    b8 FromChars(StringView text, f64 &outValue) { return NumberFromChars(text, outValue); }
+
+    FormatWriter::FormatWriter(char *buffer, u32 capacity)
+        : m_buffer(buffer), m_capacity(capacity), m_length(0)
     {
-        return formatMessage;
     }
 
-    template <>
-    const String ToString<String>(const String &value)
+    void FormatWriter::Write(StringView value)
     {
-        return value;
+        if (m_length < m_capacity)
+        {
+            u32 available = m_capacity - m_length;
+            memcpy(m_buffer + m_length, value.Data(), value.Length() < available ? value.Length() : available);
+        }
+
+        m_length += value.Length();
     }
 
-#define DEFINE_TO_STRING(type)                        \
-    template <>                                       \
-    const String ToString<type>(const type &value)    \
-    {                                                 \
-        return String(std::to_string(value).c_str()); \
+    void FormatWriter::Write(char value)
+    {
+        if (m_length < m_capacity)
+        {
+            m_buffer[m_length] = value;
+        }
+
+        m_length++;
     }
 
-    DEFINE_TO_STRING(u8);
-    DEFINE_TO_STRING(u16);
-    DEFINE_TO_STRING(u32);
-    DEFINE_TO_STRING(u64);
+    void FormatWriter::writeFill(char fill, u32 count)
+    {
+        for (u32 i = 0; i < count; i++)
+        {
+            Write(fill);
+        }
+    }
 
-    DEFINE_TO_STRING(i8);
-    DEFINE_TO_STRING(i16);
-    DEFINE_TO_STRING(i32);
-    DEFINE_TO_STRING(i64);
+    void FormatWriter::writePadded(StringView value, const FormatSpec &spec, char defaultAlign)
+    {
+        if (spec.width <= value.Length())
+        {
+            Write(value);
+            return;
+        }
 
-    template <>
-    const String ToString<f32>(const f32 &value)
+        u32 padding = spec.width - value.Length();
+        char align = spec.align != 0 ? spec.align : defaultAlign;
+
+        switch (align)
+        {
+        case '<':
+            Write(value);
+            writeFill(spec.fill, padding);
+            break;
+        case '^':
+            writeFill(spec.fill, padding / 2);
+            Write(value);
+            writeFill(spec.fill, padding - padding / 2);
+            break;
+        default:
+            writeFill(spec.fill, padding);
+            Write(value);
+            break;
+        }
+    }
+
+    void FormatWriter::writeNumber(StringView digits, const FormatSpec &spec)
+    {
+        if (!spec.zeroPad || spec.align != 0 || spec.width <= digits.Length())
+        {
+            writePadded(digits, spec, '>');
+            return;
+        }
+
+        // zero padding goes between the sign and the digits: -0042
+        if (!digits.Empty() && (digits[0] == '-' || digits[0] == '+'))
+        {
+            Write(digits[0]);
+            digits = digits.SubView(1);
+            writeFill('0', spec.width - digits.Length() - 1);
+        }
+        else
+        {
+            writeFill('0', spec.width - digits.Length());
+        }
+
+        Write(digits);
+    }
+
+    void FormatWriter::WriteText(StringView value, const FormatSpec &spec)
+    {
+        if (spec.precision >= 0 && static_cast<u32>(spec.precision) < value.Length())
+        {
+            value = value.SubView(0, spec.precision);
+        }
+
+        writePadded(value, spec, '<');
+    }
+
+    void FormatWriter::WriteSigned(i64 value, const FormatSpec &spec)
     {
-        char buffer[32];
-        std::snprintf(buffer, sizeof(buffer), "%.2f", value);
-        return String(buffer);
+        char digits[24];
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        writeNumber(StringView(digits, static_cast<u32>(result.ptr - digits)), spec);
     }
 
+    void FormatWriter::WriteUnsigned(u64 value, const FormatSpec &spec)
+    {
+        char digits[24];
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value);
+        writeNumber(StringView(digits, static_cast<u32>(result.ptr - digits)), spec);
+    }
+
+    template <typename T>
+    static StringView FloatDigits(char (&digits)[128], T value, const FormatSpec &spec)
+    {
+        if (spec.precision < 0)
+        {
+            return StringView(digits, FloatToChars(digits, sizeof(digits), value));
+        }
+
+        i32 precision = spec.precision < FORMAT_MAX_FLOAT_PRECISION ? spec.precision : FORMAT_MAX_FLOAT_PRECISION;
+        std::to_chars_result result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::fixed, precision);
+
+        if (result.ec != std::errc())
+        {
+            // only huge values with a big precision do not fit, fall back to the scientific notation
+            result = std::to_chars(digits, digits + sizeof(digits), value, std::chars_format::scientific, precision);
+        }
+
+        return StringView(digits, static_cast<u32>(result.ptr - digits));
+    }
+
+    void FormatWriter::WriteFloat(f32 value, const FormatSpec &spec)
+    {
+        char digits[128];
+        writeNumber(FloatDigits(digits, value, spec), spec);
+    }
+
+    void FormatWriter::WriteFloat(f64 value, const FormatSpec &spec)
+    {
+        char digits[128];
+        writeNumber(FloatDigits(digits, value, spec), spec);
+    }
+
+    void FormatWriter::WriteBool(b8 value, const FormatSpec &spec)
+    {
+        writePadded(value ? "true" : "false", spec, '<');
+    }
+
+    namespace details
+    {
+        static b8 IsAlign(char character)
+        {
+            return character == '<' || character == '>' || character == '^';
+        }
+
+        static b8 IsDigit(char character)
+        {
+            return character >= '0' && character <= '9';
+        }
+
+        static u32 ParseNumber(StringView pattern, u32 &index)
+        {
+            u32 value = 0;
+            while (index < pattern.Length() && IsDigit(pattern.Data()[index]))
+            {
+                value = value * 10 + static_cast<u32>(pattern.Data()[index] - '0');
+                index++;
+            }
+            return value;
+        }
+
+        /**
+         * Parses the placeholder which starts at `index` (pointing to '{'). On success the spec is filled and the
+         * index of the closing '}' is returned, otherwise -1.
+         */
+        static i32 ParsePlaceholder(StringView pattern, u32 index, FormatSpec &outSpec)
+        {
+            outSpec.fill = ' ';
+            outSpec.align = 0;
+            outSpec.zeroPad = FALSE;
+            outSpec.width = 0;
+            outSpec.precision = -1;
+
+            const char *data = pattern.Data();
+            u32 length = pattern.Length();
+            u32 cursor = index + 1;
+
+            if (cursor < length && data[cursor] == '}')
+            {
+                return static_cast<i32>(cursor);
+            }
+
+            if (cursor >= length || data[cursor] != ':')
+            {
+                return -1;
+            }
+            cursor++;
+
+            if (cursor + 1 < length && data[cursor] != '}' && IsAlign(data[cursor + 1]))
+            {
+                outSpec.fill = data[cursor];
+                outSpec.align = data[cursor + 1];
+                cursor += 2;
+            }
+            else if (cursor < length && IsAlign(data[cursor]))
+            {
+                outSpec.align = data[cursor];
+                cursor++;
+            }
+
+            if (cursor < length && data[cursor] == '0')
+            {
+                outSpec.zeroPad = TRUE;
+                cursor++;
+            }
+
+            outSpec.width = ParseNumber(pattern, cursor);
+
+            if (cursor < length && data[cursor] == '.')
+            {
+                cursor++;
+                if (cursor >= length || !IsDigit(data[cursor]))
+                {
+                    return -1;
+                }
+                outSpec.precision = static_cast<i32>(ParseNumber(pattern, cursor));
+            }
+
+            if (cursor >= length || data[cursor] != '}')
+            {
+                return -1;
+            }
+
+            return static_cast<i32>(cursor);
+        }
+
+        void FormatPattern(FormatWriter &writer, StringView pattern, const FormatArgument *arguments, u32 argumentCount)
+        {
+            u32 argumentIndex = 0;
+            u32 literalStart = 0;
+            u32 cursor = 0;
+
+            while (TRUE)
+            {
+                i32 openIndex = pattern.Find('{', cursor);
+                if (openIndex == -1)
+                {
+                    break;
+                }
+
+                FormatSpec spec;
+                i32 closeIndex = ParsePlaceholder(pattern, static_cast<u32>(openIndex), spec);
+
+                if (closeIndex == -1 || argumentIndex >= argumentCount)
+                {
+                    // not a placeholder (or nothing left to put into it), keep it as literal text
+                    cursor = static_cast<u32>(openIndex) + 1;
+                    continue;
+                }
+
+                writer.Write(pattern.SubView(literalStart, openIndex - literalStart));
+
+                const FormatArgument &argument = arguments[argumentIndex++];
+                argument.write(writer, spec, argument.value);
+
+                cursor = static_cast<u32>(closeIndex) + 1;
+                literalStart = cursor;
+            }
+
+            writer.Write(pattern.SubView(literalStart));
+        }
+
+        String FormatPatternToString(StringView pattern, const FormatArgument *arguments, u32 argumentCount)
+        {
+            char stackBuffer[FORMAT_STACK_BUFFER_SIZE];
+            FormatWriter writer(stackBuffer, FORMAT_STACK_BUFFER_SIZE);
+            FormatPattern(writer, pattern, arguments, argumentCount);
+
+            if (!writer.Truncated())
+            {
+                return String(stackBuffer, writer.Length());
+            }
+
+            u32 requiredLength = writer.Length();
+            char *heapBuffer = static_cast<char *>(RPP_MALLOC(requiredLength));
+
+            FormatWriter heapWriter(heapBuffer, requiredLength);
+            FormatPattern(heapWriter, pattern, arguments, argumentCount);
+
+            String result(heapBuffer, requiredLength);
+            RPP_FREE(heapBuffer);
+
+            return result;
+        }
+
+        u32 FormatPatternTo(char *buffer, u32 capacity, StringView pattern, const FormatArgument *arguments, u32 argumentCount)
+        {
+            if (capacity == 0)
+            {
+                FormatWriter writer(nullptr, 0);
+                FormatPattern(writer, pattern, arguments, argumentCount);
+                return writer.Length();
+            }
+
+            FormatWriter writer(buffer, capacity - 1);
+            FormatPattern(writer, pattern, arguments, argumentCount);
+
+            buffer[writer.Truncated() ? capacity - 1 : writer.Length()] = '\0';
+            return writer.Length();
+        }
+    } // namespace details
+
     template <>
-    const String ToString<f64>(const f64 &value)
+    const String ToString<String>(const String &value)
     {
-        char buffer[32];
-        std::snprintf(buffer, sizeof(buffer), "%.2lf", value);
-        return String(buffer);
+        return value;
     }
 
+#define DEFINE_TO_STRING(type, charsType)                                                      \
+    template <>                                                                                \
+    const String ToString<type>(const type &value)                                             \
+    {                                                                                          \
+        char buffer[32];                                                                       \
+        return String(buffer, ToChars(buffer, sizeof(buffer), static_cast<charsType>(value))); \
+    }
+
+    DEFINE_TO_STRING(u8, u32);
+    DEFINE_TO_STRING(u16, u32);
+    DEFINE_TO_STRING(u32, u32);
+    DEFINE_TO_STRING(u64, u64);
+
+    DEFINE_TO_STRING(i8, i32);
+    DEFINE_TO_STRING(i16, i32);
+    DEFINE_TO_STRING(i32, i32);
+    DEFINE_TO_STRING(i64, i64);
+
+    DEFINE_TO_STRING(f32, f32);
+    DEFINE_TO_STRING(f64, f64);
+
     template <>
     const String ToString<b8>(const b8 &value)
     {
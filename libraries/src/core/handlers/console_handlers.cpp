@@ -35,7 +35,17 @@ namespace rpp
             RPP_UNREACHABLE();
         };
 
-        print(Format("[{}] {}:{}: {}\n", record.level, record.file, record.line, record.message).CStr(), color);
+        char buffer[RPP_LOG_BUFFER_SIZE + 256];
+        u32 length = FormatTo(buffer, sizeof(buffer), "[{}] {}:{}: {}\n", record.level, record.file, record.line, record.message);
+
+        if (length < sizeof(buffer))
+        {
+            print(buffer, color);
+        }
+        else
+        {
+            print(Format("[{}] {}:{}: {}\n", record.level, record.file, record.line, record.message).CStr(), color);
+        }
     }
 
 } // namespace rpp
@@ -17,9 +17,20 @@ namespace rpp
     }
 
     Json::Json(const Json &other)
+        : m_data(other.m_data != nullptr ? RPP_NEW(JSON, *static_cast<const JSON *>(other.m_data)) : nullptr)
     {
-        JSON *otherJson = static_cast<JSON *>(other.m_data);
-        m_data = RPP_NEW(JSON, JSON::parse(otherJson->dump()));
+    }
+
+    Json::Json(JsonConstRef node)
+    {
+        if (node.IsValid())
+        {
+            m_data = RPP_NEW(JSON, *static_cast<const JSON *>(node.m_node));
+        }
+        else
+        {
+            m_data = RPP_NEW(JSON, JSON::object());
+        }
     }
 
     Json::Json(Json &&other) noexcept
@@ -39,88 +50,233 @@ namespace rpp
         }
     }
 
-    String Json::ToString() const
+    Json &Json::operator=(const Json &other)
+    {
+        if (this == &other)
+        {
+            return *this;
+        }
+
+        if (other.m_data == nullptr)
+        {
+            // copied from a moved-from object, which holds nothing
+            if (m_data != nullptr)
+            {
+                RPP_DELETE(static_cast<JSON *>(m_data));
+                m_data = nullptr;
+            }
+        }
+        else if (m_data == nullptr)
+        {
+            m_data = RPP_NEW(JSON, *static_cast<const JSON *>(other.m_data));
+        }
+        else
+        {
+            *static_cast<JSON *>(m_data) = *static_cast<const JSON *>(other.m_data);
+        }
+        return *this;
+    }
+
+    Json &Json::operator=(Json &&other) noexcept
+    {
+        if (this != &other)
+        {
+            if (m_data != nullptr)
+            {
+                RPP_DELETE(static_cast<JSON *>(m_data));
+            }
+            m_data = other.m_data;
+            other.m_data = nullptr;
+        }
+        return *this;
+    }
+
+    String Json::ToString(JsonFormat format) const
     {
-        return static_cast<JSON *>(m_data)->dump(4).c_str();
+        return Ref().ToString(format);
     }
 
     b8 Json::Empty() const
     {
-        return static_cast<JSON *>(m_data)->empty();
+        return Ref().Empty();
     }
 
     b8 Json::IsArray() const
     {
-        return static_cast<JSON *>(m_data)->is_array();
+        return Ref().IsArray();
     }
 
     u32 Json::Size() const
     {
-        JSON *json = static_cast<JSON *>(m_data);
-        if (!json->is_array())
+        return Ref().Size();
+    }
+
+    JsonConstRef::JsonConstRef()
+        : m_node(nullptr)
+    {
+    }
+
+    JsonConstRef::JsonConstRef(const void *node)
+        : m_node(node)
+    {
+    }
+
+    JsonConstRef JsonConstRef::Child(const String &key) const
+    {
+        const JSON *json = static_cast<const JSON *>(m_node);
+        if (json == nullptr || !json->is_object())
+        {
+            return JsonConstRef();
+        }
+
+        auto it = json->find(key.CStr());
+        if (it == json->end())
+        {
+            return JsonConstRef();
+        }
+        return JsonConstRef(&(*it));
+    }
+
+    JsonConstRef JsonConstRef::At(i32 index) const
+    {
+        const JSON *json = static_cast<const JSON *>(m_node);
+        if (json == nullptr || !json->is_array() || index < 0 || index >= static_cast<i32>(json->size()))
+        {
+            return JsonConstRef();
+        }
+        return JsonConstRef(&(*json)[index]);
+    }
+
+    b8 JsonConstRef::Contains(const String &key) const
+    {
+        const JSON *json = static_cast<const JSON *>(m_node);
+        return json != nullptr && json->is_object() && json->contains(key.CStr());
+    }
+
+    b8 JsonConstRef::Empty() const
+    {
+        const JSON *json = static_cast<const JSON *>(m_node);
+        return json == nullptr || json->empty();
+    }
+
+    b8 JsonConstRef::IsArray() const
+    {
+        const JSON *json = static_cast<const JSON *>(m_node);
+        return json != nullptr && json->is_array();
+    }
+
+    b8 JsonConstRef::IsObject() const
+    {
+        const JSON *json = static_cast<const JSON *>(m_node);
+        return json != nullptr && json->is_object();
+    }
+
+    u32 JsonConstRef::Size() const
+    {
+        const JSON *json = static_cast<const JSON *>(m_node);
+        if (json == nullptr || !json->is_array())
         {
             return 0;
         }
         return static_cast<u32>(json->size());
     }
 
-#define JSON_GET_SET_IMPLEMENT(type, isTypeMethod, getMethod, setMethod)   \
-    template <>                                                            \
-    type Json::Get<type>(const String &key, const type defaultValue) const \
-    {                                                                      \
-        JSON *json = static_cast<JSON *>(m_data);                          \
-        if (!(*json).contains(key.CStr()))                                 \
-        {                                                                  \
-            return defaultValue;                                           \
-        }                                                                  \
-                                                                           \
-        if (!(*json)[key.CStr()].isTypeMethod())                           \
-        {                                                                  \
-            return defaultValue;                                           \
-        }                                                                  \
-                                                                           \
-        return (*json)[key.CStr()].getMethod;                              \
-    }                                                                      \
-    template <>                                                            \
-    type Json::Get<type>(i32 index, const type defaultValue) const         \
-    {                                                                      \
-        JSON *json = static_cast<JSON *>(m_data);                          \
-        if (!(*json).is_array() || index < 0 || index >= (*json).size())   \
-        {                                                                  \
-            return defaultValue;                                           \
-        }                                                                  \
-                                                                           \
-        return (*json)[index].getMethod;                                   \
-    }                                                                      \
-                                                                           \
-    template <>                                                            \
-    void Json::Set<type>(const String &key, const type &value)             \
-    {                                                                      \
-        JSON *json = static_cast<JSON *>(m_data);                          \
-        (*json)[key.CStr()] = setMethod;                                   \
-    }                                                                      \
-    template <>                                                            \
-    void Json::Set<type>(i32 index, const type &value)                     \
-    {                                                                      \
-        JSON *json = static_cast<JSON *>(m_data);                          \
-        if (!(*json).is_array() || index < 0 || index >= (*json).size())   \
-        {                                                                  \
-            return;                                                        \
-        }                                                                  \
-        (*json)[index] = setMethod;                                        \
-    }                                                                      \
-    template <>                                                            \
-    void Json::Append<type>(const type &value)                             \
-    {                                                                      \
-        JSON *json = static_cast<JSON *>(m_data);                          \
-        if (!(*json).is_array())                                           \
-        {                                                                  \
-            return;                                                        \
-        }                                                                  \
-        (*json).push_back(setMethod);                                      \
-    }
-
-    JSON_GET_SET_IMPLEMENT(String, is_string, get<std::string>().c_str(), value.CStr());
+    String JsonConstRef::ToString(JsonFormat format) const
+    {
+        if (m_node == nullptr)
+        {
+            return String();
+        }
+
+        // an indent of -1 makes nlohmann::json skip every newline and space
+        std::string dumped = static_cast<const JSON *>(m_node)->dump(format == JsonFormat::PRETTY ? 4 : -1);
+        return String(dumped.c_str(), static_cast<u32>(dumped.size()));
+    }
+
+    JsonRef::JsonRef()
+        : JsonConstRef()
+    {
+    }
+
+    JsonRef::JsonRef(void *node)
+        : JsonConstRef(node)
+    {
+    }
+
+    JsonRef JsonRef::Child(const String &key)
+    {
+        JsonConstRef child = JsonConstRef::Child(key);
+        return JsonRef(const_cast<void *>(child.m_node));
+    }
+
+    JsonRef JsonRef::At(i32 index)
+    {
+        JsonConstRef element = JsonConstRef::At(index);
+        return JsonRef(const_cast<void *>(element.m_node));
+    }
+
+#define JSON_GET_SET_IMPLEMENT(type, isTypeMethod, getMethod, setMethod)                   \
+    template <>                                                                            \
+    type JsonConstRef::Get<type>(const String &key, const type defaultValue) const         \
+    {                                                                                      \
+        const JSON *json = static_cast<const JSON *>(m_node);                              \
+        if (json == nullptr || !json->is_object())                                         \
+        {                                                                                  \
+            return defaultValue;                                                           \
+        }                                                                                  \
+                                                                                           \
+        auto it = json->find(key.CStr());                                                  \
+        if (it == json->end() || !it->isTypeMethod())                                      \
+        {                                                                                  \
+            return defaultValue;                                                           \
+        }                                                                                  \
+                                                                                           \
+        return it->getMethod;                                                              \
+    }                                                                                      \
+    template <>                                                                            \
+    type JsonConstRef::Get<type>(i32 index, const type defaultValue) const                 \
+    {                                                                                      \
+        const JSON *json = static_cast<const JSON *>(m_node);                              \
+        if (json == nullptr || !json->is_array() || index < 0 || index >= static_cast<i32>(json->size())) \
+        {                                                                                  \
+            return defaultValue;                                                           \
+        }                                                                                  \
+                                                                                           \
+        return (*json)[index].getMethod;                                                   \
+    }                                                                                      \
+                                                                                           \
+    template <>                                                                            \
+    void JsonRef::Set<type>(const String &key, const type &value)                          \
+    {                                                                                      \
+        JSON *json = static_cast<JSON *>(node());                                          \
+        if (json == nullptr || !(json->is_object() || json->is_null()))                    \
+        {                                                                                  \
+            return;                                                                        \
+        }                                                                                  \
+        (*json)[key.CStr()] = setMethod;                                                   \
+    }                                                                                      \
+    template <>                                                                            \
+    void JsonRef::Set<type>(i32 index, const type &value)                                  \
+    {                                                                                      \
+        JSON *json = static_cast<JSON *>(node());                                          \
+        if (json == nullptr || !json->is_array() || index < 0 || index >= static_cast<i32>(json->size())) \
+        {                                                                                  \
+            return;                                                                        \
+        }                                                                                  \
+        (*json)[index] = setMethod;                                                        \
+    }                                                                                      \
+    template <>                                                                            \
+    void JsonRef::Append<type>(const type &value)                                          \
+    {                                                                                      \
+        JSON *json = static_cast<JSON *>(node());                                          \
+        if (json == nullptr || !json->is_array())                                          \
+        {                                                                                  \
+            return;                                                                        \
+        }                                                                                  \
+        json->push_back(setMethod);                                                        \
+    }
+
+    JSON_GET_SET_IMPLEMENT(String, is_string, get_ref<const std::string &>().c_str(), value.CStr());
 
     JSON_GET_SET_IMPLEMENT(u32, is_number, get<u32>(), value);
     JSON_GET_SET_IMPLEMENT(u16, is_number, get<u16>(), value);
@@ -135,36 +291,60 @@ namespace rpp
     JSON_GET_SET_IMPLEMENT(f32, is_number, get<f32>(), value);
     JSON_GET_SET_IMPLEMENT(f64, is_number, get<f64>(), value);
 
+    // The nested Json versions copy the node directly instead of dumping and re-parsing it.
+
     template <>
-    Json Json::Get<Json>(const String &key, const Json defaultValue) const
+    Json JsonConstRef::Get<Json>(const String &key, const Json defaultValue) const
     {
-        JSON *json = static_cast<JSON *>(m_data);
-        if (!(*json).contains(key.CStr()))
+        JsonConstRef child = Child(key);
+        if (!child.IsObject() && !child.IsArray())
         {
             return defaultValue;
         }
-        if (!(*json)[key.CStr()].is_object() && !(*json)[key.CStr()].is_array())
+        return Json(child);
+    }
+
+    template <>
+    Json JsonConstRef::Get<Json>(i32 index, const Json defaultValue) const
+    {
+        JsonConstRef element = At(index);
+        if (!element.IsObject() && !element.IsArray())
         {
             return defaultValue;
         }
-        return Json((*json)[key.CStr()].get<JSON>().dump().c_str());
+        return Json(element);
     }
 
     template <>
-    void Json::Set<Json>(const String &key, const Json &value)
+    void JsonRef::Set<Json>(const String &key, const Json &value)
     {
-        JSON *json = static_cast<JSON *>(m_data);
-        (*json)[key.CStr()] = JSON::parse(value.ToString().CStr());
+        JSON *json = static_cast<JSON *>(node());
+        if (json == nullptr || !(json->is_object() || json->is_null()))
+        {
+            return;
+        }
+        (*json)[key.CStr()] = *static_cast<const JSON *>(value.m_data);
+    }
+
+    template <>
+    void JsonRef::Set<Json>(i32 index, const Json &value)
+    {
+        JSON *json = static_cast<JSON *>(node());
+        if (json == nullptr || !json->is_array() || index < 0 || index >= static_cast<i32>(json->size()))
+        {
+            return;
+        }
+        (*json)[index] = *static_cast<const JSON *>(value.m_data);
     }
 
     template <>
-    void Json::Append<Json>(const Json &value)
+    void JsonRef::Append<Json>(const Json &value)
     {
-        JSON *json = static_cast<JSON *>(m_data);
-        if (!(*json).is_array())
+        JSON *json = static_cast<JSON *>(node());
+        if (json == nullptr || !json->is_array())
         {
             return;
         }
-        (*json).push_back(JSON::parse(value.ToString().CStr()));
+        json->push_back(*static_cast<const JSON *>(value.m_data));
     }
 } // namespace rpp
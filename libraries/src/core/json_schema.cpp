@@ -0,0 +1,161 @@
+#include "core/json_schema.h"
+#include "core/containers/array.h"
+#include "nlohmann/json.hpp"
+
+namespace rpp
+{
+    namespace
+    {
+        const char *s_valueTypeNames[u32(JsonValueType::COUNT)] = {"a number", "a boolean", "a string", "an array",
+                                                                    "an object"};
+
+        b8 IsTokenOfType(JsonToken token, JsonValueType type)
+        {
+            switch (type)
+            {
+            case JsonValueType::NUMBER:
+                return token == JsonToken::NUMBER;
+            case JsonValueType::BOOLEAN:
+                return token == JsonToken::BOOLEAN;
+            case JsonValueType::STRING:
+                return token == JsonToken::STRING;
+            case JsonValueType::ARRAY:
+                return token == JsonToken::BEGIN_ARRAY;
+            case JsonValueType::OBJECT:
+                return token == JsonToken::BEGIN_OBJECT;
+            default:
+                return FALSE;
+            }
+        }
+
+        i32 FindSchemaField(const JsonSchema &schema, StringView key)
+        {
+            for (u32 i = 0; i < schema.fieldCount; i++)
+            {
+                if (key == schema.fields[i].key)
+                {
+                    return static_cast<i32>(i);
+                }
+            }
+            return -1;
+        }
+    } // namespace
+
+    u32 PeekJsonVersion(StringView content)
+    {
+        JsonReader reader(content);
+        if (reader.Next() != JsonToken::BEGIN_OBJECT || reader.Next() != JsonToken::KEY ||
+            reader.GetString() != RPP_JSON_VERSION_KEY)
+        {
+            return 0;
+        }
+
+        u32 version = 0;
+        return reader.Read(version) ? version : 0;
+    }
+
+    b8 ValidateJson(StringView content, const JsonSchema &schema, String &outError)
+    {
+        JsonReader reader(content);
+        if (reader.Next() != JsonToken::BEGIN_OBJECT)
+        {
+            outError = reader.HasError() ? reader.GetError() : Format("{} must be a JSON object", schema.name);
+            return FALSE;
+        }
+
+        Array<b8> foundFields;
+        for (u32 i = 0; i < schema.fieldCount; i++)
+        {
+            foundFields.Push(FALSE);
+        }
+
+        while (reader.Next() == JsonToken::KEY)
+        {
+            // the view of the key does not survive the next token
+            i32 fieldIndex = FindSchemaField(schema, reader.GetString());
+
+            JsonToken token = reader.Next();
+            if (fieldIndex >= 0)
+            {
+                const JsonSchemaField &field = schema.fields[fieldIndex];
+                if (!IsTokenOfType(token, field.type))
+                {
+                    outError = Format("{}: \"{}\" must be {}", schema.name, field.key, s_valueTypeNames[u32(field.type)]);
+                    return FALSE;
+                }
+                foundFields[fieldIndex] = TRUE;
+            }
+            reader.Skip();
+        }
+
+        if (reader.GetToken() != JsonToken::END_OBJECT || reader.Next() != JsonToken::END)
+        {
+            outError = reader.HasError() ? reader.GetError() : Format("{} must be a single JSON object", schema.name);
+            return FALSE;
+        }
+
+        for (u32 i = 0; i < schema.fieldCount; i++)
+        {
+            if (!foundFields[i])
+            {
+                outError = Format("{}: the key \"{}\" is missing", schema.name, schema.fields[i].key);
+                return FALSE;
+            }
+        }
+
+        return TRUE;
+    }
+
+    b8 UpgradeJson(StringView content, const JsonSchema &schema, String &outContent, String &outError)
+    {
+        // the streaming reader gives readable errors for the structure, the parser below still reports what it rejects
+        JsonReader reader(content);
+        if (reader.Next() != JsonToken::BEGIN_OBJECT)
+        {
+            outError = reader.HasError() ? reader.GetError() : Format("{} must be a JSON object", schema.name);
+            return FALSE;
+        }
+        reader.Skip();
+        if (reader.Next() != JsonToken::END)
+        {
+            outError = reader.HasError() ? reader.GetError() : Format("{} must be a single JSON object", schema.name);
+            return FALSE;
+        }
+
+        Json document;
+        try
+        {
+            document = Json(String(content.Data(), content.Length()));
+        }
+        catch (const nlohmann::json::parse_error &error)
+        {
+            outError = Format("{}: {}", schema.name, error.what());
+            return FALSE;
+        }
+
+        u32 version = document.Get<u32>(RPP_JSON_VERSION_KEY, 0);
+        if (version > schema.version)
+        {
+            outError = Format("{}: version {} is newer than the supported version {}", schema.name, version,
+                              schema.version);
+            return FALSE;
+        }
+
+        for (; version < schema.version; version++)
+        {
+            if (schema.migration != nullptr && !schema.migration(version, document))
+            {
+                outError = Format("{}: cannot migrate from version {}", schema.name, version);
+                return FALSE;
+            }
+        }
+
+        if (schema.version != 0)
+        {
+            document.Set<u32>(RPP_JSON_VERSION_KEY, schema.version);
+        }
+
+        outContent = document.ToString(JsonFormat::COMPACT);
+        return ValidateJson(outContent, schema, outError);
+    }
+} // namespace rpp
@@ -0,0 +1,929 @@
+#include "core/json_stream.h"
+#include "core/assertions.h"
+#include <algorithm>
+#include <cstring>
+
+namespace rpp
+{
+    namespace
+    {
+        inline b8 IsWhitespace(i32 character)
+        {
+            return character == ' ' || character == '\n' || character == '\r' || character == '\t';
+        }
+
+        inline b8 IsNumberCharacter(char character)
+        {
+            return (character >= '0' && character <= '9') || character == '-' || character == '+' ||
+                   character == '.' || character == 'e' || character == 'E';
+        }
+
+        inline b8 IsDigit(char character)
+        {
+            return character >= '0' && character <= '9';
+        }
+
+        /**
+         * Checks `-?(0|[1-9][0-9]*)(\.[0-9]+)?([eE][+-]?[0-9]+)?`, the number grammar of RFC 8259.
+         */
+        b8 IsValidNumber(StringView text)
+        {
+            const char *current = text.Data();
+            const char *end = current + text.Length();
+
+            if (current < end && *current == '-')
+            {
+                current++;
+            }
+            if (current == end)
+            {
+                return FALSE;
+            }
+            if (*current == '0')
+            {
+                current++;
+            }
+            else if (IsDigit(*current))
+            {
+                while (current < end && IsDigit(*current))
+                {
+                    current++;
+                }
+            }
+            else
+            {
+                return FALSE;
+            }
+
+            if (current < end && *current == '.')
+            {
+                current++;
+                if (current == end || !IsDigit(*current))
+                {
+                    return FALSE;
+                }
+                while (current < end && IsDigit(*current))
+                {
+                    current++;
+                }
+            }
+
+            if (current < end && (*current == 'e' || *current == 'E'))
+            {
+                current++;
+                if (current < end && (*current == '+' || *current == '-'))
+                {
+                    current++;
+                }
+                if (current == end || !IsDigit(*current))
+                {
+                    return FALSE;
+                }
+                while (current < end && IsDigit(*current))
+                {
+                    current++;
+                }
+            }
+
+            return current == end;
+        }
+
+        inline i32 HexDigit(i32 character)
+        {
+            if (character >= '0' && character <= '9')
+            {
+                return character - '0';
+            }
+            if (character >= 'a' && character <= 'f')
+            {
+                return character - 'a' + 10;
+            }
+            if (character >= 'A' && character <= 'F')
+            {
+                return character - 'A' + 10;
+            }
+            return -1;
+        }
+
+        /**
+         * Encodes a code point as UTF-8, returns the number of bytes written into `output` (at most 4).
+         */
+        u32 EncodeUtf8(u32 codePoint, char *output)
+        {
+            if (codePoint < 0x80)
+            {
+                output[0] = static_cast<char>(codePoint);
+                return 1;
+            }
+            if (codePoint < 0x800)
+            {
+                output[0] = static_cast<char>(0xC0 | (codePoint >> 6));
+                output[1] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 2;
+            }
+            if (codePoint < 0x10000)
+            {
+                output[0] = static_cast<char>(0xE0 | (codePoint >> 12));
+                output[1] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+                output[2] = static_cast<char>(0x80 | (codePoint & 0x3F));
+                return 3;
+            }
+            output[0] = static_cast<char>(0xF0 | (codePoint >> 18));
+            output[1] = static_cast<char>(0x80 | ((codePoint >> 12) & 0x3F));
+            output[2] = static_cast<char>(0x80 | ((codePoint >> 6) & 0x3F));
+            output[3] = static_cast<char>(0x80 | (codePoint & 0x3F));
+            return 4;
+        }
+    } // namespace
+
+    // ----------------- JsonReader -----------------
+
+    JsonReader::JsonReader(StringView content)
+        : m_file(INVALID_ID), m_chunk(nullptr), m_data(content.Data()), m_length(content.Length()), m_position(0),
+          m_consumed(0), m_state(State::VALUE), m_token(JsonToken::COUNT)
+    {
+    }
+
+    JsonReader::JsonReader(FileHandle file)
+        : m_file(file), m_chunk(static_cast<char *>(RPP_MALLOC(RPP_JSON_STREAM_CHUNK_SIZE))), m_data(m_chunk),
+          m_length(0), m_position(0), m_consumed(0), m_state(State::VALUE), m_token(JsonToken::COUNT)
+    {
+        RPP_ASSERT(FileSystem::IsFileOpen(file));
+    }
+
+    JsonReader::~JsonReader()
+    {
+        if (m_chunk != nullptr)
+        {
+            RPP_FREE(m_chunk);
+            m_chunk = nullptr;
+        }
+    }
+
+    JsonToken JsonReader::Next()
+    {
+        if (m_token == JsonToken::END || m_token == JsonToken::ERROR)
+        {
+            return m_token;
+        }
+
+        m_value = StringView();
+        skipWhitespace();
+        i32 character = peekChar();
+
+        switch (m_state)
+        {
+        case State::VALUE:
+            return readValue();
+
+        case State::VALUE_OR_END:
+            if (character == ']')
+            {
+                m_position++;
+                return endContainer(']');
+            }
+            return readValue();
+
+        case State::KEY_OR_END:
+            if (character == '}')
+            {
+                m_position++;
+                return endContainer('}');
+            }
+            if (character != '"')
+            {
+                return fail("Expected a key");
+            }
+            m_state = State::COLON;
+            return readString(JsonToken::KEY);
+
+        case State::COMMA_OR_END:
+            if (character == '}' || character == ']')
+            {
+                m_position++;
+                return endContainer(static_cast<char>(character));
+            }
+            if (character != ',')
+            {
+                return fail("Expected ',' or the end of the container");
+            }
+            m_position++;
+            skipWhitespace();
+
+            if (m_containers[m_containers.Size() - 1] == '[')
+            {
+                return readValue();
+            }
+            if (peekChar() != '"')
+            {
+                return fail("Expected a key");
+            }
+            m_state = State::COLON;
+            return readString(JsonToken::KEY);
+
+        case State::COLON:
+            if (character != ':')
+            {
+                return fail("Expected ':' after the key");
+            }
+            m_position++;
+            skipWhitespace();
+            return readValue();
+
+        case State::DONE:
+            if (character != -1)
+            {
+                return fail("Unexpected data after the document");
+            }
+            m_token = JsonToken::END;
+            return m_token;
+
+        default:
+            RPP_UNREACHABLE();
+        }
+
+        return m_token;
+    }
+
+    void JsonReader::Skip()
+    {
+        switch (m_token)
+        {
+        case JsonToken::KEY:
+            Next();
+            Skip();
+            break;
+
+        case JsonToken::BEGIN_OBJECT:
+        case JsonToken::BEGIN_ARRAY:
+        {
+            u32 depth = GetDepth();
+            while (Next() != JsonToken::ERROR && GetDepth() >= depth)
+            {
+            }
+            break;
+        }
+
+        default:
+            break;
+        }
+    }
+
+    i32 JsonReader::peekChar()
+    {
+        if (m_position >= m_length && !fillChunk())
+        {
+            return -1;
+        }
+        return static_cast<u8>(m_data[m_position]);
+    }
+
+    void JsonReader::skipWhitespace()
+    {
+        while (IsWhitespace(peekChar()))
+        {
+            m_position++;
+        }
+    }
+
+    b8 JsonReader::fillChunk()
+    {
+        if (m_file == INVALID_ID)
+        {
+            return FALSE;
+        }
+
+        m_consumed += m_length;
+        m_length = FileSystem::ReadChunk(m_file, m_chunk, RPP_JSON_STREAM_CHUNK_SIZE);
+        m_position = 0;
+        return m_length > 0;
+    }
+
+    JsonToken JsonReader::readValue()
+    {
+        i32 character = peekChar();
+
+        switch (character)
+        {
+        case '{':
+            m_position++;
+            return beginContainer(JsonToken::BEGIN_OBJECT);
+        case '[':
+            m_position++;
+            return beginContainer(JsonToken::BEGIN_ARRAY);
+        case '"':
+            if (readString(JsonToken::STRING) == JsonToken::ERROR)
+            {
+                return m_token;
+            }
+            return completeValue(JsonToken::STRING);
+        case 't':
+        case 'f':
+        case 'n':
+            return readLiteral();
+        case -1:
+            return fail("Unexpected end of the document");
+        default:
+            if (character == '-' || (character >= '0' && character <= '9'))
+            {
+                return readNumber();
+            }
+            return fail("Unexpected character");
+        }
+    }
+
+    JsonToken JsonReader::readString(JsonToken token)
+    {
+        m_position++; // the opening quote
+        m_text.Clear();
+        b8 copied = FALSE;
+        u32 start = m_position;
+
+        while (TRUE)
+        {
+            if (m_position >= m_length)
+            {
+                // the string continues in the next chunk, keep what we have so far
+                appendText(m_data + start, m_position - start);
+                copied = TRUE;
+                if (!fillChunk())
+                {
+                    return fail("Unterminated string");
+                }
+                start = m_position;
+                continue;
+            }
+
+            char character = m_data[m_position];
+
+            if (character == '"')
+            {
+                if (copied)
+                {
+                    appendText(m_data + start, m_position - start);
+                    m_value = StringView(m_text.Data(), m_text.Size());
+                }
+                else
+                {
+                    m_value = StringView(m_data + start, m_position - start);
+                }
+                m_position++;
+                m_token = token;
+                return m_token;
+            }
+
+            if (character == '\\')
+            {
+                appendText(m_data + start, m_position - start);
+                copied = TRUE;
+                m_position++;
+
+                i32 escaped = peekChar();
+                m_position++;
+
+                switch (escaped)
+                {
+                case '"':
+                case '\\':
+                case '/':
+                    m_text.Push(static_cast<char>(escaped));
+                    break;
+                case 'b':
+                    m_text.Push('\b');
+                    break;
+                case 'f':
+                    m_text.Push('\f');
+                    break;
+                case 'n':
+                    m_text.Push('\n');
+                    break;
+                case 'r':
+                    m_text.Push('\r');
+                    break;
+                case 't':
+                    m_text.Push('\t');
+                    break;
+                case 'u':
+                {
+                    u32 codePoint = 0;
+                    for (u32 i = 0; i < 4; i++)
+                    {
+                        i32 digit = HexDigit(peekChar());
+                        if (digit < 0)
+                        {
+                            return fail("Invalid unicode escape");
+                        }
+                        codePoint = (codePoint << 4) | static_cast<u32>(digit);
+                        m_position++;
+                    }
+
+                    // a surrogate pair is written as two escapes
+                    if (codePoint >= 0xD800 && codePoint <= 0xDBFF)
+                    {
+                        if (peekChar() != '\\')
+                        {
+                            return fail("Invalid unicode surrogate pair");
+                        }
+                        m_position++;
+                        if (peekChar() != 'u')
+                        {
+                            return fail("Invalid unicode surrogate pair");
+                        }
+                        m_position++;
+
+                        u32 lowSurrogate = 0;
+                        for (u32 i = 0; i < 4; i++)
+                        {
+                            i32 digit = HexDigit(peekChar());
+                            if (digit < 0)
+                            {
+                                return fail("Invalid unicode escape");
+                            }
+                            lowSurrogate = (lowSurrogate << 4) | static_cast<u32>(digit);
+                            m_position++;
+                        }
+
+                        if (lowSurrogate < 0xDC00 || lowSurrogate > 0xDFFF)
+                        {
+                            return fail("Invalid unicode surrogate pair");
+                        }
+                        codePoint = 0x10000 + ((codePoint - 0xD800) << 10) + (lowSurrogate - 0xDC00);
+                    }
+
+                    char encoded[4];
+                    appendText(encoded, EncodeUtf8(codePoint, encoded));
+                    break;
+                }
+                default:
+                    return fail("Invalid escape sequence");
+                }
+
+                start = m_position;
+                continue;
+            }
+
+            if (static_cast<u8>(character) < 0x20)
+            {
+                return fail("Control character inside a string");
+            }
+
+            m_position++;
+        }
+    }
+
+    JsonToken JsonReader::readNumber()
+    {
+        m_text.Clear();
+        b8 copied = FALSE;
+        u32 start = m_position;
+
+        while (TRUE)
+        {
+            if (m_position >= m_length)
+            {
+                appendText(m_data + start, m_position - start);
+                copied = TRUE;
+                if (!fillChunk())
+                {
+                    break;
+                }
+                start = m_position;
+                continue;
+            }
+
+            if (!IsNumberCharacter(m_data[m_position]))
+            {
+                if (copied)
+                {
+                    appendText(m_data + start, m_position - start);
+                }
+                break;
+            }
+            m_position++;
+        }
+
+        m_value = copied ? StringView(m_text.Data(), m_text.Size()) : StringView(m_data + start, m_position - start);
+
+        f64 number;
+        if (!IsValidNumber(m_value) || !FromChars(m_value, number))
+        {
+            return fail("Invalid number");
+        }
+        return completeValue(JsonToken::NUMBER);
+    }
+
+    JsonToken JsonReader::readLiteral()
+    {
+        char literal[6];
+        u32 length = 0;
+
+        i32 character = peekChar();
+        while (character >= 'a' && character <= 'z' && length < sizeof(literal))
+        {
+            literal[length++] = static_cast<char>(character);
+            m_position++;
+            character = peekChar();
+        }
+
+        StringView text(literal, length);
+        if (text == "true")
+        {
+            m_value = "true";
+            return completeValue(JsonToken::BOOLEAN);
+        }
+        if (text == "false")
+        {
+            m_value = "false";
+            return completeValue(JsonToken::BOOLEAN);
+        }
+        if (text == "null")
+        {
+            return completeValue(JsonToken::NULL_VALUE);
+        }
+        return fail("Invalid literal");
+    }
+
+    JsonToken JsonReader::beginContainer(JsonToken token)
+    {
+        m_containers.Push(token == JsonToken::BEGIN_OBJECT ? '{' : '[');
+        m_state = token == JsonToken::BEGIN_OBJECT ? State::KEY_OR_END : State::VALUE_OR_END;
+        m_token = token;
+        return m_token;
+    }
+
+    JsonToken JsonReader::endContainer(char closing)
+    {
+        char opening = m_containers[m_containers.Size() - 1];
+        if ((opening == '{') != (closing == '}'))
+        {
+            return fail("Mismatched closing bracket");
+        }
+
+        m_containers.Erase();
+        return completeValue(closing == '}' ? JsonToken::END_OBJECT : JsonToken::END_ARRAY);
+    }
+
+    JsonToken JsonReader::completeValue(JsonToken token)
+    {
+        m_state = m_containers.Size() == 0 ? State::DONE : State::COMMA_OR_END;
+        m_token = token;
+        return m_token;
+    }
+
+    JsonToken JsonReader::fail(StringView message)
+    {
+        m_error = Format("{} at offset {}", message, m_consumed + m_position);
+        m_value = StringView();
+        m_token = JsonToken::ERROR;
+        return m_token;
+    }
+
+    void JsonReader::appendText(const char *data, u32 length)
+    {
+        if (length == 0)
+        {
+            return;
+        }
+
+        u32 size = m_text.Size();
+        if (size + length > m_text.Capacity())
+        {
+            m_text.Reallocate(std::max(m_text.Capacity() * 2, size + length));
+        }
+        m_text.Resize(size + length);
+        memcpy(m_text.Data() + size, data, length);
+    }
+
+    // ----------------- JsonWriter -----------------
+
+    JsonWriter::JsonWriter(JsonFormat format)
+        : m_file(INVALID_ID), m_indent(format == JsonFormat::PRETTY ? 4 : 0), m_afterKey(FALSE)
+    {
+    }
+
+    JsonWriter::JsonWriter(FileHandle file, JsonFormat format)
+        : m_file(file), m_indent(format == JsonFormat::PRETTY ? 4 : 0), m_afterKey(FALSE)
+    {
+        RPP_ASSERT(FileSystem::IsFileOpen(file));
+        m_builder.Reserve(RPP_JSON_STREAM_CHUNK_SIZE);
+    }
+
+    JsonWriter::~JsonWriter()
+    {
+        RPP_ASSERT_MSG(m_file == INVALID_ID || m_builder.Length() == 0, "JsonWriter was not flushed before being destroyed.");
+    }
+
+    void JsonWriter::BeginObject()
+    {
+        beginContainer('{');
+    }
+
+    void JsonWriter::EndObject()
+    {
+        endContainer('}');
+    }
+
+    void JsonWriter::BeginArray()
+    {
+        beginContainer('[');
+    }
+
+    void JsonWriter::EndArray()
+    {
+        endContainer(']');
+    }
+
+    void JsonWriter::Key(StringView key)
+    {
+        RPP_ASSERT_MSG(m_counts.Size() > 0 && !m_afterKey, "A key can only be written inside an object.");
+
+        u32 &count = m_counts[m_counts.Size() - 1];
+        if (count > 0)
+        {
+            write(',');
+        }
+        count++;
+        writeNewline();
+
+        writeString(key);
+        write(':');
+        if (m_indent > 0)
+        {
+            write(' ');
+        }
+        m_afterKey = TRUE;
+    }
+
+    void JsonWriter::Null()
+    {
+        beginValue();
+        write(StringView("null", 4));
+    }
+
+    void JsonWriter::Copy(JsonReader &reader)
+    {
+        JsonToken token = reader.GetToken();
+        b8 isContainer = token == JsonToken::BEGIN_OBJECT || token == JsonToken::BEGIN_ARRAY;
+        u32 depth = reader.GetDepth();
+
+        while (TRUE)
+        {
+            switch (reader.GetToken())
+            {
+            case JsonToken::BEGIN_OBJECT:
+                BeginObject();
+                break;
+            case JsonToken::END_OBJECT:
+                EndObject();
+                break;
+            case JsonToken::BEGIN_ARRAY:
+                BeginArray();
+                break;
+            case JsonToken::END_ARRAY:
+                EndArray();
+                break;
+            case JsonToken::KEY:
+                Key(reader.GetString());
+                break;
+            case JsonToken::STRING:
+                Value(reader.GetString());
+                break;
+            case JsonToken::NUMBER:
+                // the original text is kept, so the number is not rounded
+                beginValue();
+                write(reader.GetString());
+                break;
+            case JsonToken::BOOLEAN:
+                Value(reader.GetString() == "true");
+                break;
+            case JsonToken::NULL_VALUE:
+                Null();
+                break;
+            default:
+                return;
+            }
+
+            // the value is complete once its container has been closed
+            if (!isContainer || reader.GetDepth() < depth)
+            {
+                return;
+            }
+            reader.Next();
+        }
+    }
+
+    void JsonWriter::Flush()
+    {
+        if (m_file == INVALID_ID || m_builder.Length() == 0)
+        {
+            return;
+        }
+
+        StringView pending = m_builder.View();
+        FileSystem::WriteChunk(m_file, pending.Data(), pending.Length());
+        m_builder.Reset();
+    }
+
+    String JsonWriter::Build()
+    {
+        RPP_ASSERT(m_file == INVALID_ID);
+        return m_builder.Build();
+    }
+
+    void JsonWriter::beginValue()
+    {
+        if (m_afterKey)
+        {
+            m_afterKey = FALSE;
+            return;
+        }
+
+        if (m_counts.Size() == 0)
+        {
+            return;
+        }
+
+        u32 &count = m_counts[m_counts.Size() - 1];
+        if (count > 0)
+        {
+            write(',');
+        }
+        count++;
+        writeNewline();
+    }
+
+    void JsonWriter::beginContainer(char opening)
+    {
+        beginValue();
+        write(opening);
+        m_counts.Push(0);
+    }
+
+    void JsonWriter::endContainer(char closing)
+    {
+        RPP_ASSERT_MSG(m_counts.Size() > 0, "No container to close.");
+
+        u32 count = m_counts[m_counts.Size() - 1];
+        m_counts.Erase();
+        if (count > 0)
+        {
+            writeNewline();
+        }
+        write(closing);
+    }
+
+    void JsonWriter::writeNewline()
+    {
+        if (m_indent == 0)
+        {
+            return;
+        }
+
+        write('\n');
+        u32 spaces = m_indent * m_counts.Size();
+        for (u32 i = 0; i < spaces; i++)
+        {
+            write(' ');
+        }
+    }
+
+    void JsonWriter::writeSigned(i64 value)
+    {
+        char digits[32];
+        write(StringView(digits, ToChars(digits, sizeof(digits), value)));
+    }
+
+    void JsonWriter::writeUnsigned(u64 value)
+    {
+        char digits[32];
+        write(StringView(digits, ToChars(digits, sizeof(digits), value)));
+    }
+
+    void JsonWriter::writeFloat(f32 value)
+    {
+        char digits[64];
+        u32 length = ToChars(digits, sizeof(digits), value);
+
+        // JSON has no representation for inf/nan
+        if (length == 0 || digits[length - 1] == 'f' || digits[length - 1] == 'n')
+        {
+            write(StringView("null", 4));
+            return;
+        }
+        write(StringView(digits, length));
+    }
+
+    void JsonWriter::writeFloat(f64 value)
+    {
+        char digits[64];
+        u32 length = ToChars(digits, sizeof(digits), value);
+
+        if (length == 0 || digits[length - 1] == 'f' || digits[length - 1] == 'n')
+        {
+            write(StringView("null", 4));
+            return;
+        }
+        write(StringView(digits, length));
+    }
+
+    void JsonWriter::writeString(StringView value)
+    {
+        static const char s_hexDigits[] = "0123456789abcdef";
+
+        write('"');
+
+        const char *data = value.Data();
+        u32 length = value.Length();
+        u32 start = 0;
+
+        for (u32 i = 0; i < length; i++)
+        {
+            u8 character = static_cast<u8>(data[i]);
+            if (character >= 0x20 && character != '"' && character != '\\')
+            {
+                continue;
+            }
+
+            write(StringView(data + start, i - start));
+            start = i + 1;
+
+            switch (character)
+            {
+            case '"':
+                write(StringView("\\\"", 2));
+                break;
+            case '\\':
+                write(StringView("\\\\", 2));
+                break;
+            case '\n':
+                write(StringView("\\n", 2));
+                break;
+            case '\r':
+                write(StringView("\\r", 2));
+                break;
+            case '\t':
+                write(StringView("\\t", 2));
+                break;
+            case '\b':
+                write(StringView("\\b", 2));
+                break;
+            case '\f':
+                write(StringView("\\f", 2));
+                break;
+            default:
+            {
+                char escaped[6] = {'\\', 'u', '0', '0', s_hexDigits[character >> 4], s_hexDigits[character & 0xF]};
+                write(StringView(escaped, sizeof(escaped)));
+                break;
+            }
+            }
+        }
+
+        write(StringView(data + start, length - start));
+        write('"');
+    }
+
+    void JsonWriter::write(StringView value)
+    {
+        m_builder.Append(value);
+        if (m_file != INVALID_ID && m_builder.Length() >= RPP_JSON_STREAM_CHUNK_SIZE)
+        {
+            Flush();
+        }
+    }
+
+    void JsonWriter::write(char value)
+    {
+        m_builder.Append(value);
+        if (m_file != INVALID_ID && m_builder.Length() >= RPP_JSON_STREAM_CHUNK_SIZE)
+        {
+            Flush();
+        }
+    }
+
+    // ----------------- JsonLinesWriter -----------------
+
+    JsonLinesWriter::JsonLinesWriter(FileHandle file)
+        : m_file(file), m_record(JsonFormat::COMPACT), m_inRecord(FALSE)
+    {
+        RPP_ASSERT(FileSystem::IsFileOpen(file));
+    }
+
+    JsonWriter &JsonLinesWriter::BeginRecord()
+    {
+        RPP_ASSERT_MSG(!m_inRecord, "JsonLinesWriter::BeginRecord called twice without EndRecord.");
+        m_inRecord = TRUE;
+        return m_record;
+    }
+
+    void JsonLinesWriter::EndRecord()
+    {
+        RPP_ASSERT_MSG(m_inRecord, "JsonLinesWriter::EndRecord called without BeginRecord.");
+        m_inRecord = FALSE;
+
+        // the compact format never contains a raw newline (they are escaped inside strings)
+        String line = m_record.Build();
+        line += "\n";
+        FileSystem::Write(m_file, line);
+    }
+} // namespace rpp
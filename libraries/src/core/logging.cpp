@@ -18,14 +18,23 @@ namespace rpp
         HandleImpl(record);
     }
 
+    void Handler::SetLevel(LogLevel level)
+    {
+        m_level = level;
+        Logging::GetInstance()->RefreshMinLevel();
+    }
+
     RPP_SINGLETON_IMPLEMENT(Logging);
 
+    LogLevel Logging::s_minLevel = LogLevel::COUNT;
+
     Logging::Logging()
     {
     }
 
     Logging::~Logging()
     {
+        s_minLevel = LogLevel::COUNT;
     }
 
     void Logging::Setup(u8 type, LogLevel level)
@@ -51,7 +60,7 @@ namespace rpp
         }
     }
 
-    void Logging::Log(LogLevel level, const String &message, const String &file, i32 line)
+    void Logging::Log(LogLevel level, StringView message, StringView file, i32 line)
     {
         LogRecord record;
         record.level = level;
@@ -71,6 +80,47 @@ namespace rpp
     void Logging::SetupHandler(Scope<Handler> &&handler)
     {
         m_handlers.Push(std::move(handler));
+        RefreshMinLevel();
+    }
+
+    void Logging::RefreshMinLevel()
+    {
+        LogLevel minLevel = LogLevel::COUNT;
+
+        u32 handlerCount = m_handlers.Size();
+        for (u32 i = 0; i < handlerCount; i++)
+        {
+            if (m_handlers[i]->GetLevel() < minLevel)
+            {
+                minLevel = m_handlers[i]->GetLevel();
+            }
+        }
+
+        s_minLevel = minLevel;
+    }
+
+    namespace
+    {
+        thread_local char s_threadBuffer[RPP_LOG_BUFFER_SIZE];
+        thread_local b8 s_isThreadBufferUsed = FALSE;
+    } // namespace
+
+    Logging::ThreadBuffer::ThreadBuffer()
+        : m_buffer(nullptr)
+    {
+        if (!s_isThreadBufferUsed)
+        {
+            s_isThreadBufferUsed = TRUE;
+            m_buffer = s_threadBuffer;
+        }
+    }
+
+    Logging::ThreadBuffer::~ThreadBuffer()
+    {
+        if (m_buffer != nullptr)
+        {
+            s_isThreadBufferUsed = FALSE;
+        }
     }
 
     template <>
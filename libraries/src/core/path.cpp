@@ -0,0 +1,232 @@
+#include "core/path.h"
+#include "core/format.h"
+#include <cstring>
+
+/// The paths up to this length are normalized without allocating a temporary buffer.
+#define PATH_STACK_BUFFER_SIZE 512
+
+namespace rpp
+{
+    namespace
+    {
+        inline b8 IsSeparator(char c)
+        {
+            return c == '/' || c == '\\';
+        }
+
+        inline b8 IsDriveLetter(char c)
+        {
+            return (c >= 'a' && c <= 'z') || (c >= 'A' && c <= 'Z');
+        }
+
+        /**
+         * @brief Returns the length of the part of a normalized path which ".." cannot remove: "/", "C:" or "C:/".
+         */
+        u32 GetRootLength(const char *data, u32 length)
+        {
+            u32 rootLength = 0;
+            if (length >= 2 && data[1] == ':' && IsDriveLetter(data[0]))
+            {
+                rootLength = 2;
+            }
+            if (rootLength < length && data[rootLength] == '/')
+            {
+                rootLength++;
+            }
+            return rootLength;
+        }
+    } // namespace
+
+    Path::Path()
+        : m_path(""), m_hash(Hash(""))
+    {
+    }
+
+    Path::Path(const char *path)
+        : Path(StringView(path))
+    {
+    }
+
+    Path::Path(const String &path)
+        : Path(StringView(path))
+    {
+    }
+
+    Path::Path(StringView path)
+        : m_hash(0)
+    {
+        normalize(path);
+    }
+
+    b8 Path::IsAbsolute() const
+    {
+        const char *data = m_path.CStr();
+        u32 length = m_path.Length();
+        return (length >= 1 && data[0] == '/') || (length >= 2 && data[1] == ':' && IsDriveLetter(data[0]));
+    }
+
+    StringView Path::GetFileName() const
+    {
+        const char *data = m_path.CStr();
+        u32 length = m_path.Length();
+        u32 rootLength = GetRootLength(data, length);
+
+        u32 start = length;
+        while (start > rootLength && data[start - 1] != '/')
+        {
+            start--;
+        }
+        return StringView(data + start, length - start);
+    }
+
+    StringView Path::GetExtension() const
+    {
+        StringView fileName = GetFileName();
+        if (fileName == "..")
+        {
+            return StringView();
+        }
+
+        // a leading dot names a hidden file (".gitignore"), it does not start an extension
+        for (u32 i = fileName.Length(); i > 1; i--)
+        {
+            if (fileName[i - 1] == '.')
+            {
+                return StringView(fileName.Data() + i - 1, fileName.Length() - i + 1);
+            }
+        }
+        return StringView();
+    }
+
+    Path Path::GetParent() const
+    {
+        const char *data = m_path.CStr();
+        u32 length = m_path.Length();
+        u32 rootLength = GetRootLength(data, length);
+
+        u32 end = length;
+        while (end > rootLength && data[end - 1] != '/')
+        {
+            end--;
+        }
+
+        // drop the separator before the last part, unless it is the one of the root
+        if (end > rootLength)
+        {
+            end--;
+        }
+        return fromNormalized(StringView(data, end));
+    }
+
+    Path Path::Join(StringView relativePath) const
+    {
+        if (m_path.Length() == 0)
+        {
+            return Path(relativePath);
+        }
+        return Path(Format("{}/{}", m_path, relativePath));
+    }
+
+    u32 Path::Hash(StringView path)
+    {
+        const char *data = path.Data();
+        u32 hash = 2166136261u;
+        for (u32 i = 0; i < path.Length(); i++)
+        {
+            hash ^= static_cast<u8>(data[i]);
+            hash *= 16777619u;
+        }
+        return hash;
+    }
+
+    Path Path::fromNormalized(StringView path)
+    {
+        Path result;
+        result.m_path = String(path.Data(), path.Length());
+        result.m_hash = Hash(path);
+        return result;
+    }
+
+    void Path::normalize(StringView path)
+    {
+        const char *data = path.Data();
+        u32 length = path.Length();
+
+        // the normalized path is never longer than the input, except "." for an input which folds to nothing
+        char stackBuffer[PATH_STACK_BUFFER_SIZE];
+        char *buffer = length + 1 <= PATH_STACK_BUFFER_SIZE ? stackBuffer : static_cast<char *>(RPP_MALLOC(length + 1));
+        u32 bufferLength = 0;
+        u32 index = 0;
+
+        if (length >= 2 && data[1] == ':' && IsDriveLetter(data[0]))
+        {
+            buffer[bufferLength++] = data[0];
+            buffer[bufferLength++] = ':';
+            index = 2;
+        }
+        if (index < length && IsSeparator(data[index]))
+        {
+            buffer[bufferLength++] = '/';
+            index++;
+        }
+        u32 rootLength = bufferLength;
+
+        while (index < length)
+        {
+            u32 partStart = index;
+            while (index < length && !IsSeparator(data[index]))
+            {
+                index++;
+            }
+            u32 partLength = index - partStart;
+            index++; // the separator
+
+            if (partLength == 0 || (partLength == 1 && data[partStart] == '.'))
+            {
+                continue;
+            }
+
+            if (partLength == 2 && data[partStart] == '.' && data[partStart + 1] == '.')
+            {
+                u32 lastStart = bufferLength;
+                while (lastStart > rootLength && buffer[lastStart - 1] != '/')
+                {
+                    lastStart--;
+                }
+
+                b8 hasParent = bufferLength > rootLength &&
+                               !(bufferLength - lastStart == 2 && buffer[lastStart] == '.' && buffer[lastStart + 1] == '.');
+                if (hasParent)
+                {
+                    bufferLength = lastStart > rootLength ? lastStart - 1 : rootLength;
+                    continue;
+                }
+
+                if (rootLength > 0 && buffer[rootLength - 1] == '/')
+                {
+                    continue; // there is nothing above the root
+                }
+            }
+
+            if (bufferLength > rootLength)
+            {
+                buffer[bufferLength++] = '/';
+            }
+            memcpy(buffer + bufferLength, data + partStart, partLength);
+            bufferLength += partLength;
+        }
+
+        if (bufferLength == 0 && length > 0)
+        {
+            buffer[bufferLength++] = '.';
+        }
+
+        m_path = String(buffer, bufferLength);
+        m_hash = Hash(StringView(buffer, bufferLength));
+
+        if (buffer != stackBuffer)
+        {
+            RPP_FREE(buffer);
+        }
+    }
+} // namespace rpp
@@ -3,6 +3,7 @@
 #include "platforms/platforms.h"
 #include "core/assertions.h"
 #include "platforms/timer.h"
+#include "core/string_builder.h"
 #include <cstring>
 
 #define INDENT_LENGTH 3
@@ -64,14 +65,18 @@ namespace rpp
 
     static String GetIndentString(u32 indent)
     {
-        String result = Format("{}", indent);
+        String number = Format("{}", indent);
 
-        while (result.Length() < INDENT_LENGTH)
+        StringBuilder builder;
+        builder.Reserve(INDENT_LENGTH > number.Length() ? INDENT_LENGTH : number.Length());
+
+        for (u32 i = number.Length(); i < INDENT_LENGTH; i++)
         {
-            result = String(" ") + result;
+            builder.Append(' ');
         }
+        builder.Append(number);
 
-        return result;
+        return builder.Build();
     }
 
     Profiling::Profiling(const String &file, const String &funcName, u32 line)
@@ -0,0 +1,358 @@
+#include "core/simd.h"
+#include <cstring>
+
+#if defined(__x86_64__) || defined(_M_X64) || defined(__i386__) || defined(_M_IX86)
+#define RPP_SIMD_X86
+#include <immintrin.h>
+#if defined(_MSC_VER)
+#include <intrin.h>
+#define RPP_TARGET_SSE2
+#define RPP_TARGET_AVX2
+#else
+#define RPP_TARGET_SSE2 __attribute__((target("sse2")))
+#define RPP_TARGET_AVX2 __attribute__((target("avx2")))
+#endif
+#endif
+
+namespace rpp
+{
+    namespace
+    {
+        inline u32 CountTrailingZeros(u32 mask)
+        {
+#if defined(_MSC_VER)
+            unsigned long index;
+            _BitScanForward(&index, mask);
+            return static_cast<u32>(index);
+#else
+            return static_cast<u32>(__builtin_ctz(mask));
+#endif
+        }
+
+        // ----------------- SCALAR -----------------
+
+        const char *FindCharScalar(const char *data, u32 length, char character)
+        {
+            return static_cast<const char *>(memchr(data, character, length));
+        }
+
+        i32 FindScalar(const char *haystack, u32 haystackLength, const char *needle, u32 needleLength)
+        {
+            if (needleLength > haystackLength)
+            {
+                return -1;
+            }
+
+            const char *cursor = haystack;
+            const char *last = haystack + haystackLength - needleLength;
+
+            while (cursor <= last)
+            {
+                const char *found = static_cast<const char *>(memchr(cursor, needle[0], last - cursor + 1));
+                if (found == nullptr)
+                {
+                    return -1;
+                }
+
+                if (memcmp(found + 1, needle + 1, needleLength - 1) == 0)
+                {
+                    return static_cast<i32>(found - haystack);
+                }
+
+                cursor = found + 1;
+            }
+
+            return -1;
+        }
+
+        void ChangeCaseScalar(char *destination, const char *source, u32 length, char first, char last)
+        {
+            for (u32 i = 0; i < length; i++)
+            {
+                char character = source[i];
+                destination[i] = (character >= first && character <= last) ? static_cast<char>(character ^ 0x20) : character;
+            }
+        }
+
+#if defined(RPP_SIMD_X86)
+        // ----------------- SSE2 -----------------
+
+        RPP_TARGET_SSE2 const char *FindCharSSE2(const char *data, u32 length, char character)
+        {
+            const __m128i target = _mm_set1_epi8(character);
+            u32 index = 0;
+
+            for (; index + 16 <= length; index += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(data + index));
+                u32 mask = static_cast<u32>(_mm_movemask_epi8(_mm_cmpeq_epi8(block, target)));
+                if (mask != 0)
+                {
+                    return data + index + CountTrailingZeros(mask);
+                }
+            }
+
+            return FindCharScalar(data + index, length - index, character);
+        }
+
+        /**
+         * Compares the first and the last character of the needle at 16 positions at once, and only runs memcmp
+         * for the positions where both match.
+         */
+        RPP_TARGET_SSE2 i32 FindSSE2(const char *haystack, u32 haystackLength, const char *needle, u32 needleLength)
+        {
+            const __m128i first = _mm_set1_epi8(needle[0]);
+            const __m128i last = _mm_set1_epi8(needle[needleLength - 1]);
+            u32 candidatesEnd = haystackLength - needleLength + 1;
+            u32 index = 0;
+
+            for (; index + 16 <= candidatesEnd; index += 16)
+            {
+                __m128i blockFirst = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + index));
+                __m128i blockLast = _mm_loadu_si128(reinterpret_cast<const __m128i *>(haystack + index + needleLength - 1));
+                u32 mask = static_cast<u32>(_mm_movemask_epi8(_mm_and_si128(_mm_cmpeq_epi8(blockFirst, first), _mm_cmpeq_epi8(blockLast, last))));
+
+                while (mask != 0)
+                {
+                    u32 offset = CountTrailingZeros(mask);
+                    if (memcmp(haystack + index + offset + 1, needle + 1, needleLength - 1) == 0)
+                    {
+                        return static_cast<i32>(index + offset);
+                    }
+                    mask &= mask - 1;
+                }
+            }
+
+            i32 found = FindScalar(haystack + index, haystackLength - index, needle, needleLength);
+            return found == -1 ? -1 : static_cast<i32>(index) + found;
+        }
+
+        RPP_TARGET_SSE2 void ChangeCaseSSE2(char *destination, const char *source, u32 length, char first)
+        {
+            // (c - first) lands in [-128, -103] (signed) exactly for the 26 letters of the range
+            const __m128i shift = _mm_set1_epi8(static_cast<char>(0x80 - first));
+            const __m128i bound = _mm_set1_epi8(static_cast<char>(-128 + 26));
+            const __m128i flip = _mm_set1_epi8(0x20);
+            u32 index = 0;
+
+            for (; index + 16 <= length; index += 16)
+            {
+                __m128i block = _mm_loadu_si128(reinterpret_cast<const __m128i *>(source + index));
+                __m128i inRange = _mm_cmplt_epi8(_mm_add_epi8(block, shift), bound);
+                block = _mm_xor_si128(block, _mm_and_si128(inRange, flip));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(destination + index), block);
+            }
+
+            ChangeCaseScalar(destination + index, source + index, length - index, first, static_cast<char>(first + 25));
+        }
+
+        // ----------------- AVX2 -----------------
+
+        RPP_TARGET_AVX2 const char *FindCharAVX2(const char *data, u32 length, char character)
+        {
+            const __m256i target = _mm256_set1_epi8(character);
+            u32 index = 0;
+
+            for (; index + 32 <= length; index += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(data + index));
+                u32 mask = static_cast<u32>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(block, target)));
+                if (mask != 0)
+                {
+                    return data + index + CountTrailingZeros(mask);
+                }
+            }
+
+            return FindCharSSE2(data + index, length - index, character);
+        }
+
+        RPP_TARGET_AVX2 i32 FindAVX2(const char *haystack, u32 haystackLength, const char *needle, u32 needleLength)
+        {
+            const __m256i first = _mm256_set1_epi8(needle[0]);
+            const __m256i last = _mm256_set1_epi8(needle[needleLength - 1]);
+            u32 candidatesEnd = haystackLength - needleLength + 1;
+            u32 index = 0;
+
+            for (; index + 32 <= candidatesEnd; index += 32)
+            {
+                __m256i blockFirst = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + index));
+                __m256i blockLast = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(haystack + index + needleLength - 1));
+                u32 mask = static_cast<u32>(_mm256_movemask_epi8(_mm256_and_si256(_mm256_cmpeq_epi8(blockFirst, first), _mm256_cmpeq_epi8(blockLast, last))));
+
+                while (mask != 0)
+                {
+                    u32 offset = CountTrailingZeros(mask);
+                    if (memcmp(haystack + index + offset + 1, needle + 1, needleLength - 1) == 0)
+                    {
+                        return static_cast<i32>(index + offset);
+                    }
+                    mask &= mask - 1;
+                }
+            }
+
+            i32 found = FindSSE2(haystack + index, haystackLength - index, needle, needleLength);
+            return found == -1 ? -1 : static_cast<i32>(index) + found;
+        }
+
+        RPP_TARGET_AVX2 void ChangeCaseAVX2(char *destination, const char *source, u32 length, char first)
+        {
+            const __m256i shift = _mm256_set1_epi8(static_cast<char>(0x80 - first));
+            const __m256i bound = _mm256_set1_epi8(static_cast<char>(-128 + 26));
+            const __m256i flip = _mm256_set1_epi8(0x20);
+            u32 index = 0;
+
+            for (; index + 32 <= length; index += 32)
+            {
+                __m256i block = _mm256_loadu_si256(reinterpret_cast<const __m256i *>(source + index));
+                __m256i inRange = _mm256_cmpgt_epi8(bound, _mm256_add_epi8(block, shift));
+                block = _mm256_xor_si256(block, _mm256_and_si256(inRange, flip));
+                _mm256_storeu_si256(reinterpret_cast<__m256i *>(destination + index), block);
+            }
+
+            ChangeCaseSSE2(destination + index, source + index, length - index, first);
+        }
+#endif
+
+        SimdLevel DetectLevel()
+        {
+#if defined(RPP_SIMD_X86)
+#if defined(_MSC_VER)
+            int info[4];
+            __cpuid(info, 0);
+            if (info[0] >= 7)
+            {
+                __cpuidex(info, 7, 0);
+                b8 hasAVX2 = (info[1] & (1 << 5)) != 0;
+
+                // the OS must also save the YMM registers (OSXSAVE + XCR0)
+                __cpuid(info, 1);
+                b8 hasOSXSave = (info[2] & (1 << 27)) != 0;
+                if (hasAVX2 && hasOSXSave && (_xgetbv(0) & 0x6) == 0x6)
+                {
+                    return SimdLevel::AVX2;
+                }
+            }
+            return SimdLevel::SSE2;
+#else
+            __builtin_cpu_init();
+            if (__builtin_cpu_supports("avx2"))
+            {
+                return SimdLevel::AVX2;
+            }
+            if (__builtin_cpu_supports("sse2"))
+            {
+                return SimdLevel::SSE2;
+            }
+            return SimdLevel::SCALAR;
+#endif
+#else
+            return SimdLevel::SCALAR;
+#endif
+        }
+
+        SimdLevel &CurrentLevel()
+        {
+            static SimdLevel s_level = DetectLevel();
+            return s_level;
+        }
+    } // namespace
+
+    SimdLevel Simd::GetLevel()
+    {
+        return CurrentLevel();
+    }
+
+    SimdLevel Simd::GetSupportedLevel()
+    {
+        static SimdLevel s_supportedLevel = DetectLevel();
+        return s_supportedLevel;
+    }
+
+    void Simd::SetLevel(SimdLevel level)
+    {
+        SimdLevel supportedLevel = GetSupportedLevel();
+        CurrentLevel() = level < supportedLevel ? level : supportedLevel;
+    }
+
+    const char *Simd::FindChar(const char *data, u32 length, char character)
+    {
+        switch (CurrentLevel())
+        {
+#if defined(RPP_SIMD_X86)
+        case SimdLevel::AVX2:
+            return FindCharAVX2(data, length, character);
+        case SimdLevel::SSE2:
+            return FindCharSSE2(data, length, character);
+#endif
+        default:
+            return FindCharScalar(data, length, character);
+        }
+    }
+
+    i32 Simd::Find(const char *haystack, u32 haystackLength, const char *needle, u32 needleLength)
+    {
+        if (needleLength == 0)
+        {
+            return 0;
+        }
+
+        if (needleLength > haystackLength)
+        {
+            return -1;
+        }
+
+        if (needleLength == 1)
+        {
+            const char *found = FindChar(haystack, haystackLength, needle[0]);
+            return found != nullptr ? static_cast<i32>(found - haystack) : -1;
+        }
+
+        switch (CurrentLevel())
+        {
+#if defined(RPP_SIMD_X86)
+        case SimdLevel::AVX2:
+            return FindAVX2(haystack, haystackLength, needle, needleLength);
+        case SimdLevel::SSE2:
+            return FindSSE2(haystack, haystackLength, needle, needleLength);
+#endif
+        default:
+            return FindScalar(haystack, haystackLength, needle, needleLength);
+        }
+    }
+
+    void Simd::ToLower(char *destination, const char *source, u32 length)
+    {
+        switch (CurrentLevel())
+        {
+#if defined(RPP_SIMD_X86)
+        case SimdLevel::AVX2:
+            ChangeCaseAVX2(destination, source, length, 'A');
+            break;
+        case SimdLevel::SSE2:
+            ChangeCaseSSE2(destination, source, length, 'A');
+            break;
+#endif
+        default:
+            ChangeCaseScalar(destination, source, length, 'A', 'Z');
+            break;
+        }
+    }
+
+    void Simd::ToUpper(char *destination, const char *source, u32 length)
+    {
+        switch (CurrentLevel())
+        {
+#if defined(RPP_SIMD_X86)
+        case SimdLevel::AVX2:
+            ChangeCaseAVX2(destination, source, length, 'a');
+            break;
+        case SimdLevel::SSE2:
+            ChangeCaseSSE2(destination, source, length, 'a');
+            break;
+#endif
+        default:
+            ChangeCaseScalar(destination, source, length, 'a', 'z');
+            break;
+        }
+    }
+} // namespace rpp
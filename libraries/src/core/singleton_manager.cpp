@@ -31,8 +31,8 @@ namespace rpp
         s_singletonEntries.reset();
     }
 
-    void SingletonManager::RegisterSingleton(const String &name, void *instance, SingletonDestroyFunc destroyFunc)
+    void SingletonManager::RegisterSingleton(StringView name, void *instance, SingletonDestroyFunc destroyFunc)
     {
-        s_singletonEntries->Push(SingletonEntry{name, instance, destroyFunc});
+        s_singletonEntries->Push(SingletonEntry{StringPool::Intern(name), instance, destroyFunc});
     }
 } // namespace rpp
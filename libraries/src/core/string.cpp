@@ -1,84 +1,111 @@
 #include "core/string.h"
+#include "core/simd.h"
 #include <cstring>
 #include <stdexcept>
 
 namespace rpp
 {
     String::String()
+        : m_data(m_inlineData), m_length(0), m_capacity(RPP_STRING_SSO_CAPACITY)
     {
-#if 0
-        m_data = RPP_NEW(char[1]{'\0'});
-#else
-        RPP_NEW_ARRAY(m_data, char, 1);
-        memset(m_data, 0, 1);
-#endif
+        m_inlineData[0] = '\0';
     }
 
     String::String(const char *str)
+        : String()
     {
         if (str)
         {
-            size_t len = std::strlen(str);
-#if 0
-            m_data = RPP_NEW(char[len + 1]);
-#else
-            RPP_NEW_ARRAY(m_data, char, len + 1);
-            memset(m_data, 0, len + 1);
-#endif
-            memcpy(m_data, str, len + 1);
+            assign(str, static_cast<u32>(std::strlen(str)));
         }
-        else
+    }
+
+    String::String(const char *str, u32 length)
+        : String()
+    {
+        if (str)
         {
-#if 0
-            m_data = RPP_NEW(char[1]{'\0'});
-#else
-            RPP_NEW_ARRAY(m_data, char, 1);
-            memset(m_data, 0, 1);
-#endif
+            assign(str, length);
         }
     }
 
     String::String(const String &other)
+        : String()
     {
-        size_t len = std::strlen(other.m_data);
-#if 0
-        m_data = RPP_NEW(char[len + 1]);
-#else
-        RPP_NEW_ARRAY(m_data, char, len + 1);
-        memset(m_data, 0, len + 1);
-#endif
-        memcpy(m_data, other.m_data, len + 1);
+        assign(other.m_data, other.m_length);
     }
 
     String::String(String &&other) noexcept
+        : String()
     {
-        m_data = other.m_data;
-        other.m_data = nullptr;
+        *this = std::move(other);
     }
 
     String::~String()
     {
-        if (m_data != nullptr)
+        release();
+    }
+
+    void String::Reserve(u32 capacity)
+    {
+        if (capacity <= m_capacity)
+        {
+            return;
+        }
+
+        char *newData = static_cast<char *>(RPP_MALLOC(capacity + 1));
+        memcpy(newData, m_data, m_length + 1);
+
+        if (!isInline())
         {
-            // RPP_DELETE_ARRAY(m_data, char, Length() + 1);
             RPP_FREE(m_data);
-            m_data = nullptr;
         }
+
+        m_data = newData;
+        m_capacity = capacity;
     }
 
-    u32 String::Length() const
+    void String::assign(const char *str, u32 length)
     {
-        return static_cast<u32>(std::strlen(m_data));
+        if (length > m_capacity)
+        {
+            // `str` may point into the current buffer, it is copied before that buffer is released
+            char *newData = static_cast<char *>(RPP_MALLOC(length + 1));
+            memcpy(newData, str, length);
+            newData[length] = '\0';
+
+            if (!isInline())
+            {
+                RPP_FREE(m_data);
+            }
+
+            m_data = newData;
+            m_capacity = length;
+            m_length = length;
+            return;
+        }
+
+        memmove(m_data, str, length);
+        m_data[length] = '\0';
+        m_length = length;
     }
 
-    const char *String::CStr() const
+    void String::release()
     {
-        return m_data;
+        if (!isInline())
+        {
+            RPP_FREE(m_data);
+        }
+
+        m_data = m_inlineData;
+        m_inlineData[0] = '\0';
+        m_length = 0;
+        m_capacity = RPP_STRING_SSO_CAPACITY;
     }
 
     char String::operator[](u32 index) const
     {
-        if (index >= Length())
+        if (index >= m_length)
         {
             throw std::out_of_range("Index out of range");
         }
@@ -89,204 +116,223 @@ namespace rpp
     {
         if (this != &other)
         {
-            // delete[] m_data;
-            RPP_FREE(m_data);
-            size_t len = std::strlen(other.m_data);
-#if 0
-            m_data = RPP_NEW(char[len + 1]);
-#else
-            RPP_NEW_ARRAY(m_data, char, len + 1);
-            memset(m_data, 0, len + 1);
-#endif
-            // std::strcpy(m_data, other.m_data);
-            memcpy(m_data, other.m_data, len + 1);
+            assign(other.m_data, other.m_length);
         }
     }
 
-    String String::operator+(const String &other)
+    void String::operator=(String &&other) noexcept
     {
-        return Concat(other);
-    }
+        if (this == &other)
+        {
+            return;
+        }
 
-    void String::operator+=(const String &other)
-    {
-        String result = Concat(other);
-        *this = result;
+        if (other.isInline())
+        {
+            assign(other.m_data, other.m_length);
+        }
+        else
+        {
+            release();
+            m_data = other.m_data;
+            m_length = other.m_length;
+            m_capacity = other.m_capacity;
+
+            other.m_data = other.m_inlineData;
+        }
+
+        other.release();
     }
 
-    b8 String::operator==(const String &other) const
+    String String::operator+(StringView other)
     {
-        return std::strcmp(m_data, other.m_data) == 0;
+        return Concat(other);
     }
 
-    i32 String::Find(const String &substr, u32 startIndex) const
+    void String::operator+=(StringView other)
     {
-        if (startIndex >= Length())
+        u32 newLength = m_length + other.Length();
+
+        if (newLength > m_capacity)
         {
-            return -1;
-        }
+            u32 newCapacity = m_capacity * 2 > newLength ? m_capacity * 2 : newLength;
 
-        const char *found = std::strstr(m_data + startIndex, substr.m_data);
-        if (found)
+            // `other` may point into this string, so the old buffer is kept alive until the copy is done
+            char *newData = static_cast<char *>(RPP_MALLOC(newCapacity + 1));
+            memcpy(newData, m_data, m_length);
+            memcpy(newData + m_length, other.Data(), other.Length());
+
+            if (!isInline())
+            {
+                RPP_FREE(m_data);
+            }
+
+            m_data = newData;
+            m_capacity = newCapacity;
+        }
+        else
         {
-            return static_cast<i32>(found - m_data);
+            memmove(m_data + m_length, other.Data(), other.Length());
         }
-        return -1;
+
+        m_length = newLength;
+        m_data[m_length] = '\0';
+    }
+
+    b8 String::operator==(StringView other) const
+    {
+        return StringView(*this) == other;
+    }
+
+    i32 String::Find(StringView substr, u32 startIndex) const
+    {
+        return StringView(*this).Find(substr, startIndex);
     }
 
     String String::SubString(u32 startIndex, i32 length) const
     {
-        if (startIndex >= Length())
+        if (startIndex >= m_length)
         {
             return String();
         }
 
         u32 finalLength = 0;
 
-        if (length == -1 || u32(length) + startIndex > Length())
+        if (length == -1 || u32(length) + startIndex > m_length)
         {
-            finalLength = Length() - startIndex;
+            finalLength = m_length - startIndex;
         }
         else
         {
             finalLength = static_cast<u32>(length);
         }
 
-#if 0
-        char *subStr = RPP_NEW(char[finalLength + 1]);
-#else
-        char *subStr = nullptr;
-        RPP_NEW_ARRAY(subStr, char, finalLength + 1);
-        memset(subStr, 0, finalLength + 1);
-#endif
-        // std::strncpy(subStr, m_data + startIndex, finalLength);
-        memcpy(subStr, m_data + startIndex, finalLength);
-        subStr[finalLength] = '\0';
-
-        String result(subStr);
-        RPP_FREE(subStr);
-        return result;
+        return String(m_data + startIndex, finalLength);
     }
 
-    String String::Replace(const String &oldSubstr, const String &newSubstr, b8 replaceAll)
+    String String::Replace(StringView oldSubstr, StringView newSubstr, b8 replaceAll)
     {
+        if (oldSubstr.Empty())
+        {
+            return *this;
+        }
+
+        StringView source = *this;
         String result;
-        i32 startIndex = 0;
-        u32 oldLength = oldSubstr.Length();
+        u32 startIndex = 0;
 
         while (TRUE)
         {
-            i32 foundIndex = Find(oldSubstr, startIndex);
+            i32 foundIndex = source.Find(oldSubstr, startIndex);
 
             if (foundIndex == -1)
             {
-                result += SubString(startIndex);
                 break;
             }
 
-            result += SubString(startIndex, foundIndex - startIndex);
+            result += source.SubView(startIndex, foundIndex - startIndex);
             result += newSubstr;
 
             startIndex = foundIndex + oldSubstr.Length();
 
             if (!replaceAll)
             {
-                result += SubString(startIndex);
                 break; // Replace only the first occurrence
             }
         }
 
+        result += source.SubView(startIndex);
         return result;
     }
 
-    String String::Concat(const String &other) const
+    String String::Concat(StringView other) const
     {
-        size_t len1 = std::strlen(m_data);
-        size_t len2 = std::strlen(other.m_data);
-#if 0
-        char *newData = RPP_NEW(char[len1 + len2 + 1]);
-#else
-        char *newData = nullptr;
-        RPP_NEW_ARRAY(newData, char, len1 + len2 + 1);
-
-        memset(newData, 0, len1 + len2 + 1);
-#endif
-        memcpy(newData, m_data, len1);
-        memcpy(newData + len1, other.m_data, len2);
-
-        newData[len1 + len2] = '\0';
-        String result(newData);
-        RPP_FREE(newData);
+        String result;
+        result.Reserve(m_length + other.Length());
+
+        memcpy(result.m_data, m_data, m_length);
+        memcpy(result.m_data + m_length, other.Data(), other.Length());
+        result.m_length = m_length + other.Length();
+        result.m_data[result.m_length] = '\0';
+
         return result;
     }
 
-    void String::Split(Array<String> &outParts, const String &delimiter) const
+    void String::Split(Array<String> &outParts, StringView delimiter) const
     {
-        u32 start = 0;
-        u32 delimLength = delimiter.Length();
+        StringView source = *this;
 
-        while (start <= Length())
+        if (delimiter.Empty())
         {
-            if (start == Length())
-            {
-                outParts.Push(String());
-                break;
-            }
+            outParts.Push(*this);
+            return;
+        }
+
+        u32 start = 0;
 
-            i32 delimIndex = Find(delimiter, start);
+        while (TRUE)
+        {
+            i32 delimIndex = source.Find(delimiter, start);
             if (delimIndex == -1)
             {
-                outParts.Push(SubString(start));
+                outParts.Push(String(m_data + start, m_length - start));
                 break;
             }
-            outParts.Push(SubString(start, delimIndex - start));
-            start = delimIndex + delimLength;
+
+            outParts.Push(String(m_data + start, delimIndex - start));
+            start = delimIndex + delimiter.Length();
         }
     }
 
-    b8 String::EndsWith(const String &suffix) const
+    void String::Split(Array<StringView> &outParts, StringView delimiter) const
     {
-        // TODO: Next can be used with regex for more complex patterns
-        u32 strLength = Length();
-        u32 suffixLength = suffix.Length();
+        StringView(*this).Split(outParts, delimiter);
+    }
 
-        if (suffixLength > strLength)
-        {
-            return FALSE;
-        }
+    b8 String::StartsWith(StringView prefix) const
+    {
+        return StringView(*this).StartsWith(prefix);
+    }
 
-        return std::strcmp(m_data + strLength - suffixLength, suffix.m_data) == 0;
+    b8 String::EndsWith(StringView suffix) const
+    {
+        // TODO: Next can be used with regex for more complex patterns
+        return StringView(*this).EndsWith(suffix);
     }
 
     String String::ToLowerCase() const
     {
-        size_t len = std::strlen(m_data);
-#if 0
-        char *lowerData = RPP_NEW(char[len + 1]);
-#else
-        char *lowerData = nullptr;
-        RPP_NEW_ARRAY(lowerData, char, len + 1);
-        memset(lowerData, 0, len + 1);
-#endif
-        for (size_t i = 0; i < len; i++)
-        {
-            lowerData[i] = static_cast<char>(std::tolower(m_data[i]));
-        }
-        lowerData[len] = '\0';
-        String result(lowerData);
-        RPP_FREE(lowerData);
+        String result(m_data, m_length);
+        Simd::ToLower(result.m_data, result.m_data, m_length);
+        return result;
+    }
+
+    String String::ToUpperCase() const
+    {
+        String result(m_data, m_length);
+        Simd::ToUpper(result.m_data, result.m_data, m_length);
         return result;
     }
 
-    String String::Join(const Array<String> &parts, const String &delimiter)
+    String String::Join(const Array<String> &parts, StringView delimiter)
     {
         if (parts.Size() == 0)
         {
             return String();
         }
 
-        String result = parts[0];
-        for (u32 i = 1; i < parts.Size(); i++)
+        u32 partsCount = parts.Size();
+        u32 totalLength = delimiter.Length() * (partsCount - 1);
+        for (u32 i = 0; i < partsCount; i++)
+        {
+            totalLength += parts[i].Length();
+        }
+
+        String result;
+        result.Reserve(totalLength);
+
+        result += parts[0];
+        for (u32 i = 1; i < partsCount; i++)
         {
             result += delimiter;
             result += parts[i];
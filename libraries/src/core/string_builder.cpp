@@ -0,0 +1,64 @@
+#include "core/string_builder.h"
+
+namespace rpp
+{
+    StringBuilder::StringBuilder()
+    {
+    }
+
+    StringBuilder::~StringBuilder()
+    {
+    }
+
+    void StringBuilder::Reserve(u32 capacity)
+    {
+        m_buffer.Reserve(capacity);
+    }
+
+    StringBuilder &StringBuilder::Append(StringView value)
+    {
+        m_buffer += value;
+        return *this;
+    }
+
+    StringBuilder &StringBuilder::Append(char value)
+    {
+        m_buffer += StringView(&value, 1);
+        return *this;
+    }
+
+    StringBuilder &StringBuilder::appendFormat(StringView formatMessage, const details::FormatArgument *arguments,
+                                               u32 argumentCount)
+    {
+        // the spare capacity is tried first, the buffer only grows when the output does not fit into it
+        u32 spare = m_buffer.m_capacity - m_buffer.m_length;
+        u32 length = details::FormatPatternTo(m_buffer.m_data + m_buffer.m_length, spare + 1, formatMessage, arguments,
+                                              argumentCount);
+        if (length > spare)
+        {
+            m_buffer.Reserve(m_buffer.m_length + length);
+            details::FormatPatternTo(m_buffer.m_data + m_buffer.m_length, length + 1, formatMessage, arguments,
+                                     argumentCount);
+        }
+
+        m_buffer.m_length += length;
+        return *this;
+    }
+
+    void StringBuilder::Clear()
+    {
+        // moving the content out gives the heap buffer to the temporary, which frees it
+        String released = std::move(m_buffer);
+    }
+
+    void StringBuilder::Reset()
+    {
+        m_buffer.m_length = 0;
+        m_buffer.m_data[0] = '\0';
+    }
+
+    String StringBuilder::Build()
+    {
+        return std::move(m_buffer);
+    }
+} // namespace rpp
@@ -0,0 +1,235 @@
+#include "core/string_id.h"
+#include <cstdlib>
+#include <cstring>
+#include <new>
+#include <mutex>
+#include <shared_mutex>
+
+#define STRING_POOL_PAGE_SIZE 1024
+#define STRING_POOL_MAX_PAGES 4096
+#define STRING_POOL_BLOCK_SIZE (64 * 1024)
+#define STRING_POOL_INITIAL_BUCKETS 1024
+
+namespace rpp
+{
+    namespace
+    {
+        struct InternEntry
+        {
+            const char *data;
+            u32 length;
+            u32 hash;
+        };
+
+        /**
+         * The pool state. Entries are stored in fixed-size pages which never move, so `Resolve` can read them
+         * without taking the lock. The hash table maps to `entry index + 1` (0 marks an empty bucket).
+         */
+        struct StringPoolData
+        {
+            std::shared_mutex mutex;
+
+            InternEntry *pages[STRING_POOL_MAX_PAGES];
+            u32 count;
+
+            u32 *buckets;
+            u32 bucketCount;
+
+            char *block;
+            u32 blockUsed;
+            u32 blockSize;
+        };
+
+        StringPoolData &GetPoolData()
+        {
+            // intentionally never destroyed: ids may be resolved from other static destructors
+            static StringPoolData *s_pData = []()
+            {
+                StringPoolData *pData = new (std::malloc(sizeof(StringPoolData))) StringPoolData();
+                pData->count = 0;
+                pData->bucketCount = STRING_POOL_INITIAL_BUCKETS;
+                pData->buckets = static_cast<u32 *>(std::calloc(pData->bucketCount, sizeof(u32)));
+                pData->block = nullptr;
+                pData->blockUsed = 0;
+                pData->blockSize = 0;
+                return pData;
+            }();
+
+            return *s_pData;
+        }
+
+        u32 HashString(StringView value)
+        {
+            // FNV-1a
+            u32 hash = 2166136261u;
+            const char *data = value.Data();
+            for (u32 i = 0; i < value.Length(); i++)
+            {
+                hash ^= static_cast<u8>(data[i]);
+                hash *= 16777619u;
+            }
+            return hash;
+        }
+
+        inline InternEntry &GetEntry(StringPoolData &pool, u32 index)
+        {
+            return pool.pages[index / STRING_POOL_PAGE_SIZE][index % STRING_POOL_PAGE_SIZE];
+        }
+
+        /**
+         * Returns the bucket which holds the string or the empty bucket where it should be inserted.
+         */
+        u32 FindBucket(StringPoolData &pool, StringView value, u32 hash)
+        {
+            u32 mask = pool.bucketCount - 1;
+            u32 bucket = hash & mask;
+
+            while (pool.buckets[bucket] != 0)
+            {
+                const InternEntry &entry = GetEntry(pool, pool.buckets[bucket] - 1);
+                if (entry.hash == hash && entry.length == value.Length() && memcmp(entry.data, value.Data(), value.Length()) == 0)
+                {
+                    break;
+                }
+
+                bucket = (bucket + 1) & mask;
+            }
+
+            return bucket;
+        }
+
+        void GrowBuckets(StringPoolData &pool)
+        {
+            u32 newBucketCount = pool.bucketCount * 2;
+            u32 *newBuckets = static_cast<u32 *>(std::calloc(newBucketCount, sizeof(u32)));
+            u32 mask = newBucketCount - 1;
+
+            for (u32 i = 0; i < pool.count; i++)
+            {
+                u32 bucket = GetEntry(pool, i).hash & mask;
+                while (newBuckets[bucket] != 0)
+                {
+                    bucket = (bucket + 1) & mask;
+                }
+                newBuckets[bucket] = i + 1;
+            }
+
+            std::free(pool.buckets);
+            pool.buckets = newBuckets;
+            pool.bucketCount = newBucketCount;
+        }
+
+        const char *CopyCharacters(StringPoolData &pool, StringView value)
+        {
+            u32 size = value.Length() + 1;
+            char *destination = nullptr;
+
+            if (size > STRING_POOL_BLOCK_SIZE / 4)
+            {
+                // long strings get their own allocation to keep the blocks dense
+                destination = static_cast<char *>(std::malloc(size));
+            }
+            else
+            {
+                if (pool.block == nullptr || pool.blockUsed + size > pool.blockSize)
+                {
+                    pool.block = static_cast<char *>(std::malloc(STRING_POOL_BLOCK_SIZE));
+                    pool.blockUsed = 0;
+                    pool.blockSize = STRING_POOL_BLOCK_SIZE;
+                }
+
+                destination = pool.block + pool.blockUsed;
+                pool.blockUsed += size;
+            }
+
+            memcpy(destination, value.Data(), value.Length());
+            destination[value.Length()] = '\0';
+            return destination;
+        }
+    } // namespace
+
+    StringId StringPool::Intern(StringView value)
+    {
+        StringPoolData &pool = GetPoolData();
+        u32 hash = HashString(value);
+
+        {
+            std::shared_lock<std::shared_mutex> lock(pool.mutex);
+            u32 bucket = FindBucket(pool, value, hash);
+            if (pool.buckets[bucket] != 0)
+            {
+                return StringId{hash, pool.buckets[bucket] - 1};
+            }
+        }
+
+        std::unique_lock<std::shared_mutex> lock(pool.mutex);
+
+        // another thread may have added the same string between the two locks
+        u32 bucket = FindBucket(pool, value, hash);
+        if (pool.buckets[bucket] != 0)
+        {
+            return StringId{hash, pool.buckets[bucket] - 1};
+        }
+
+        u32 index = pool.count;
+        u32 pageIndex = index / STRING_POOL_PAGE_SIZE;
+        if (pageIndex >= STRING_POOL_MAX_PAGES)
+        {
+            return INVALID_STRING_ID;
+        }
+
+        if (index % STRING_POOL_PAGE_SIZE == 0)
+        {
+            pool.pages[pageIndex] = static_cast<InternEntry *>(std::malloc(sizeof(InternEntry) * STRING_POOL_PAGE_SIZE));
+        }
+
+        InternEntry &entry = GetEntry(pool, index);
+        entry.data = CopyCharacters(pool, value);
+        entry.length = value.Length();
+        entry.hash = hash;
+
+        pool.buckets[bucket] = index + 1;
+        pool.count++;
+
+        // keep the load factor under 3/4 so that probing stays short
+        if (pool.count * 4 >= pool.bucketCount * 3)
+        {
+            GrowBuckets(pool);
+        }
+
+        return StringId{hash, index};
+    }
+
+    StringId StringPool::Find(StringView value)
+    {
+        StringPoolData &pool = GetPoolData();
+        u32 hash = HashString(value);
+
+        std::shared_lock<std::shared_mutex> lock(pool.mutex);
+        u32 bucket = FindBucket(pool, value, hash);
+        if (pool.buckets[bucket] == 0)
+        {
+            return INVALID_STRING_ID;
+        }
+
+        return StringId{hash, pool.buckets[bucket] - 1};
+    }
+
+    StringView StringPool::Resolve(StringId id)
+    {
+        if (!id.IsValid())
+        {
+            return StringView();
+        }
+
+        const InternEntry &entry = GetEntry(GetPoolData(), id.index);
+        return StringView(entry.data, entry.length);
+    }
+
+    u32 StringPool::Count()
+    {
+        StringPoolData &pool = GetPoolData();
+        std::shared_lock<std::shared_mutex> lock(pool.mutex);
+        return pool.count;
+    }
+} // namespace rpp
@@ -0,0 +1,123 @@
+#include "core/string_view.h"
+#include "core/simd.h"
+#include <cstring>
+#include <stdexcept>
+
+namespace rpp
+{
+    StringView::StringView()
+        : m_data(""), m_length(0)
+    {
+    }
+
+    StringView::StringView(const char *str)
+        : m_data(str != nullptr ? str : ""), m_length(str != nullptr ? static_cast<u32>(std::strlen(str)) : 0)
+    {
+    }
+
+    StringView::StringView(const char *str, u32 length)
+        : m_data(str != nullptr ? str : ""), m_length(str != nullptr ? length : 0)
+    {
+    }
+
+    char StringView::operator[](u32 index) const
+    {
+        if (index >= m_length)
+        {
+            throw std::out_of_range("Index out of range");
+        }
+        return m_data[index];
+    }
+
+    b8 StringView::operator==(StringView other) const
+    {
+        return m_length == other.m_length && memcmp(m_data, other.m_data, m_length) == 0;
+    }
+
+    i32 StringView::Find(StringView substr, u32 startIndex) const
+    {
+        if (startIndex >= m_length)
+        {
+            return -1;
+        }
+
+        i32 found = Simd::Find(m_data + startIndex, m_length - startIndex, substr.m_data, substr.m_length);
+        return found != -1 ? static_cast<i32>(startIndex) + found : -1;
+    }
+
+    i32 StringView::Find(char character, u32 startIndex) const
+    {
+        if (startIndex >= m_length)
+        {
+            return -1;
+        }
+
+        const char *found = Simd::FindChar(m_data + startIndex, m_length - startIndex, character);
+        return found != nullptr ? static_cast<i32>(found - m_data) : -1;
+    }
+
+    StringView StringView::SubView(u32 startIndex, i32 length) const
+    {
+        if (startIndex >= m_length)
+        {
+            return StringView();
+        }
+
+        u32 finalLength = 0;
+
+        if (length == -1 || u32(length) + startIndex > m_length)
+        {
+            finalLength = m_length - startIndex;
+        }
+        else
+        {
+            finalLength = static_cast<u32>(length);
+        }
+
+        return StringView(m_data + startIndex, finalLength);
+    }
+
+    b8 StringView::StartsWith(StringView prefix) const
+    {
+        if (prefix.m_length > m_length)
+        {
+            return FALSE;
+        }
+
+        return memcmp(m_data, prefix.m_data, prefix.m_length) == 0;
+    }
+
+    b8 StringView::EndsWith(StringView suffix) const
+    {
+        if (suffix.m_length > m_length)
+        {
+            return FALSE;
+        }
+
+        return memcmp(m_data + m_length - suffix.m_length, suffix.m_data, suffix.m_length) == 0;
+    }
+
+    void StringView::Split(Array<StringView> &outParts, StringView delimiter) const
+    {
+        if (delimiter.m_length == 0)
+        {
+            outParts.Push(*this);
+            return;
+        }
+
+        u32 start = 0;
+
+        while (TRUE)
+        {
+            i32 delimIndex = delimiter.m_length == 1 ? Find(delimiter.m_data[0], start) : Find(delimiter, start);
+            if (delimIndex == -1)
+            {
+                outParts.Push(StringView(m_data + start, m_length - start));
+                break;
+            }
+
+            outParts.Push(StringView(m_data + start, delimIndex - start));
+            start = delimIndex + delimiter.m_length;
+        }
+    }
+} // namespace rpp
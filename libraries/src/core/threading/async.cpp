@@ -0,0 +1,185 @@
+#include "core/threading/async.h"
+#include "core/containers/queue.h"
+#include "core/assertions.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+/// How often `Async::WaitIdle` checks the state again: `Signal::Wait` drops the notifications sent before it is called.
+#define ASYNC_IDLE_POLL_INTERVAL 10
+
+namespace rpp
+{
+    namespace
+    {
+        struct AsyncJob
+        {
+            AsyncWork work;
+            AsyncCompletion completion;
+        };
+
+        /**
+         * The state shared by the main thread and the worker thread, every member is protected by `mutex`.
+         */
+        struct AsyncData
+        {
+            std::mutex mutex;
+            std::condition_variable jobAdded; ///< Wakes the worker up when a job is queued or on shutdown.
+
+            Queue<AsyncJob> jobs;               ///< The jobs waiting for the worker.
+            Queue<AsyncCompletion> completions; ///< The completions of the finished jobs, for the main thread.
+            u32 unfinishedCount;                ///< The jobs queued or running.
+            b8 isStopping;
+
+            ThreadId workerId;
+            SignalId doneSignal; ///< Notified by the worker every time a job is done.
+        };
+
+        Scope<AsyncData> s_pAsyncData = nullptr;
+    } // namespace
+
+    void Async::Initialize()
+    {
+        RPP_ASSERT(s_pAsyncData == nullptr);
+
+        s_pAsyncData = CreateScope<AsyncData>();
+        s_pAsyncData->unfinishedCount = 0;
+        s_pAsyncData->isStopping = FALSE;
+        s_pAsyncData->doneSignal = Signal::Create();
+        s_pAsyncData->workerId = Thread::Create(workerEntry);
+
+        Thread::Start(s_pAsyncData->workerId);
+    }
+
+    void Async::Shutdown()
+    {
+        RPP_ASSERT(s_pAsyncData != nullptr);
+
+        {
+            std::lock_guard<std::mutex> lock(s_pAsyncData->mutex);
+            s_pAsyncData->isStopping = TRUE;
+        }
+        s_pAsyncData->jobAdded.notify_one();
+
+        // the worker finishes the queued jobs before leaving
+        Thread::Join(s_pAsyncData->workerId);
+        Thread::Destroy(s_pAsyncData->workerId);
+        Signal::Destroy(s_pAsyncData->doneSignal);
+
+        s_pAsyncData.reset();
+    }
+
+    void Async::Run(AsyncWork work, AsyncCompletion completion)
+    {
+        RPP_ASSERT(s_pAsyncData != nullptr);
+        RPP_ASSERT(work != nullptr);
+
+        {
+            std::lock_guard<std::mutex> lock(s_pAsyncData->mutex);
+            RPP_ASSERT(!s_pAsyncData->isStopping);
+
+            s_pAsyncData->jobs.Push(AsyncJob{std::move(work), std::move(completion)});
+            s_pAsyncData->unfinishedCount++;
+        }
+        s_pAsyncData->jobAdded.notify_one();
+    }
+
+    u32 Async::ProcessCompletions()
+    {
+        if (s_pAsyncData == nullptr)
+        {
+            return 0;
+        }
+
+        // taken out of the queue first: a completion may queue other jobs
+        Queue<AsyncCompletion> completions;
+        {
+            std::lock_guard<std::mutex> lock(s_pAsyncData->mutex);
+            while (!s_pAsyncData->completions.Empty())
+            {
+                completions.Push(std::move(s_pAsyncData->completions.Front()));
+                s_pAsyncData->completions.Pop();
+            }
+        }
+
+        u32 processedCount = completions.Size();
+        while (!completions.Empty())
+        {
+            if (completions.Front() != nullptr)
+            {
+                completions.Front()();
+            }
+            completions.Pop();
+        }
+
+        return processedCount;
+    }
+
+    b8 Async::WaitIdle(u32 timeout)
+    {
+        RPP_ASSERT(s_pAsyncData != nullptr);
+
+        auto start = std::chrono::steady_clock::now();
+        while (TRUE)
+        {
+            {
+                std::lock_guard<std::mutex> lock(s_pAsyncData->mutex);
+                if (s_pAsyncData->unfinishedCount == 0)
+                {
+                    return TRUE;
+                }
+            }
+
+            u32 elapsed = static_cast<u32>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                               std::chrono::steady_clock::now() - start)
+                                               .count());
+            if (timeout != INFINITE_WAIT && elapsed >= timeout)
+            {
+                return FALSE;
+            }
+
+            Signal::Wait(s_pAsyncData->doneSignal, ASYNC_IDLE_POLL_INTERVAL);
+        }
+    }
+
+    u32 Async::GetPendingCount()
+    {
+        RPP_ASSERT(s_pAsyncData != nullptr);
+
+        std::lock_guard<std::mutex> lock(s_pAsyncData->mutex);
+        return s_pAsyncData->unfinishedCount + s_pAsyncData->completions.Size();
+    }
+
+    void Async::workerEntry(void *pParam)
+    {
+        RPP_UNUSED(pParam);
+        AsyncData *pData = s_pAsyncData.get();
+
+        while (TRUE)
+        {
+            AsyncJob job;
+            {
+                std::unique_lock<std::mutex> lock(pData->mutex);
+                pData->jobAdded.wait(lock, [pData]()
+                                     { return !pData->jobs.Empty() || pData->isStopping; });
+
+                if (pData->jobs.Empty())
+                {
+                    return; // stopping, and nothing left to do
+                }
+
+                job = std::move(pData->jobs.Front());
+                pData->jobs.Pop();
+            }
+
+            job.work();
+
+            {
+                std::lock_guard<std::mutex> lock(pData->mutex);
+                pData->completions.Push(std::move(job.completion));
+                pData->unfinishedCount--;
+            }
+            Signal::Notify(pData->doneSignal);
+        }
+    }
+} // namespace rpp
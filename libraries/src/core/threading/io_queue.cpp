@@ -0,0 +1,411 @@
+#include "core/threading/io_queue.h"
+#include "core/containers/queue.h"
+#include "core/filesystem.h"
+#include "core/assertions.h"
+#include <chrono>
+#include <condition_variable>
+#include <mutex>
+
+/// How often `IOQueue::WaitIdle` checks the state again: `Signal::Wait` drops the notifications sent before it is called.
+#define IO_QUEUE_IDLE_POLL_INTERVAL 10
+
+namespace rpp
+{
+    namespace
+    {
+        /**
+         * The reads queued together by one `ReadAsync` call. The workers fill different results, the callback is queued
+         * by the worker which finishes the last read.
+         */
+        struct IOBatch
+        {
+            Array<FileReadResult> results;
+            u32 remainingCount; ///< The reads not finished yet, protected by `IOQueueData::mutex`.
+            FileBatchReadCallback callback;
+        };
+
+        /**
+         * One file operation, a read of a batch or a write.
+         */
+        struct IOOperation
+        {
+            String filePath;
+            b8 isWrite;
+
+            Ref<IOBatch> pBatch; ///< The batch of a read.
+            u32 resultIndex;     ///< The index of the result of a read in its batch.
+
+            Array<u8> bytes; ///< The content of a write.
+            FileWriteCallback writeCallback;
+        };
+
+        /**
+         * A path claimed by a running operation (or one handed to `IOQueueData::readyOperations`). The later operations
+         * on it wait here, in submission order, until it is released.
+         */
+        struct IOBusyPath
+        {
+            String filePath;
+            Queue<IOOperation> waitingOperations;
+        };
+
+        /**
+         * The state shared by the main thread and the worker threads, every member is protected by `mutex`.
+         */
+        struct IOQueueData
+        {
+            std::mutex mutex;
+            std::condition_variable operationAdded; ///< Wakes the workers up when an operation can run or on shutdown.
+
+            Queue<IOOperation> operations;      ///< The operations waiting for a worker, in submission order.
+            Queue<IOOperation> readyOperations; ///< The operations whose path was handed over by the previous one.
+            Array<Scope<IOBusyPath>> busyPaths; ///< The paths of the running and ready operations.
+            Queue<std::function<void()>> completions; ///< The callbacks of the finished requests, for the main thread.
+            u32 unfinishedCount;                      ///< The requests queued or running (a batch counts once).
+            b8 isStopping;
+
+            Array<ThreadId> workerIds;
+            SignalId doneSignal; ///< Notified by the workers every time a request is done.
+        };
+
+        Scope<IOQueueData> s_pIOQueueData = nullptr;
+
+        i32 FindBusyPath(const IOQueueData &data, const String &filePath)
+        {
+            for (u32 i = 0; i < data.busyPaths.Size(); i++)
+            {
+                if (data.busyPaths.Data()[i]->filePath == filePath)
+                {
+                    return static_cast<i32>(i);
+                }
+            }
+            return -1;
+        }
+
+        /**
+         * @brief Takes the next operation which can run now. An operation whose path is busy is moved behind the
+         *      running one on that path, which keeps the operations on the same path in submission order.
+         *
+         * @return FALSE if no operation can run now.
+         */
+        b8 TakeRunnableOperation(IOQueueData &data, IOOperation &outOperation)
+        {
+            if (!data.readyOperations.Empty())
+            {
+                outOperation = std::move(data.readyOperations.Front());
+                data.readyOperations.Pop();
+                return TRUE; // its path is still claimed
+            }
+
+            while (!data.operations.Empty())
+            {
+                IOOperation &operation = data.operations.Front();
+                i32 busyIndex = FindBusyPath(data, operation.filePath);
+                if (busyIndex >= 0)
+                {
+                    data.busyPaths[busyIndex]->waitingOperations.Push(std::move(operation));
+                    data.operations.Pop();
+                    continue;
+                }
+
+                Scope<IOBusyPath> pBusyPath = CreateScope<IOBusyPath>();
+                pBusyPath->filePath = operation.filePath;
+                data.busyPaths.Push(std::move(pBusyPath));
+
+                outOperation = std::move(operation);
+                data.operations.Pop();
+                return TRUE;
+            }
+            return FALSE;
+        }
+
+        /**
+         * @brief Hands the path over to the next operation waiting on it, or releases it if there is none.
+         */
+        void ReleasePath(IOQueueData &data, const String &filePath)
+        {
+            i32 busyIndex = FindBusyPath(data, filePath);
+            RPP_ASSERT(busyIndex >= 0);
+
+            IOBusyPath *pBusyPath = data.busyPaths[busyIndex].get();
+            if (!pBusyPath->waitingOperations.Empty())
+            {
+                data.readyOperations.Push(std::move(pBusyPath->waitingOperations.Front()));
+                pBusyPath->waitingOperations.Pop();
+                return;
+            }
+            data.busyPaths.Erase(busyIndex);
+        }
+
+        b8 WriteFileReplacing(const String &filePath, const Array<u8> &bytes)
+        {
+            String tempFilePath = Format("{}.tmp", filePath);
+            if (!FileSystem::WriteAll(tempFilePath, bytes.Data(), bytes.Size()))
+            {
+                FileSystem::DeleteFile(tempFilePath);
+                return FALSE;
+            }
+            return FileSystem::RenameFile(tempFilePath, filePath);
+        }
+    } // namespace
+
+    void IOQueue::Initialize(u32 workerCount)
+    {
+        RPP_ASSERT(s_pIOQueueData == nullptr);
+        RPP_ASSERT(workerCount > 0);
+
+        s_pIOQueueData = CreateScope<IOQueueData>();
+        s_pIOQueueData->unfinishedCount = 0;
+        s_pIOQueueData->isStopping = FALSE;
+        s_pIOQueueData->doneSignal = Signal::Create();
+
+        for (u32 i = 0; i < workerCount; i++)
+        {
+            ThreadId workerId = Thread::Create(workerEntry);
+            s_pIOQueueData->workerIds.Push(workerId);
+            Thread::Start(workerId);
+        }
+    }
+
+    void IOQueue::Shutdown()
+    {
+        RPP_ASSERT(s_pIOQueueData != nullptr);
+
+        {
+            std::lock_guard<std::mutex> lock(s_pIOQueueData->mutex);
+            s_pIOQueueData->isStopping = TRUE;
+        }
+        s_pIOQueueData->operationAdded.notify_all();
+
+        // the workers finish the queued operations before leaving
+        for (u32 i = 0; i < s_pIOQueueData->workerIds.Size(); i++)
+        {
+            Thread::Join(s_pIOQueueData->workerIds[i]);
+            Thread::Destroy(s_pIOQueueData->workerIds[i]);
+        }
+        Signal::Destroy(s_pIOQueueData->doneSignal);
+
+        s_pIOQueueData.reset();
+    }
+
+    void IOQueue::ReadAsync(const String &filePath, FileReadCallback callback)
+    {
+        Array<String> filePaths;
+        filePaths.Push(filePath);
+
+        ReadAsync(filePaths, [callback](Array<FileReadResult> &results)
+                  {
+                      if (callback != nullptr)
+                      {
+                          callback(results[0]);
+                      } });
+    }
+
+    void IOQueue::ReadAsync(const Array<String> &filePaths, FileBatchReadCallback callback)
+    {
+        RPP_ASSERT(s_pIOQueueData != nullptr);
+
+        Ref<IOBatch> pBatch = CreateRef<IOBatch>();
+        pBatch->results.Resize(filePaths.Size());
+        pBatch->remainingCount = filePaths.Size();
+        pBatch->callback = std::move(callback);
+
+        {
+            std::lock_guard<std::mutex> lock(s_pIOQueueData->mutex);
+            RPP_ASSERT(!s_pIOQueueData->isStopping);
+
+            if (filePaths.Size() == 0)
+            {
+                // nothing to read, the callback is still executed by `ProcessCompletions`
+                s_pIOQueueData->completions.Push([pBatch]()
+                                                 {
+                                                     if (pBatch->callback != nullptr)
+                                                     {
+                                                         pBatch->callback(pBatch->results);
+                                                     } });
+                return;
+            }
+
+            s_pIOQueueData->unfinishedCount++;
+
+            for (u32 i = 0; i < filePaths.Size(); i++)
+            {
+                pBatch->results[i].filePath = filePaths[i];
+                pBatch->results[i].success = FALSE;
+
+                IOOperation operation = {};
+                operation.filePath = filePaths[i];
+                operation.isWrite = FALSE;
+                operation.pBatch = pBatch;
+                operation.resultIndex = i;
+                s_pIOQueueData->operations.Push(std::move(operation));
+            }
+        }
+        s_pIOQueueData->operationAdded.notify_all();
+    }
+
+    void IOQueue::WriteAsync(const String &filePath, Array<u8> bytes, FileWriteCallback callback)
+    {
+        RPP_ASSERT(s_pIOQueueData != nullptr);
+
+        IOOperation operation = {};
+        operation.filePath = filePath;
+        operation.isWrite = TRUE;
+        operation.resultIndex = 0;
+        operation.bytes = std::move(bytes);
+        operation.writeCallback = std::move(callback);
+
+        {
+            std::lock_guard<std::mutex> lock(s_pIOQueueData->mutex);
+            RPP_ASSERT(!s_pIOQueueData->isStopping);
+
+            s_pIOQueueData->operations.Push(std::move(operation));
+            s_pIOQueueData->unfinishedCount++;
+        }
+        s_pIOQueueData->operationAdded.notify_one();
+    }
+
+    u32 IOQueue::ProcessCompletions()
+    {
+        if (s_pIOQueueData == nullptr)
+        {
+            return 0;
+        }
+
+        // taken out of the queue first: a callback may queue other requests
+        Queue<std::function<void()>> completions;
+        {
+            std::lock_guard<std::mutex> lock(s_pIOQueueData->mutex);
+            while (!s_pIOQueueData->completions.Empty())
+            {
+                completions.Push(std::move(s_pIOQueueData->completions.Front()));
+                s_pIOQueueData->completions.Pop();
+            }
+        }
+
+        u32 processedCount = completions.Size();
+        while (!completions.Empty())
+        {
+            completions.Front()();
+            completions.Pop();
+        }
+
+        return processedCount;
+    }
+
+    b8 IOQueue::WaitIdle(u32 timeout)
+    {
+        RPP_ASSERT(s_pIOQueueData != nullptr);
+
+        auto start = std::chrono::steady_clock::now();
+        while (TRUE)
+        {
+            {
+                std::lock_guard<std::mutex> lock(s_pIOQueueData->mutex);
+                if (s_pIOQueueData->unfinishedCount == 0)
+                {
+                    return TRUE;
+                }
+            }
+
+            u32 elapsed = static_cast<u32>(std::chrono::duration_cast<std::chrono::milliseconds>(
+                                               std::chrono::steady_clock::now() - start)
+                                               .count());
+            if (timeout != INFINITE_WAIT && elapsed >= timeout)
+            {
+                return FALSE;
+            }
+
+            Signal::Wait(s_pIOQueueData->doneSignal, IO_QUEUE_IDLE_POLL_INTERVAL);
+        }
+    }
+
+    u32 IOQueue::GetPendingCount()
+    {
+        RPP_ASSERT(s_pIOQueueData != nullptr);
+
+        std::lock_guard<std::mutex> lock(s_pIOQueueData->mutex);
+        return s_pIOQueueData->unfinishedCount + s_pIOQueueData->completions.Size();
+    }
+
+    void IOQueue::workerEntry(void *pParam)
+    {
+        RPP_UNUSED(pParam);
+        IOQueueData *pData = s_pIOQueueData.get();
+
+        while (TRUE)
+        {
+            IOOperation operation;
+            {
+                std::unique_lock<std::mutex> lock(pData->mutex);
+
+                b8 hasOperation = FALSE;
+                pData->operationAdded.wait(lock, [pData, &operation, &hasOperation]()
+                                           {
+                                               hasOperation = TakeRunnableOperation(*pData, operation);
+                                               return hasOperation || (pData->isStopping && pData->operations.Empty()); });
+
+                if (!hasOperation)
+                {
+                    return; // stopping, and nothing left to do (the waiting operations are handed over by their path)
+                }
+            }
+
+            b8 success = FALSE;
+            if (operation.isWrite)
+            {
+                success = WriteFileReplacing(operation.filePath, operation.bytes);
+            }
+            else
+            {
+                // every worker fills its own result, the array of the batch is not resized anymore
+                FileReadResult &result = operation.pBatch->results[operation.resultIndex];
+                success = FileSystem::ReadAll(operation.filePath, result.bytes);
+                result.success = success;
+            }
+
+            b8 isRequestDone = TRUE;
+            {
+                std::lock_guard<std::mutex> lock(pData->mutex);
+                ReleasePath(*pData, operation.filePath);
+
+                if (operation.isWrite)
+                {
+                    FileWriteCallback callback = std::move(operation.writeCallback);
+                    pData->completions.Push([callback, success]()
+                                            {
+                                                if (callback != nullptr)
+                                                {
+                                                    callback(success);
+                                                } });
+                }
+                else
+                {
+                    Ref<IOBatch> pBatch = operation.pBatch;
+                    isRequestDone = --pBatch->remainingCount == 0;
+                    if (isRequestDone)
+                    {
+                        pData->completions.Push([pBatch]()
+                                                {
+                                                    if (pBatch->callback != nullptr)
+                                                    {
+                                                        pBatch->callback(pBatch->results);
+                                                    } });
+                    }
+                }
+
+                if (isRequestDone)
+                {
+                    pData->unfinishedCount--;
+                }
+            }
+
+            // the released path may let another worker run the next operation on it
+            pData->operationAdded.notify_all();
+            if (isRequestDone)
+            {
+                Signal::Notify(pData->doneSignal);
+            }
+        }
+    }
+} // namespace rpp
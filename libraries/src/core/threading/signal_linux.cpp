@@ -4,6 +4,7 @@
 #if defined(RPP_PLATFORM_LINUX)
 #include <pthread.h>
 #include <unistd.h>
+#include <cerrno>
 #include <limits>
 
 namespace rpp
@@ -84,20 +85,24 @@ namespace rpp
 
         b8 gotSignal = false;
 
+        // the deadline is computed once, so spurious wake-ups do not extend the wait
+        struct timespec ts;
+        clock_gettime(CLOCK_REALTIME, &ts);
+        ts.tv_sec += timeout / 1000;
+        ts.tv_nsec += (timeout % 1000) * 1000000;
+        if (ts.tv_nsec >= 1000000000)
+        {
+            ts.tv_sec += 1;
+            ts.tv_nsec -= 1000000000;
+        }
+
         pthread_mutex_lock(&pImplData->mtx);
         while (!pImplData->isSignaled)
         {
-            if (timeout == 0)
+            if (pthread_cond_timedwait(&pImplData->handle, &pImplData->mtx, &ts) == ETIMEDOUT)
             {
                 break;
             }
-
-            struct timespec ts;
-            clock_gettime(CLOCK_REALTIME, &ts);
-            ts.tv_sec += timeout / 1000;
-            ts.tv_nsec += (timeout % 1000) * 1000000;
-
-            pthread_cond_timedwait(&pImplData->handle, &pImplData->mtx, &ts);
         }
         gotSignal = pImplData->isSignaled;
         pthread_mutex_unlock(&pImplData->mtx);
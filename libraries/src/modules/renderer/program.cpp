@@ -113,9 +113,23 @@ namespace rpp
         s_currentProgramId = programId;
     }
 
+    i32 *Program::getUniformLocation(ProgramData *data, StringId name)
+    {
+        for (u32 uniformIndex = 0; uniformIndex < data->uniforms.Size(); ++uniformIndex)
+        {
+            if (data->uniforms[uniformIndex].name == name)
+            {
+                return &data->uniforms[uniformIndex].location;
+            }
+        }
+
+        data->uniforms.Push(UniformLocation{name, UNIFORM_LOCATION_UNKNOWN});
+        return &data->uniforms[data->uniforms.Size() - 1].location;
+    }
+
 #define DEFINE_SET_UNIFORM(valueType, uniformType)                                      \
     template <>                                                                         \
-    void Program::SetUniform<valueType>(const String &name, valueType value)            \
+    void Program::SetUniform<valueType>(StringId name, valueType value)                 \
     {                                                                                   \
         RPP_PROFILE_SCOPE();                                                            \
         RPP_ASSERT(s_programs != nullptr);                                              \
@@ -125,7 +139,8 @@ namespace rpp
                                                                                         \
         SetUniformCommandData command = {};                                             \
         UniformDescription uniform = {};                                                \
-        uniform.name = name.CStr();                                                     \
+        uniform.name = StringPool::Resolve(name).Data();                                \
+        uniform.pLocation = getUniformLocation(data, name);                             \
         uniform.type = uniformType;                                                     \
         uniform.pData = &value;                                                         \
                                                                                         \
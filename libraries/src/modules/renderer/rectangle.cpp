@@ -152,8 +152,11 @@ namespace rpp
 		Mat4x4 uScale = glm::scale(Mat4x4(1.0f),
 								   glm::vec3(widthScale, heightScale, 1.0f));
 
-		Program::SetUniform("uTranslate", uTranslate);
-		Program::SetUniform("uScale", uScale);
+		static const StringId s_translateName = StringPool::Intern("uTranslate");
+		static const StringId s_scaleName = StringPool::Intern("uScale");
+
+		Program::SetUniform(s_translateName, uTranslate);
+		Program::SetUniform(s_scaleName, uScale);
 
 		RPP_ASSERT(data->rendererId == Renderer::GetCurrentRendererId());
 
@@ -104,7 +104,7 @@ namespace rpp
         s_textureStorage->Free(textureId);
     }
 
-    void Texture::Activate(u32 textureId, const String &name, u32 slot)
+    void Texture::Activate(u32 textureId, StringView name, u32 slot)
     {
         RPP_PROFILE_SCOPE();
         RPP_ASSERT(s_textureStorage != nullptr);
@@ -26,6 +26,22 @@ namespace rpp
         RPP_PROFILE_SCOPE();
     }
 
+    b8 EditorDataDescription::Migrate(u32 fromVersion, Json &document)
+    {
+        switch (fromVersion)
+        {
+        case 0:
+            // unversioned files were read with defaults for the missing keys, an empty list is kept as it was
+            if (!document.Ref().Contains("recentProjects"))
+            {
+                document.Set<Json>("recentProjects", Json("[]"));
+            }
+            return TRUE;
+        default:
+            return FALSE;
+        }
+    }
+
     EditorDataDescription EditorData::ToDescription() const
     {
         RPP_PROFILE_SCOPE();
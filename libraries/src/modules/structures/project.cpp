@@ -5,20 +5,23 @@ namespace rpp
 {
     STRUCTURE_SAVE_LOAD_IMPLEMENT(Project);
 
+    // a project which has never been saved is dirty as a whole
+    static const u32 s_allSectionsDirty = (1u << u32(ProjectSection::COUNT)) - 1;
+
     Project::Project()
-        : m_name("UnnamedProject")
+        : m_name("UnnamedProject"), m_dirtySections(s_allSectionsDirty)
     {
         RPP_PROFILE_SCOPE();
     }
 
     Project::Project(const ProjectDescription &desc)
-        : m_name(desc.name), m_functionNames(desc.functionNames)
+        : m_name(desc.name), m_functionNames(desc.functionNames), m_dirtySections(s_allSectionsDirty)
     {
         RPP_PROFILE_SCOPE();
     }
 
     Project::Project(const Project &other)
-        : m_name(other.m_name), m_functionNames(other.m_functionNames)
+        : m_name(other.m_name), m_functionNames(other.m_functionNames), m_dirtySections(s_allSectionsDirty)
     {
         RPP_PROFILE_SCOPE();
     }
@@ -28,6 +31,22 @@ namespace rpp
         RPP_PROFILE_SCOPE();
     }
 
+    b8 ProjectDescription::Migrate(u32 fromVersion, Json &document)
+    {
+        switch (fromVersion)
+        {
+        case 0:
+            // unversioned files were read with defaults for the missing keys, an empty list is kept as it was
+            if (!document.Ref().Contains("functionNames"))
+            {
+                document.Set<Json>("functionNames", Json("[]"));
+            }
+            return TRUE;
+        default:
+            return FALSE;
+        }
+    }
+
     ProjectDescription Project::ToDescription() const
     {
         RPP_PROFILE_SCOPE();
@@ -65,5 +84,98 @@ namespace rpp
         }
 
         m_functionNames.Push(uniqueName);
+        MarkDirty(ProjectSection::FUNCTIONS);
+    }
+
+    void Project::MarkDirty(ProjectSection section)
+    {
+        RPP_ASSERT(section < ProjectSection::COUNT);
+        m_dirtySections |= 1u << u32(section);
+    }
+
+    void Project::MarkClean(const String &filePath)
+    {
+        RPP_PROFILE_SCOPE();
+        m_dirtySections = 0;
+        m_cleanFilePath = filePath;
+
+        // the sections were not encoded by this object yet
+        for (u32 sectionIndex = 0; sectionIndex < u32(ProjectSection::COUNT); sectionIndex++)
+        {
+            m_encodedSections[sectionIndex] = String();
+        }
+    }
+
+    b8 Project::SaveChanges(const String &filePath)
+    {
+        RPP_PROFILE_SCOPE();
+        if (!IsDirty() && filePath == m_cleanFilePath && FileSystem::PathExists(filePath))
+        {
+            return FALSE;
+        }
+
+        // the version comes first, as in the generated `WriteJson`
+        StringBuilder document;
+        document.Append("{\n    \"" RPP_JSON_VERSION_KEY "\": ");
+        document.Append(Format("{}", GetJsonSchema<ProjectDescription>().version));
+        for (u32 sectionIndex = 0; sectionIndex < u32(ProjectSection::COUNT); sectionIndex++)
+        {
+            if ((m_dirtySections & (1u << sectionIndex)) != 0 || m_encodedSections[sectionIndex].Length() == 0)
+            {
+                encodeSection(ProjectSection(sectionIndex));
+            }
+
+            document.Append(",\n");
+            document.Append(m_encodedSections[sectionIndex]);
+        }
+        document.Append("\n}");
+
+        String tempFilePath = Format("{}.tmp", filePath);
+        FileHandle file = FileSystem::OpenFile(tempFilePath, FILE_MODE_WRITE);
+        if (!FileSystem::IsFileOpen(file))
+        {
+            FileSystem::CloseFile(file);
+            RPP_LOG_ERROR("Cannot write the project file {}", tempFilePath);
+            return FALSE;
+        }
+        FileSystem::Write(file, document.Build());
+        FileSystem::CloseFile(file);
+
+        if (!FileSystem::RenameFile(tempFilePath, filePath))
+        {
+            RPP_LOG_ERROR("Cannot replace the project file {}", filePath);
+            return FALSE;
+        }
+
+        m_dirtySections = 0;
+        m_cleanFilePath = filePath;
+        return TRUE;
+    }
+
+    void Project::encodeSection(ProjectSection section)
+    {
+        RPP_PROFILE_SCOPE();
+
+        // encoded inside an object so the indentation is the same as the one of the whole document
+        JsonWriter writer(JsonFormat::PRETTY);
+        writer.BeginObject();
+        switch (section)
+        {
+        case ProjectSection::NAME:
+            writer.Key("name");
+            writer.Value(m_name);
+            break;
+        case ProjectSection::FUNCTIONS:
+            writer.Key("functionNames");
+            writer.ValueArray(m_functionNames);
+            break;
+        default:
+            RPP_UNREACHABLE();
+        }
+        writer.EndObject();
+
+        // strip the braces: "{\n" + member + "\n}"
+        String encoded = writer.Build();
+        m_encodedSections[u32(section)] = encoded.SubString(2, encoded.Length() - 4);
     }
 }
\ No newline at end of file
@@ -154,13 +154,8 @@ namespace rpp
         Signal::Notify(m_mainThreadSignal);
         Signal::Wait(m_testThreadSignal);
 
-        FileHandle fileHandle = FileSystem::OpenPhysicalFile(m_resultFilePath, FILE_MODE_READ);
-        String resultContent = FileSystem::Read(fileHandle);
-        FileSystem::CloseFile(fileHandle);
-
-        Json resultsJson(resultContent);
-        Json resultJson;
-        resultJson.Set("name", m_runTestCaseName);
+        b8 resultStatus = FALSE;
+        String resultError;
 
         try
         {
@@ -202,8 +197,8 @@ namespace rpp
                 RPP_LOG_ERROR("Python error occurred during test execution: {}", errorMessage);
 
                 // Save failure results
-                resultJson.Set("status", false);
-                resultJson.Set("error", String(errorMessage));
+                resultStatus = FALSE;
+                resultError = errorMessage;
 
                 Py_XDECREF(type);
                 Py_XDECREF(value);
@@ -211,8 +206,8 @@ namespace rpp
             }
             else
             {
-                resultJson.Set("status", true);
-                resultJson.Set("error", String(""));
+                resultStatus = TRUE;
+                resultError = "";
             }
         }
         catch (const std::exception &e)
@@ -222,20 +217,37 @@ namespace rpp
 
             // Save failure results
             {
-                resultJson.Set("status", false);
-                resultJson.Set("error", String(e.what()));
+                resultStatus = FALSE;
+                resultError = String(e.what());
             }
         }
 
         if (m_error != "")
         {
-            resultJson.Set("status", false);
-            resultJson.Set("error", m_error);
+            resultStatus = FALSE;
+            resultError = m_error;
         }
 
-        resultsJson.Append(resultJson);
-        fileHandle = FileSystem::OpenPhysicalFile(m_resultFilePath, FILE_MODE_WRITE);
-        FileSystem::Write(fileHandle, resultsJson.ToString());
+        // one JSON Lines record per test case, the previous results are never read back
+        FileHandle fileHandle = FileSystem::OpenPhysicalFile(m_resultFilePath, FILE_MODE_APPEND);
+        if (FileSystem::IsFileOpen(fileHandle))
+        {
+            JsonLinesWriter resultsWriter(fileHandle);
+            JsonWriter &record = resultsWriter.BeginRecord();
+            record.BeginObject();
+            record.Key("name");
+            record.Value(m_runTestCaseName);
+            record.Key("status");
+            record.Value(resultStatus);
+            record.Key("error");
+            record.Value(resultError);
+            record.EndObject();
+            resultsWriter.EndRecord();
+        }
+        else
+        {
+            RPP_LOG_ERROR("Cannot open the result file {}", m_resultFilePath);
+        }
         FileSystem::CloseFile(fileHandle);
 
         m_shouldApplicationClose = TRUE;
@@ -176,6 +176,24 @@ namespace rpp
         };
     }
 
+    /**
+     * Looking up a location by name goes through the driver, so it is done once per program and uniform: the caller
+     * keeps the result with the program, the program ids are only unique inside the context of a window.
+     */
+    static GLint getUniformLocation(u32 programId, const UniformDescription &uniform)
+    {
+        if (uniform.pLocation == nullptr)
+        {
+            return glGetUniformLocation(programId, uniform.name);
+        }
+
+        if (*uniform.pLocation == UNIFORM_LOCATION_UNKNOWN)
+        {
+            *uniform.pLocation = glGetUniformLocation(programId, uniform.name);
+        }
+        return *uniform.pLocation;
+    }
+
     static u32 GetSizeFromUniformType(UniformType type)
     {
         switch (type)
@@ -580,7 +598,7 @@ namespace rpp
             for (u32 uniformIndex = 0; uniformIndex < uniformData->uniformCount; ++uniformIndex)
             {
                 UniformDescription uniformDescription = uniformData->pUniforms[uniformIndex];
-                GLint location = glGetUniformLocation(uniformData->programId, uniformDescription.name);
+                GLint location = getUniformLocation(uniformData->programId, uniformDescription);
 
                 switch (uniformDescription.type)
                 {
@@ -11,6 +11,8 @@
 #include <cstdio>
 #include <stdexcept>
 #include <cstring>
+#include <mutex>
+#include <new>
 
 #include "platforms/memory.h"
 
@@ -160,6 +162,16 @@ namespace rpp
 
     static MemHeaderList g_memList;
 
+    /**
+     * Protects `g_memList`, the allocations also happen on the worker threads (`Async`, tests). Intentionally never
+     * destroyed: `operator delete` may still be called from other static destructors.
+     */
+    static std::recursive_mutex &GetMemListMutex()
+    {
+        static std::recursive_mutex *s_pMutex = new (malloc(sizeof(std::recursive_mutex))) std::recursive_mutex();
+        return *s_pMutex;
+    }
+
     MemoryObject::MemoryObject()
     {
         g_memoryTrackingEnabled = TRUE;
@@ -178,6 +190,7 @@ namespace rpp
             throw std::bad_alloc();
         }
 
+        std::lock_guard<std::recursive_mutex> lock(GetMemListMutex());
         MemHeader *existing = Find(g_memList, ptr);
         if (existing == nullptr)
         {
@@ -209,17 +222,22 @@ namespace rpp
             return;
         }
 
-        free(ptr);
-
-        MemHeader *node = Find(g_memList, ptr);
-        if (node)
         {
-            Remove(g_memList, node);
+            // untracked before being freed, another thread may get the same address right after
+            std::lock_guard<std::recursive_mutex> lock(GetMemListMutex());
+            MemHeader *node = Find(g_memList, ptr);
+            if (node)
+            {
+                Remove(g_memList, node);
+            }
         }
+
+        free(ptr);
     }
 
     u64 GetMemoryAllocated()
     {
+        std::lock_guard<std::recursive_mutex> lock(GetMemListMutex());
         u64 total = 0;
         MemHeader *node = g_memList.head;
         while (node)
@@ -232,6 +250,7 @@ namespace rpp
 
     u8 GetMemoryAllocated(char *buffer, size_t bufferSize)
     {
+        std::lock_guard<std::recursive_mutex> lock(GetMemListMutex());
         std::memset(buffer, 0, bufferSize);
         MemHeader *node = g_memList.head;
         u64 total = 0;
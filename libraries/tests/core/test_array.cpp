@@ -143,4 +143,87 @@ TEST(ArrayTest, EraseElement)
     EXPECT_EQ(arr.Size(), 2);
     EXPECT_EQ(arr[0], 3);
     EXPECT_EQ(arr[1], 4);
-}
\ No newline at end of file
+}
+
+namespace
+{
+    i32 s_aliveCount = 0;
+
+    struct Counted
+    {
+        i32 value;
+
+        Counted(i32 value = 0) : value(value) { s_aliveCount++; }
+        Counted(const Counted &other) : value(other.value) { s_aliveCount++; }
+        ~Counted() { s_aliveCount--; }
+        void operator=(const Counted &other) { value = other.value; }
+    };
+} // namespace
+
+TEST(ArrayTest, ShiftedElementsAreDestroyed)
+{
+    {
+        Array<Counted> arr;
+        arr.Push(Counted(1));
+        arr.Push(Counted(2));
+        arr.Push(Counted(3));
+        arr.Push(Counted(0), 0);
+        arr.Erase(1);
+        arr.Erase(0);
+
+        EXPECT_EQ(arr.Size(), 2);
+        EXPECT_EQ(arr[0].value, 2);
+        EXPECT_EQ(arr[1].value, 3);
+        EXPECT_EQ(s_aliveCount, 2);
+    }
+    EXPECT_EQ(s_aliveCount, 0);
+}
+
+TEST(ArrayTest, Resize)
+{
+    Array<String> arr;
+    arr.Push("a");
+
+    arr.Resize(5);
+    EXPECT_EQ(arr.Size(), 5);
+    EXPECT_GE(arr.Capacity(), 5);
+    EXPECT_STREQ(arr[0].CStr(), "a");
+    EXPECT_EQ(arr[4].Length(), 0);
+
+    arr.Resize(1);
+    EXPECT_EQ(arr.Size(), 1);
+    EXPECT_STREQ(arr[0].CStr(), "a");
+
+    Array<u8> bytes;
+    bytes.Resize(3);
+    EXPECT_EQ(bytes[0] + bytes[1] + bytes[2], 0);
+}
+
+TEST(ArrayTest, MoveTakesTheBuffer)
+{
+    Array<String> source;
+    source.Push("first");
+    source.Push("second");
+    const String *data = source.Data();
+
+    Array<String> moved(std::move(source));
+    EXPECT_EQ(moved.Data(), data);
+    EXPECT_EQ(moved.Size(), 2);
+    EXPECT_EQ(source.Size(), 0);
+    EXPECT_EQ(source.Capacity(), 0);
+
+    // the moved-from array stays usable
+    source.Push("third");
+    EXPECT_STREQ(source[0].CStr(), "third");
+
+    Array<String> assigned;
+    assigned.Push("replaced");
+    assigned = std::move(moved);
+    EXPECT_EQ(assigned.Data(), data);
+    EXPECT_STREQ(assigned[1].CStr(), "second");
+
+    Array<String> copy(moved);
+    EXPECT_EQ(copy.Size(), 0);
+    copy.Push("fourth");
+    EXPECT_EQ(copy.Size(), 1);
+}
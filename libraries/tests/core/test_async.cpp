@@ -0,0 +1,88 @@
+#include "test_common.h"
+#include <atomic>
+#include <thread>
+
+class AsyncTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        Thread::Initialize();
+        Signal::Initialize();
+        Async::Initialize();
+    }
+
+    void TearDown() override
+    {
+        Async::Shutdown();
+        Signal::Shutdown();
+        Thread::Shutdown();
+    }
+};
+
+TEST_F(AsyncTest, CompletionsRunOnTheCallingThread)
+{
+    std::thread::id mainThreadId = std::this_thread::get_id();
+
+    Array<i32> order;
+    std::thread::id workThreadId;
+    std::thread::id completionThreadId;
+
+    Async::Run([&]()
+               { workThreadId = std::this_thread::get_id(); },
+               [&]()
+               {
+                   completionThreadId = std::this_thread::get_id();
+                   order.Push(1);
+               });
+    Async::Run([]() {},
+               [&]()
+               { order.Push(2); });
+
+    ASSERT_TRUE(Async::WaitIdle(5000));
+    EXPECT_EQ(order.Size(), u32(0)); // nothing runs before the main loop asks for it
+    EXPECT_EQ(Async::GetPendingCount(), u32(2));
+
+    EXPECT_EQ(Async::ProcessCompletions(), u32(2));
+    ASSERT_EQ(order.Size(), u32(2));
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 2);
+
+    EXPECT_NE(workThreadId, mainThreadId);
+    EXPECT_EQ(completionThreadId, mainThreadId);
+    EXPECT_EQ(Async::GetPendingCount(), u32(0));
+    EXPECT_EQ(Async::ProcessCompletions(), u32(0));
+}
+
+TEST_F(AsyncTest, WaitIdleTimeout)
+{
+    std::atomic<b8> release(FALSE);
+    Async::Run([&]()
+               {
+                   while (!release)
+                   {
+                       Thread::Sleep(1);
+                   } });
+
+    EXPECT_FALSE(Async::WaitIdle(20));
+    EXPECT_EQ(Async::GetPendingCount(), u32(1));
+
+    release = TRUE;
+    EXPECT_TRUE(Async::WaitIdle(5000));
+    EXPECT_EQ(Async::ProcessCompletions(), u32(1)); // the empty completion is still counted
+}
+
+TEST_F(AsyncTest, CompletionQueuesMoreWork)
+{
+    i32 value = 0;
+    Async::Run([&]()
+               { value = 1; },
+               [&]()
+               { Async::Run([&]()
+                            { value *= 10; }); });
+
+    ASSERT_TRUE(Async::WaitIdle(5000));
+    EXPECT_EQ(Async::ProcessCompletions(), u32(1));
+    ASSERT_TRUE(Async::WaitIdle(5000));
+    EXPECT_EQ(value, 10);
+}
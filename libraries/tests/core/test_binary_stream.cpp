@@ -0,0 +1,267 @@
+#include "test_common.h"
+
+namespace
+{
+    struct BinaryItem
+    {
+        String name;
+        i32 id;
+        f64 weight;
+        b8 enabled;
+        Array<String> tags;
+    };
+
+    struct BinaryItemV2
+    {
+        String name;
+        u64 extra;
+    };
+} // namespace
+
+namespace rpp
+{
+    template <>
+    void WriteBinary<BinaryItem>(BinaryWriter &writer, const BinaryItem &value)
+    {
+        u32 structMarker = writer.BeginStruct();
+        writer.Field(BinaryKey("name"), value.name);
+        writer.Field(BinaryKey("id"), value.id);
+        writer.Field(BinaryKey("weight"), value.weight);
+        writer.Field(BinaryKey("enabled"), value.enabled);
+        writer.Field(BinaryKey("tags"), value.tags);
+        writer.EndStruct(structMarker);
+    }
+
+    template <>
+    b8 ReadBinary<BinaryItem>(BinaryReader &reader, BinaryItem &value)
+    {
+        u32 structEnd = 0;
+        if (!reader.BeginStruct(structEnd))
+        {
+            return FALSE;
+        }
+
+        u32 key = 0;
+        u32 fieldEnd = 0;
+        while (reader.NextField(structEnd, key, fieldEnd))
+        {
+            switch (key)
+            {
+            case BinaryKey("name"):
+                reader.Read(value.name);
+                break;
+            case BinaryKey("id"):
+                reader.Read(value.id);
+                break;
+            case BinaryKey("weight"):
+                reader.Read(value.weight);
+                break;
+            case BinaryKey("enabled"):
+                reader.Read(value.enabled);
+                break;
+            case BinaryKey("tags"):
+                reader.Read(value.tags);
+                break;
+            default:
+                break;
+            }
+            reader.Seek(fieldEnd);
+        }
+
+        return !reader.HasError();
+    }
+
+    template <>
+    void WriteBinary<BinaryItemV2>(BinaryWriter &writer, const BinaryItemV2 &value)
+    {
+        u32 structMarker = writer.BeginStruct();
+        writer.Field(BinaryKey("extra"), value.extra);
+        writer.Field(BinaryKey("name"), value.name);
+        writer.EndStruct(structMarker);
+    }
+} // namespace rpp
+
+class BinaryFileTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        rpp::FileSystem::Initialize("temp");
+    }
+
+    void TearDown() override
+    {
+        rpp::FileSystem::Shutdown();
+    }
+};
+
+TEST(BinaryStreamTest, PrimitivesAreLittleEndian)
+{
+    BinaryWriter writer;
+    writer.Write(u32(0x01020304));
+    writer.Write(i16(-2));
+    writer.Write(TRUE);
+    writer.Write("ab");
+
+    const u8 expected[] = {0x04, 0x03, 0x02, 0x01, 0xFE, 0xFF, 0x01, 0x02, 0x00, 0x00, 0x00, 'a', 'b'};
+    ASSERT_EQ(writer.Size(), u32(sizeof(expected)));
+    EXPECT_EQ(memcmp(writer.Data(), expected, sizeof(expected)), 0);
+
+    BinaryReader reader(writer.Data(), writer.Size());
+    u32 number = 0;
+    i16 negative = 0;
+    b8 flag = FALSE;
+    String text;
+    EXPECT_TRUE(reader.Read(number));
+    EXPECT_TRUE(reader.Read(negative));
+    EXPECT_TRUE(reader.Read(flag));
+    EXPECT_TRUE(reader.Read(text));
+    EXPECT_EQ(number, u32(0x01020304));
+    EXPECT_EQ(negative, -2);
+    EXPECT_TRUE(flag);
+    EXPECT_STREQ(text.CStr(), "ab");
+    EXPECT_EQ(reader.GetPosition(), writer.Size());
+}
+
+TEST(BinaryStreamTest, UnknownAndMissingFields)
+{
+    BinaryWriter writer;
+    WriteBinary(writer, BinaryItemV2{"newer", 123});
+
+    BinaryItem item = {};
+    item.id = 9;
+
+    BinaryReader reader(writer.Data(), writer.Size());
+    EXPECT_TRUE(ReadBinary(reader, item));
+    EXPECT_STREQ(item.name.CStr(), "newer");
+    EXPECT_EQ(item.id, 9); // missing field keeps the current value
+    EXPECT_EQ(reader.GetPosition(), writer.Size());
+}
+
+TEST(BinaryStreamTest, TruncatedDataSetsError)
+{
+    BinaryItem item = {"robot", 1, 0.5, TRUE, {}};
+    item.tags.Push("a");
+
+    BinaryWriter writer;
+    WriteBinary(writer, item);
+
+    for (u32 size = 0; size < writer.Size(); size++)
+    {
+        BinaryItem result = {};
+        BinaryReader reader(writer.Data(), size);
+        EXPECT_FALSE(ReadBinary(reader, result)) << size;
+        EXPECT_TRUE(reader.HasError());
+    }
+
+    // an absurd array count must not allocate anything
+    const u8 corrupted[] = {0xFF, 0xFF, 0xFF, 0x7F};
+    BinaryReader reader(corrupted, sizeof(corrupted));
+    Array<u32> values;
+    EXPECT_FALSE(reader.Read(values));
+    EXPECT_EQ(values.Size(), u32(0));
+}
+
+TEST(BinaryStreamTest, ArrayReadOverwrites)
+{
+    Array<u32> written;
+    written.Push(4);
+    written.Push(5);
+
+    BinaryWriter writer;
+    writer.Write(written);
+
+    Array<u32> values;
+    values.Push(1);
+    values.Push(2);
+    values.Push(3);
+
+    BinaryReader reader(writer.Data(), writer.Size());
+    EXPECT_TRUE(reader.Read(values));
+    ASSERT_EQ(values.Size(), u32(2));
+    EXPECT_EQ(values[0], u32(4));
+    EXPECT_EQ(values[1], u32(5));
+}
+
+TEST(BinaryStreamTest, HeaderCheck)
+{
+    BinaryWriter writer;
+    writer.WriteHeader();
+
+    BinaryReader reader(writer.Data(), writer.Size());
+    EXPECT_TRUE(reader.ReadHeader());
+
+    const u8 json[] = {'{', '"', 'a', '"', ':', '1', '}', ' '};
+    BinaryReader jsonReader(json, sizeof(json));
+    EXPECT_FALSE(jsonReader.ReadHeader());
+}
+
+TEST_F(BinaryFileTest, RoundTripThroughFile)
+{
+    String filePath = FileSystem::CWD() + "/items.bin";
+
+    Array<BinaryItem> items;
+    for (i32 i = 0; i < 2000; i++)
+    {
+        BinaryItem item = {Format("item {}", i), i * 1000, static_cast<f64>(i) / 3.0, i % 2 == 0, {}};
+        item.tags.Push(Format("tag-{}", i));
+        items.Push(item);
+    }
+
+    BinaryWriter writer;
+    writer.WriteHeader();
+    writer.Write(items);
+
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE | FILE_MODE_BINARY);
+    writer.WriteTo(file);
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(filePath, FILE_MODE_READ | FILE_MODE_BINARY);
+    {
+        BinaryReader reader(file);
+        ASSERT_TRUE(reader.ReadHeader());
+
+        Array<BinaryItem> result;
+        ASSERT_TRUE(reader.Read(result));
+        ASSERT_EQ(result.Size(), items.Size());
+        for (u32 i = 0; i < items.Size(); i++)
+        {
+            EXPECT_STREQ(result[i].name.CStr(), items[i].name.CStr());
+            EXPECT_EQ(result[i].id, items[i].id);
+            EXPECT_EQ(result[i].weight, items[i].weight);
+            EXPECT_EQ(result[i].enabled, items[i].enabled);
+            ASSERT_EQ(result[i].tags.Size(), u32(1));
+            EXPECT_STREQ(result[i].tags[0].CStr(), items[i].tags[0].CStr());
+        }
+    }
+    FileSystem::CloseFile(file);
+}
+
+TEST_F(BinaryFileTest, ReadMappedFileInPlace)
+{
+    String filePath = FileSystem::CWD() + "/mapped.bin";
+
+    BinaryWriter writer;
+    writer.WriteHeader();
+    writer.Write("in place");
+
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE | FILE_MODE_BINARY);
+    writer.WriteTo(file);
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::MapFile(filePath);
+    {
+        BinaryReader reader(file);
+        ASSERT_TRUE(reader.ReadHeader());
+
+        StringView text;
+        ASSERT_TRUE(reader.Read(text));
+        EXPECT_TRUE(text == "in place");
+
+        // the view points into the mapping, nothing was copied
+        const u8 *mappedData = FileSystem::GetMappedData(file);
+        EXPECT_GE(reinterpret_cast<const u8 *>(text.Data()), mappedData);
+        EXPECT_LE(reinterpret_cast<const u8 *>(text.Data()) + text.Length(), mappedData + FileSystem::GetMappedSize(file));
+    }
+    FileSystem::CloseFile(file);
+}
@@ -115,4 +115,455 @@ TEST_F(FileSystemTest, SpaceFolderName)
     ASSERT_STREQ(parts[1].CStr(), "My Documents");
     ASSERT_STREQ(parts[2].CStr(), "Work Folder");
     ASSERT_STREQ(parts[3].CStr(), "file name.txt");
-}
\ No newline at end of file
+}
+
+TEST_F(FileSystemTest, ReadMultipleLines)
+{
+    String filePath = rpp::FileSystem::CWD() + "/lines.txt";
+
+    String longLine;
+    for (u32 i = 0; i < 2000; i++)
+    {
+        longLine += "0123456789";
+    }
+
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE);
+    ASSERT_NE(file, INVALID_ID);
+    FileSystem::Write(file, Format("\nfirst\n\nthird\n{}\n", longLine));
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(filePath, FILE_MODE_READ);
+    ASSERT_NE(file, INVALID_ID);
+    String content = FileSystem::Read(file);
+    FileSystem::CloseFile(file);
+
+    EXPECT_EQ(content, Format("first\n\nthird\n{}", longLine));
+}
+
+TEST_F(FileSystemTest, MapFile)
+{
+    String filePath = rpp::FileSystem::CWD() + "/mapped.txt";
+
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE);
+    FileSystem::Write(file, "mapped content");
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::MapFile(filePath);
+    ASSERT_TRUE(FileSystem::IsFileOpen(file));
+    EXPECT_TRUE(FileSystem::IsFileMapped(file));
+    ASSERT_EQ(FileSystem::GetMappedSize(file), u32(14));
+    EXPECT_EQ(memcmp(FileSystem::GetMappedData(file), "mapped content", 14), 0);
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(rpp::FileSystem::CWD() + "/empty.txt", FILE_MODE_WRITE);
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::MapFile(rpp::FileSystem::CWD() + "/empty.txt");
+    ASSERT_TRUE(FileSystem::IsFileOpen(file));
+    EXPECT_EQ(FileSystem::GetMappedSize(file), u32(0));
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::MapFile(rpp::FileSystem::CWD() + "/missing.txt");
+    EXPECT_FALSE(FileSystem::IsFileOpen(file));
+    FileSystem::CloseFile(file);
+}
+
+TEST_F(FileSystemTest, RenameFileReplacesDestination)
+{
+    String sourcePath = rpp::FileSystem::CWD() + "/new.txt";
+    String destinationPath = rpp::FileSystem::CWD() + "/current.txt";
+
+    FileHandle file = FileSystem::OpenFile(destinationPath, FILE_MODE_WRITE);
+    FileSystem::Write(file, "old");
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(sourcePath, FILE_MODE_WRITE);
+    FileSystem::Write(file, "new");
+    FileSystem::CloseFile(file);
+
+    EXPECT_TRUE(FileSystem::RenameFile(sourcePath, destinationPath));
+    EXPECT_FALSE(FileSystem::PathExists(sourcePath));
+
+    file = FileSystem::OpenFile(destinationPath);
+    EXPECT_STREQ(FileSystem::Read(file).CStr(), "new");
+    FileSystem::CloseFile(file);
+
+    EXPECT_FALSE(FileSystem::RenameFile(sourcePath, destinationPath));
+}
+
+TEST_F(FileSystemTest, ReadAllKeepsBytes)
+{
+    String filePath = rpp::FileSystem::CWD() + "/data.bin";
+
+    // everything `Read` would change: carriage returns, a NUL byte and the trailing newline
+    const u8 data[] = {'a', '\r', '\n', 0, 0xFF, '\n', '\n'};
+    ASSERT_TRUE(FileSystem::WriteAll(filePath, data, sizeof(data)));
+
+    Array<u8> bytes;
+    ASSERT_TRUE(FileSystem::ReadAll(filePath, bytes));
+    ASSERT_EQ(bytes.Size(), u32(sizeof(data)));
+    EXPECT_EQ(memcmp(bytes.Data(), data, sizeof(data)), 0);
+
+    EXPECT_FALSE(FileSystem::ReadAll(rpp::FileSystem::CWD() + "/missing.bin", bytes));
+    EXPECT_EQ(bytes.Size(), u32(0));
+}
+
+TEST_F(FileSystemTest, ReadBytesFromCurrentPosition)
+{
+    String filePath = rpp::FileSystem::CWD() + "/chunks.bin";
+
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE | FILE_MODE_BINARY);
+    for (u32 i = 0; i < 1000; i++)
+    {
+        FileSystem::WriteBytes(file, reinterpret_cast<const u8 *>("0123456789"), 10);
+    }
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(filePath, FILE_MODE_READ | FILE_MODE_BINARY);
+    char header[4];
+    ASSERT_EQ(FileSystem::ReadChunk(file, header, sizeof(header)), u32(4));
+
+    Array<u8> bytes;
+    ASSERT_TRUE(FileSystem::ReadBytes(file, bytes));
+    ASSERT_EQ(bytes.Size(), u32(9996));
+    EXPECT_EQ(bytes[0], '4');
+    EXPECT_EQ(bytes[9995], '9');
+
+    // nothing is left
+    EXPECT_TRUE(FileSystem::ReadBytes(file, bytes));
+    EXPECT_EQ(bytes.Size(), u32(0));
+    FileSystem::CloseFile(file);
+}
+
+TEST_F(FileSystemTest, MapFileForWriting)
+{
+    String filePath = rpp::FileSystem::CWD() + "/writable.bin";
+    ASSERT_TRUE(FileSystem::WriteAll(filePath, reinterpret_cast<const u8 *>("abcdef"), 6));
+
+    FileHandle file = FileSystem::MapFile(filePath, FILE_MODE_READ_WRITE);
+    ASSERT_TRUE(FileSystem::IsFileOpen(file));
+
+    Span<u8> bytes = FileSystem::GetMappedWritableBytes(file);
+    ASSERT_EQ(bytes.Size(), u32(6));
+    bytes[0] = 'A';
+    for (u8 &byte : bytes.SubSpan(4, 2))
+    {
+        byte = 'Z';
+    }
+    EXPECT_TRUE(FileSystem::FlushMappedFile(file));
+
+    // another mapping of the same file sees the change straight away
+    FileHandle readOnly = FileSystem::MapFile(filePath);
+    Span<const u8> view = FileSystem::GetMappedBytes(readOnly);
+    ASSERT_EQ(view.Size(), u32(6));
+    EXPECT_EQ(memcmp(view.Data(), "AbcdZZ", 6), 0);
+    EXPECT_THROW(view.SubSpan(5, 2), std::runtime_error);
+    FileSystem::CloseFile(readOnly);
+    FileSystem::CloseFile(file);
+
+    Array<u8> content;
+    ASSERT_TRUE(FileSystem::ReadAll(filePath, content));
+    EXPECT_EQ(memcmp(content.Data(), "AbcdZZ", 6), 0);
+}
+
+TEST_F(FileSystemTest, RecreateDeletedDirectory)
+{
+    String directoryPath = rpp::FileSystem::CWD() + "/cached/nested";
+    const u8 data[] = {'x'};
+
+    ASSERT_TRUE(FileSystem::WriteAll(directoryPath + "/first.bin", data, sizeof(data)));
+    ASSERT_TRUE(FileSystem::WriteAll(directoryPath + "/second.bin", data, sizeof(data)));
+
+    // the directory is remembered after the first write, it must be created again once deleted
+    FileSystem::DeleteFile(directoryPath + "/first.bin");
+    FileSystem::DeleteFile(directoryPath + "/second.bin");
+    FileSystem::DeleteFile(directoryPath);
+    ASSERT_FALSE(FileSystem::PathExists(directoryPath));
+
+    EXPECT_TRUE(FileSystem::WriteAll(directoryPath + "\\.\\third.bin", data, sizeof(data)));
+    EXPECT_TRUE(FileSystem::IsDirectory(directoryPath));
+    EXPECT_TRUE(FileSystem::PathExists(directoryPath + "/third.bin"));
+}
+
+TEST_F(FileSystemTest, MatchGlob)
+{
+    EXPECT_TRUE(FileSystem::MatchGlob("robot.png", "*.png"));
+    EXPECT_TRUE(FileSystem::MatchGlob("robot.png", "*"));
+    EXPECT_TRUE(FileSystem::MatchGlob("move_1.py", "move_?.py"));
+    EXPECT_TRUE(FileSystem::MatchGlob("a.b.c", "*.*.c"));
+    EXPECT_TRUE(FileSystem::MatchGlob("", "*"));
+    EXPECT_FALSE(FileSystem::MatchGlob("robot.png", "*.py"));
+    EXPECT_FALSE(FileSystem::MatchGlob("move_12.py", "move_?.py"));
+    EXPECT_FALSE(FileSystem::MatchGlob("Robot.png", "robot*"));
+    EXPECT_FALSE(FileSystem::MatchGlob("robot.png", ""));
+}
+
+TEST_F(FileSystemTest, ListDirectory)
+{
+    String directoryPath = rpp::FileSystem::CWD() + "/listed";
+    const u8 data[] = {'x'};
+    ASSERT_TRUE(FileSystem::WriteAll(directoryPath + "/b.py", data, sizeof(data)));
+    ASSERT_TRUE(FileSystem::WriteAll(directoryPath + "/a.py", data, sizeof(data)));
+    ASSERT_TRUE(FileSystem::WriteAll(directoryPath + "/texture.png", data, sizeof(data)));
+    FileSystem::CreateDirectory(directoryPath + "/functions");
+
+    Array<DirectoryEntry> entries;
+    ASSERT_TRUE(FileSystem::ListDirectory(directoryPath, entries));
+    ASSERT_EQ(entries.Size(), u32(4));
+    EXPECT_STREQ(entries[0].name.CStr(), "a.py");
+    EXPECT_STREQ(entries[1].name.CStr(), "b.py");
+    EXPECT_STREQ(entries[2].name.CStr(), "functions");
+    EXPECT_TRUE(entries[2].isDirectory);
+    EXPECT_FALSE(entries[3].isDirectory);
+
+    ASSERT_TRUE(FileSystem::ListDirectory(directoryPath, entries, "*.py"));
+    ASSERT_EQ(entries.Size(), u32(2));
+    EXPECT_STREQ(entries[1].name.CStr(), "b.py");
+
+    EXPECT_FALSE(FileSystem::ListDirectory(directoryPath + "/missing", entries));
+    EXPECT_EQ(entries.Size(), u32(0));
+}
+
+TEST_F(FileSystemTest, WatchCoalescesChanges)
+{
+    String directoryPath = rpp::FileSystem::CWD() + "/watched";
+    FileSystem::CreateDirectory(directoryPath);
+
+    Array<FileChangeEvent> events;
+    WatchHandle watch = FileSystem::Watch(directoryPath, [&](const FileChangeEvent &event)
+                                          { events.Push(event); });
+    ASSERT_NE(watch, INVALID_ID);
+    EXPECT_EQ(FileSystem::Watch(directoryPath + "/missing", [](const FileChangeEvent &) {}), INVALID_ID);
+
+    // a save made of several writes
+    FileHandle file = FileSystem::OpenFile(directoryPath + "/robot.json", FILE_MODE_WRITE);
+    FileSystem::Write(file, "{");
+    FileSystem::Write(file, "}");
+    FileSystem::CloseFile(file);
+
+    for (u32 i = 0; i < 200 && events.Size() == 0; i++)
+    {
+        FileSystem::ProcessWatchEvents();
+        Thread::Sleep(10);
+    }
+
+    ASSERT_EQ(events.Size(), u32(1));
+    EXPECT_EQ(events[0].watch, watch);
+    EXPECT_STREQ(events[0].filePath.CStr(), (directoryPath + "/robot.json").CStr());
+    EXPECT_EQ(events[0].changes, u8(FILE_CHANGE_CREATED | FILE_CHANGE_MODIFIED));
+
+    // nothing is dispatched once the watch is stopped
+    FileSystem::Unwatch(watch);
+    FileSystem::DeleteFile(directoryPath + "/robot.json");
+    Thread::Sleep(100);
+    EXPECT_EQ(FileSystem::ProcessWatchEvents(), u32(0));
+}
+
+TEST_F(FileSystemTest, MountMemory)
+{
+    String mountPoint = rpp::FileSystem::CWD() + "/memory";
+    ASSERT_TRUE(FileSystem::MountMemory(mountPoint));
+    EXPECT_FALSE(FileSystem::MountMemory(mountPoint + "/"));
+
+    const u8 data[] = {'a', '\n', 0, 'b'};
+    ASSERT_TRUE(FileSystem::WriteAll(mountPoint + "/scripts/move.py", data, sizeof(data)));
+    EXPECT_TRUE(FileSystem::IsDirectory(mountPoint + "/scripts"));
+    EXPECT_TRUE(FileSystem::PathExists(mountPoint + "/scripts/./move.py"));
+    EXPECT_FALSE(FileSystem::PathExists(mountPoint + "/missing.py"));
+    EXPECT_FALSE(FileSystem::IsPhysicalPathExists(Format("temp/{}", mountPoint)));
+
+    Array<u8> bytes;
+    ASSERT_TRUE(FileSystem::ReadAll(mountPoint + "/scripts/move.py", bytes));
+    ASSERT_EQ(bytes.Size(), u32(sizeof(data)));
+    EXPECT_EQ(memcmp(bytes.Data(), data, sizeof(data)), 0);
+
+    FileHandle file = FileSystem::OpenFile(mountPoint + "/scripts/move.py", FILE_MODE_READ | FILE_MODE_BINARY);
+    ASSERT_TRUE(FileSystem::IsFileOpen(file));
+    char chunk[2] = {};
+    EXPECT_EQ(FileSystem::ReadChunk(file, chunk, sizeof(chunk)), u32(2));
+    EXPECT_TRUE(FileSystem::ReadBytes(file, bytes));
+    EXPECT_EQ(bytes.Size(), u32(2));
+    FileSystem::CloseFile(file);
+
+    Array<DirectoryEntry> entries;
+    ASSERT_TRUE(FileSystem::ListDirectory(mountPoint, entries));
+    ASSERT_EQ(entries.Size(), u32(1));
+    EXPECT_STREQ(entries[0].name.CStr(), "scripts");
+    EXPECT_TRUE(entries[0].isDirectory);
+
+    FileSystem::DeleteFile(mountPoint + "/scripts/move.py");
+    EXPECT_FALSE(FileSystem::PathExists(mountPoint + "/scripts"));
+
+    ASSERT_TRUE(FileSystem::WriteAll(mountPoint + "/left.txt", data, sizeof(data)));
+    ASSERT_TRUE(FileSystem::Unmount(mountPoint));
+    EXPECT_FALSE(FileSystem::Unmount(mountPoint));
+    EXPECT_FALSE(FileSystem::PathExists(mountPoint + "/left.txt"));
+}
+
+TEST_F(FileSystemTest, MapMountedFile)
+{
+    String mountPoint = rpp::FileSystem::CWD() + "/mapped_memory";
+    ASSERT_TRUE(FileSystem::MountMemory(mountPoint));
+
+    const u8 data[] = {'r', 'o', 'b', 'o', 't'};
+    ASSERT_TRUE(FileSystem::WriteAll(mountPoint + "/robot.txt", data, sizeof(data)));
+
+    FileHandle file = FileSystem::MapFile(mountPoint + "/robot.txt");
+    ASSERT_TRUE(FileSystem::IsFileOpen(file));
+    EXPECT_TRUE(FileSystem::IsFileMapped(file));
+    ASSERT_EQ(FileSystem::GetMappedSize(file), u32(sizeof(data)));
+    EXPECT_EQ(memcmp(FileSystem::GetMappedData(file), data, sizeof(data)), 0);
+    FileSystem::CloseFile(file);
+
+    // the mounts are read-only through a mapping, and missing files are not opened
+    file = FileSystem::MapFile(mountPoint + "/robot.txt", FILE_MODE_READ_WRITE);
+    EXPECT_FALSE(FileSystem::IsFileOpen(file));
+    FileSystem::CloseFile(file);
+    file = FileSystem::MapFile(mountPoint + "/missing.txt");
+    EXPECT_FALSE(FileSystem::IsFileOpen(file));
+    FileSystem::CloseFile(file);
+
+    ASSERT_TRUE(FileSystem::Unmount(mountPoint));
+}
+
+TEST_F(FileSystemTest, WriteMountedFile)
+{
+    String mountPoint = rpp::FileSystem::CWD() + "/written_memory";
+    ASSERT_TRUE(FileSystem::MountMemory(mountPoint));
+
+    // the file exists once opened, its content is stored when the handle is closed
+    FileHandle file = FileSystem::OpenFile(mountPoint + "/robot.txt.tmp", FILE_MODE_WRITE);
+    ASSERT_TRUE(FileSystem::IsFileOpen(file));
+    EXPECT_TRUE(FileSystem::PathExists(mountPoint + "/robot.txt.tmp"));
+    FileSystem::Write(file, "a robot");
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(mountPoint + "/robot.txt.tmp", FILE_MODE_APPEND | FILE_MODE_BINARY);
+    ASSERT_TRUE(FileSystem::IsFileOpen(file));
+    FileSystem::WriteChunk(file, " moves", 6);
+    FileSystem::CloseFile(file);
+
+    const u8 old[] = {'o', 'l', 'd'};
+    ASSERT_TRUE(FileSystem::WriteAll(mountPoint + "/robot.txt", old, sizeof(old)));
+    EXPECT_TRUE(FileSystem::RenameFile(mountPoint + "/robot.txt.tmp", mountPoint + "/robot.txt"));
+    EXPECT_FALSE(FileSystem::PathExists(mountPoint + "/robot.txt.tmp"));
+    EXPECT_FALSE(FileSystem::RenameFile(mountPoint + "/missing.txt", mountPoint + "/robot.txt"));
+    EXPECT_FALSE(FileSystem::RenameFile(mountPoint + "/robot.txt", rpp::FileSystem::CWD() + "/robot.txt"));
+
+    Array<u8> bytes;
+    ASSERT_TRUE(FileSystem::ReadAll(mountPoint + "/robot.txt", bytes));
+    ASSERT_EQ(bytes.Size(), u32(13));
+    EXPECT_EQ(memcmp(bytes.Data(), "a robot moves", 13), 0);
+
+    file = FileSystem::OpenFile(mountPoint + "/robot.txt", FILE_MODE_READ_WRITE);
+    EXPECT_FALSE(FileSystem::IsFileOpen(file));
+    FileSystem::CloseFile(file);
+
+    ASSERT_TRUE(FileSystem::Unmount(mountPoint));
+}
+
+TEST_F(FileSystemTest, MountDirectory)
+{
+    FileSystem::CreatePhysicalDirectory("temp/mounted_source");
+    FileHandle file = FileSystem::OpenPhysicalFile("temp/mounted_source/robot.txt", FILE_MODE_WRITE);
+    FileSystem::Write(file, "mounted");
+    FileSystem::CloseFile(file);
+
+    String mountPoint = rpp::FileSystem::CWD() + "/assets";
+    EXPECT_FALSE(FileSystem::MountDirectory(mountPoint, "temp/missing_source"));
+    ASSERT_TRUE(FileSystem::MountDirectory(mountPoint, "temp/mounted_source"));
+
+    Array<u8> bytes;
+    ASSERT_TRUE(FileSystem::ReadAll(mountPoint + "/robot.txt", bytes));
+    EXPECT_EQ(bytes.Size(), u32(7));
+    EXPECT_TRUE(FileSystem::IsDirectory(mountPoint));
+
+    // the files written through the mount land in the directory
+    const u8 data[] = {'x'};
+    ASSERT_TRUE(FileSystem::WriteAll(mountPoint + "/nested/new.txt", data, sizeof(data)));
+    EXPECT_TRUE(FileSystem::IsPhysicalPathExists("temp/mounted_source/nested/new.txt"));
+
+    // a path which only shares a prefix with the mount point is not inside it
+    EXPECT_FALSE(FileSystem::PathExists(mountPoint + "2/robot.txt"));
+
+    ASSERT_TRUE(FileSystem::Unmount(mountPoint));
+    EXPECT_FALSE(FileSystem::PathExists(mountPoint + "/robot.txt"));
+}
+
+TEST_F(FileSystemTest, MountArchive)
+{
+    String sourcePath = rpp::FileSystem::CWD() + "/pack";
+    String text = "a robot moves forward, a robot moves backward, a robot moves forward again";
+    const u8 small[] = {1, 2, 3};
+    ASSERT_TRUE(FileSystem::WriteAll(sourcePath + "/texts/robot.txt", reinterpret_cast<const u8 *>(text.CStr()), text.Length()));
+    ASSERT_TRUE(FileSystem::WriteAll(sourcePath + "/small.bin", small, sizeof(small)));
+    ASSERT_TRUE(FileSystem::WriteAll(sourcePath + "/empty.bin", small, 0));
+
+    // long runs and literals, for the extended lengths of the compression
+    Array<u8> large;
+    for (u32 i = 0; i < 4000; i++)
+    {
+        large.Push(i < 1000 ? u8('r') : u8((i * 7919) >> 3));
+    }
+    ASSERT_TRUE(FileSystem::WriteAll(sourcePath + "/large.bin", large.Data(), large.Size()));
+
+    for (b8 compress : {TRUE, FALSE})
+    {
+        String archivePath = rpp::FileSystem::CWD() + (compress ? "/compressed.rpak" : "/stored.rpak");
+        ASSERT_TRUE(FileSystem::CreateArchive(archivePath, sourcePath, compress));
+
+        String mountPoint = rpp::FileSystem::CWD() + "/archive";
+        ASSERT_TRUE(FileSystem::MountArchive(mountPoint, archivePath));
+
+        Array<u8> bytes;
+        ASSERT_TRUE(FileSystem::ReadAll(mountPoint + "/texts/robot.txt", bytes));
+        ASSERT_EQ(bytes.Size(), text.Length());
+        EXPECT_EQ(memcmp(bytes.Data(), text.CStr(), text.Length()), 0);
+
+        ASSERT_TRUE(FileSystem::ReadAll(mountPoint + "/small.bin", bytes));
+        ASSERT_EQ(bytes.Size(), u32(sizeof(small)));
+        EXPECT_EQ(bytes[2], u8(3));
+        ASSERT_TRUE(FileSystem::ReadAll(mountPoint + "/large.bin", bytes));
+        ASSERT_EQ(bytes.Size(), large.Size());
+        EXPECT_EQ(memcmp(bytes.Data(), large.Data(), large.Size()), 0);
+        ASSERT_TRUE(FileSystem::ReadAll(mountPoint + "/empty.bin", bytes));
+        EXPECT_EQ(bytes.Size(), u32(0));
+        EXPECT_FALSE(FileSystem::ReadAll(mountPoint + "/missing.bin", bytes));
+
+        FileHandle file = FileSystem::OpenFile(mountPoint + "/texts/robot.txt");
+        ASSERT_TRUE(FileSystem::IsFileOpen(file));
+        EXPECT_STREQ(FileSystem::Read(file).CStr(), text.CStr());
+        FileSystem::CloseFile(file);
+
+        Array<DirectoryEntry> entries;
+        ASSERT_TRUE(FileSystem::ListDirectory(mountPoint, entries, "*.bin"));
+        ASSERT_EQ(entries.Size(), u32(3));
+        EXPECT_STREQ(entries[0].name.CStr(), "empty.bin");
+        EXPECT_TRUE(FileSystem::IsDirectory(mountPoint + "/texts"));
+
+        // the archives are read-only
+        EXPECT_FALSE(FileSystem::WriteAll(mountPoint + "/small.bin", small, sizeof(small)));
+        file = FileSystem::OpenFile(mountPoint + "/small.bin", FILE_MODE_WRITE);
+        EXPECT_FALSE(FileSystem::IsFileOpen(file));
+        FileSystem::CloseFile(file);
+
+        ASSERT_TRUE(FileSystem::Unmount(mountPoint));
+    }
+
+    Array<u8> compressed;
+    Array<u8> stored;
+    ASSERT_TRUE(FileSystem::ReadAll(rpp::FileSystem::CWD() + "/compressed.rpak", compressed));
+    ASSERT_TRUE(FileSystem::ReadAll(rpp::FileSystem::CWD() + "/stored.rpak", stored));
+    EXPECT_LT(compressed.Size(), stored.Size());
+
+    // a truncated archive is rejected
+    ASSERT_TRUE(FileSystem::WriteAll(rpp::FileSystem::CWD() + "/broken.rpak", compressed.Data(), compressed.Size() - 1));
+    EXPECT_FALSE(FileSystem::MountArchive(rpp::FileSystem::CWD() + "/broken", rpp::FileSystem::CWD() + "/broken.rpak"));
+    EXPECT_FALSE(FileSystem::MountArchive(rpp::FileSystem::CWD() + "/missing", rpp::FileSystem::CWD() + "/missing.rpak"));
+
+    // so is an entry whose size cannot come from its stored bytes (the size of the first entry of the table)
+    u32 tableOffset = u32(stored[12]) | (u32(stored[13]) << 8) | (u32(stored[14]) << 16) | (u32(stored[15]) << 24);
+    stored[tableOffset + 11] = 0x7F;
+    ASSERT_TRUE(FileSystem::WriteAll(rpp::FileSystem::CWD() + "/oversized.rpak", stored.Data(), stored.Size()));
+    EXPECT_FALSE(FileSystem::MountArchive(rpp::FileSystem::CWD() + "/oversized", rpp::FileSystem::CWD() + "/oversized.rpak"));
+}
@@ -1,4 +1,7 @@
 #include "test_common.h"
+#include <chrono>
+#include <cstdio>
+#include <string>
 
 TEST(FormatTest, BasicFormatString)
 {
@@ -23,7 +26,10 @@ TEST(FormatTest, BooleanFormatting)
 TEST(FormatTest, FloatFormatting)
 {
     String formatted = Format("Pi is approximately {}.", 3.14159f);
-    EXPECT_STREQ(formatted.CStr(), "Pi is approximately 3.14.");
+    EXPECT_STREQ(formatted.CStr(), "Pi is approximately 3.14159.");
+
+    String rounded = Format("Pi is approximately {:.2}.", 3.14159f);
+    EXPECT_STREQ(rounded.CStr(), "Pi is approximately 3.14.");
 }
 
 TEST(FormatTest, NoPlaceholders)
@@ -36,4 +42,174 @@ TEST(FormatTest, MissingArguments)
 {
     String formatted = Format("Only one placeholder: {}: {}", 123);
     EXPECT_STREQ(formatted.CStr(), "Only one placeholder: 123: {}");
-}
\ No newline at end of file
+}
+
+TEST(FormatTest, PlaceholderInsideArgumentIsKept)
+{
+    String formatted = Format("{} and {}", String("{}"), 42);
+    EXPECT_STREQ(formatted.CStr(), "{} and 42");
+}
+
+TEST(FormatTest, IntegerTypes)
+{
+    String formatted = Format("{} {} {} {}", u8(255), i16(-12), u64(18446744073709551615ull), i64(-9223372036854775807ll));
+    EXPECT_STREQ(formatted.CStr(), "255 -12 18446744073709551615 -9223372036854775807");
+}
+
+TEST(FormatTest, WidthAndAlignment)
+{
+    EXPECT_STREQ(Format("[{:5}]", 42).CStr(), "[   42]");
+    EXPECT_STREQ(Format("[{:5}]", String("ab")).CStr(), "[ab   ]");
+    EXPECT_STREQ(Format("[{:<5}]", 42).CStr(), "[42   ]");
+    EXPECT_STREQ(Format("[{:^6}]", String("ab")).CStr(), "[  ab  ]");
+    EXPECT_STREQ(Format("[{:*>5}]", 7).CStr(), "[****7]");
+    EXPECT_STREQ(Format("[{:05}]", -42).CStr(), "[-0042]");
+}
+
+TEST(FormatTest, Precision)
+{
+    EXPECT_STREQ(Format("{:.3}", 3.14159).CStr(), "3.142");
+    EXPECT_STREQ(Format("{:.0}", 2.5f).CStr(), "2");
+    EXPECT_STREQ(Format("[{:8.1}]", -1.25).CStr(), "[    -1.2]");
+    EXPECT_STREQ(Format("{:.3}", String("abcdef")).CStr(), "abc");
+
+    // the precision is clamped, so the digits always fit
+    String large = Format("{:.200}", 1.5);
+    EXPECT_EQ(large.Length(), 102u);
+    EXPECT_TRUE(large.StartsWith("1.500"));
+    String huge = Format("{:.200}", 1e300);
+    EXPECT_TRUE(huge.EndsWith("e+300"));
+    EXPECT_EQ(huge.Length(), 107u);
+}
+
+TEST(FormatTest, InvalidPlaceholderIsLiteral)
+{
+    String formatted = Format("{ \"key\": {} } {:x}", 1);
+    EXPECT_STREQ(formatted.CStr(), "{ \"key\": 1 } {:x}");
+}
+
+TEST(FormatTest, LongOutput)
+{
+    String longValue;
+    for (u32 i = 0; i < 100; i++)
+    {
+        longValue += "0123456789";
+    }
+
+    String formatted = Format("<{}>", longValue);
+    EXPECT_EQ(formatted.Length(), 1002u);
+    EXPECT_TRUE(formatted.StartsWith("<0123"));
+    EXPECT_TRUE(formatted.EndsWith("789>"));
+}
+
+TEST(FormatTest, FormatWriterTruncates)
+{
+    char buffer[8];
+    FormatWriter writer(buffer, sizeof(buffer));
+    FormatSpec spec = {' ', 0, FALSE, 0, -1};
+
+    writer.Write("Hello, ");
+    writer.WriteText("World", spec);
+
+    EXPECT_TRUE(writer.Truncated());
+    EXPECT_EQ(writer.Length(), 12u);
+    EXPECT_EQ(StringView(buffer, sizeof(buffer)), "Hello, W");
+}
+
+TEST(FormatTest, FormatToBuffer)
+{
+    char buffer[16];
+    u32 length = FormatTo(buffer, sizeof(buffer), "x={} y={}", 10, 20);
+    EXPECT_EQ(length, 9u);
+    EXPECT_STREQ(buffer, "x=10 y=20");
+
+    length = FormatTo(buffer, 8, "x={} y={}", 10, 20);
+    EXPECT_EQ(length, 9u);
+    EXPECT_STREQ(buffer, "x=10 y=");
+}
+
+TEST(FormatTest, NumberToString)
+{
+    EXPECT_EQ(ToString<i32>(-42), "-42");
+    EXPECT_EQ(ToString<u64>(18446744073709551615ull), "18446744073709551615");
+    EXPECT_EQ(ToString<i8>(i8(65)), "65");
+    EXPECT_EQ(ToString<f32>(0.1f), "0.1");
+    EXPECT_EQ(ToString<f64>(0.1), "0.1");
+    EXPECT_EQ(ToString<f64>(2.0), "2");
+    EXPECT_EQ(ToString<f64>(1e20), "1e+20");
+    EXPECT_EQ(ToString<f32>(-1.5f), "-1.5");
+}
+
+TEST(FormatTest, FromChars)
+{
+    i32 intValue = 0;
+    EXPECT_TRUE(FromChars("-123", intValue));
+    EXPECT_EQ(intValue, -123);
+    EXPECT_TRUE(FromChars("+7", intValue));
+    EXPECT_EQ(intValue, 7);
+    EXPECT_FALSE(FromChars("12a", intValue));
+    EXPECT_FALSE(FromChars("", intValue));
+    EXPECT_FALSE(FromChars(" 1", intValue));
+    EXPECT_FALSE(FromChars("+-1", intValue));
+    EXPECT_EQ(intValue, 7);
+
+    u8 byteValue = 0;
+    EXPECT_FALSE(FromChars("256", byteValue));
+    EXPECT_TRUE(FromChars("255", byteValue));
+    EXPECT_EQ(byteValue, 255);
+
+    f64 doubleValue = 0.0;
+    EXPECT_TRUE(FromChars("1e-3", doubleValue));
+    EXPECT_DOUBLE_EQ(doubleValue, 0.001);
+    EXPECT_FALSE(FromChars("1.0.0", doubleValue));
+}
+
+TEST(FormatTest, FloatRoundTrip)
+{
+    const f32 floats[] = {0.1f, 3.14159274f, 1e-10f, 123456.789f, -0.0f, 3.40282347e38f};
+    for (f32 value : floats)
+    {
+        f32 parsed = 1.0f;
+        ASSERT_TRUE(FromChars(ToString<f32>(value), parsed));
+        EXPECT_EQ(parsed, value);
+    }
+
+    const f64 doubles[] = {0.1, 1.0 / 3.0, 2.2250738585072014e-308, 6.02214076e23, -98765.4321};
+    for (f64 value : doubles)
+    {
+        f64 parsed = 1.0;
+        ASSERT_TRUE(FromChars(ToString<f64>(value), parsed));
+        EXPECT_EQ(parsed, value);
+    }
+}
+
+// run on demand with --gtest_also_run_disabled_tests
+TEST(FormatTest, DISABLED_NumberBenchmark)
+{
+    const u32 iterations = 200000;
+    u64 checksum = 0;
+
+    // previous implementation: snprintf for floats, std::to_string for integers
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < iterations; i++)
+    {
+        char buffer[32];
+        std::snprintf(buffer, sizeof(buffer), "%.2f", i * 0.37f);
+        checksum += String(buffer).Length();
+        checksum += String(std::to_string(i).c_str()).Length();
+    }
+    std::chrono::duration<f64> previous = std::chrono::steady_clock::now() - start;
+
+    start = std::chrono::steady_clock::now();
+    for (u32 i = 0; i < iterations; i++)
+    {
+        checksum += ToString<f32>(i * 0.37f).Length();
+        checksum += ToString<u32>(i).Length();
+    }
+    std::chrono::duration<f64> current = std::chrono::steady_clock::now() - start;
+
+    std::printf("[ BENCHMARK] ToString (f32 + u32): snprintf/to_string %.1f ns, to_chars %.1f ns per pair\n",
+                previous.count() * 1e9 / iterations, current.count() * 1e9 / iterations);
+
+    EXPECT_GT(checksum, 0u);
+}
@@ -0,0 +1,118 @@
+#include "test_common.h"
+#include <thread>
+
+class IOQueueTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        FileSystem::Initialize("temp");
+        Thread::Initialize();
+        Signal::Initialize();
+        IOQueue::Initialize();
+    }
+
+    void TearDown() override
+    {
+        IOQueue::Shutdown();
+        Signal::Shutdown();
+        Thread::Shutdown();
+        FileSystem::Shutdown();
+    }
+};
+
+static Array<u8> ToBytes(const char *text)
+{
+    Array<u8> bytes;
+    for (const char *c = text; *c != '\0'; c++)
+    {
+        bytes.Push(u8(*c));
+    }
+    return bytes;
+}
+
+TEST_F(IOQueueTest, ReadBatchOnTheCallingThread)
+{
+    std::thread::id mainThreadId = std::this_thread::get_id();
+    String root = FileSystem::CWD();
+
+    Array<String> filePaths;
+    for (u32 i = 0; i < 20; i++)
+    {
+        String filePath = Format("{}/file_{}.txt", root, i);
+        Array<u8> bytes = ToBytes(Format("content {}", i).CStr());
+        ASSERT_TRUE(FileSystem::WriteAll(filePath, bytes.Data(), bytes.Size()));
+        filePaths.Push(filePath);
+    }
+    filePaths.Push(Format("{}/missing.txt", root));
+
+    u32 callCount = 0;
+    std::thread::id callbackThreadId;
+    Array<FileReadResult> received;
+    IOQueue::ReadAsync(filePaths, [&](Array<FileReadResult> &results)
+                       {
+                           callCount++;
+                           callbackThreadId = std::this_thread::get_id();
+                           received = std::move(results); });
+
+    ASSERT_TRUE(IOQueue::WaitIdle(5000));
+    EXPECT_EQ(callCount, u32(0)); // nothing runs before the main loop asks for it
+    EXPECT_EQ(IOQueue::GetPendingCount(), u32(1));
+
+    EXPECT_EQ(IOQueue::ProcessCompletions(), u32(1));
+    EXPECT_EQ(callCount, u32(1));
+    EXPECT_EQ(callbackThreadId, mainThreadId);
+
+    // the results follow the order of the paths, whichever worker read them
+    ASSERT_EQ(received.Size(), u32(21));
+    for (u32 i = 0; i < 20; i++)
+    {
+        EXPECT_TRUE(received[i].success);
+        EXPECT_STREQ(received[i].filePath.CStr(), filePaths[i].CStr());
+        String expected = Format("content {}", i);
+        ASSERT_EQ(received[i].bytes.Size(), expected.Length());
+        EXPECT_EQ(memcmp(received[i].bytes.Data(), expected.CStr(), expected.Length()), 0);
+    }
+    EXPECT_FALSE(received[20].success);
+    EXPECT_EQ(received[20].bytes.Size(), u32(0));
+}
+
+TEST_F(IOQueueTest, SamePathKeepsSubmissionOrder)
+{
+    String filePath = FileSystem::CWD() + "/ordered.txt";
+
+    Array<i32> order;
+    IOQueue::WriteAsync(filePath, ToBytes("first"), [&](b8 success)
+                        { EXPECT_TRUE(success); order.Push(1); });
+    IOQueue::WriteAsync(filePath, ToBytes("second"), [&](b8 success)
+                        { EXPECT_TRUE(success); order.Push(2); });
+
+    String content;
+    IOQueue::ReadAsync(filePath, [&](FileReadResult &result)
+                       {
+                           ASSERT_TRUE(result.success);
+                           content = String(reinterpret_cast<const char *>(result.bytes.Data()), result.bytes.Size());
+                           order.Push(3); });
+
+    ASSERT_TRUE(IOQueue::WaitIdle(5000));
+    EXPECT_EQ(IOQueue::ProcessCompletions(), u32(3));
+
+    ASSERT_EQ(order.Size(), u32(3));
+    EXPECT_EQ(order[0], 1);
+    EXPECT_EQ(order[1], 2);
+    EXPECT_EQ(order[2], 3);
+    EXPECT_STREQ(content.CStr(), "second");
+    EXPECT_FALSE(FileSystem::PathExists(filePath + ".tmp"));
+}
+
+TEST_F(IOQueueTest, EmptyBatch)
+{
+    b8 called = FALSE;
+    IOQueue::ReadAsync(Array<String>(), [&](Array<FileReadResult> &results)
+                       { called = results.Size() == 0; });
+
+    EXPECT_TRUE(IOQueue::WaitIdle(5000));
+    EXPECT_EQ(IOQueue::ProcessCompletions(), u32(1));
+    EXPECT_TRUE(called);
+    EXPECT_EQ(IOQueue::GetPendingCount(), u32(0));
+}
@@ -201,4 +201,89 @@ TEST(JsonTest, AppendToArray)
 
     EXPECT_STREQ(json.ToString().CStr(),
                  Json(R"([1, 2, 3, 4, 5])").ToString().CStr());
-}
\ No newline at end of file
+}
+
+TEST(JsonTest, CopyFromMovedFrom)
+{
+    Json source(R"({"name": "robot"})");
+    Json moved(std::move(source));
+
+    Json copy(R"({"id": 1})");
+    copy = source;
+    Json constructed(source);
+
+    copy = moved;
+    EXPECT_STREQ(copy.Get<String>("name").CStr(), "robot");
+}
+
+TEST(JsonTest, CopyIsDeep)
+{
+    Json original(R"({"person": {"name": "John", "tags": [1, 2]}})");
+    Json copy = original;
+    copy.Ref().Child("person").Set<String>("name", "Jane");
+
+    EXPECT_STREQ(original.Ref().Child("person").Get<String>("name").CStr(), "John");
+    EXPECT_STREQ(copy.Ref().Child("person").Get<String>("name").CStr(), "Jane");
+
+    Json assigned;
+    assigned = original;
+    EXPECT_STREQ(assigned.ToString().CStr(), original.ToString().CStr());
+
+    Json moved;
+    moved = std::move(copy);
+    EXPECT_STREQ(moved.Ref().Child("person").Get<String>("name").CStr(), "Jane");
+}
+
+TEST(JsonTest, NestedAccessThroughRef)
+{
+    Json json(R"({"project": {"functions": [{"name": "A", "id": 1}, {"name": "B", "id": 2}]}})");
+    JsonConstRef functions = static_cast<const Json &>(json).Ref().Child("project").Child("functions");
+
+    ASSERT_TRUE(functions.IsArray());
+    EXPECT_EQ(functions.Size(), u32(2));
+    EXPECT_STREQ(functions.At(1).Get<String>("name").CStr(), "B");
+    EXPECT_EQ(functions.At(0).Get<u32>("id"), u32(1));
+    EXPECT_TRUE(functions.At(0).Contains("name"));
+
+    // missing nodes give an invalid view which returns the default values
+    JsonConstRef missing = json.Ref().Child("project").Child("variables").At(3);
+    EXPECT_FALSE(missing.IsValid());
+    EXPECT_EQ(missing.Get<i32>("id", -1), -1);
+    EXPECT_EQ(missing.Size(), u32(0));
+    EXPECT_TRUE(Json(missing).Empty());
+}
+
+TEST(JsonTest, ModifyNestedThroughRef)
+{
+    Json json(R"({"items": [{"value": 1}]})");
+    JsonRef items = json.Ref().Child("items");
+    items.At(0).Set<i32>("value", 5);
+
+    Json element;
+    element.Set<i32>("value", 6);
+    items.Append(element);
+
+    EXPECT_EQ(json.Ref().Child("items").At(0).Get<i32>("value"), 5);
+    EXPECT_EQ(json.Get<Json>("items").Get<Json>(1).Get<i32>("value"), 6);
+    EXPECT_EQ(json.Ref().Child("items").Size(), u32(2));
+}
+
+TEST(JsonTest, SetByKeyOnNonObjectIsIgnored)
+{
+    Json json(R"({"items": [1, 2], "name": "robot"})");
+    JsonRef items = json.Ref().Child("items");
+
+    EXPECT_NO_THROW(items.Set<i32>("value", 5));
+    EXPECT_NO_THROW(json.Ref().Child("name").Set<Json>("value", Json()));
+    EXPECT_EQ(items.Size(), u32(2));
+    EXPECT_STREQ(json.Get<String>("name").CStr(), "robot");
+}
+
+TEST(JsonTest, CompactToString)
+{
+    Json json(R"({"name": "robot", "joints": [1, 2], "base": {"fixed": true}})");
+
+    EXPECT_STREQ(json.ToString(JsonFormat::COMPACT).CStr(), R"({"base":{"fixed":true},"joints":[1,2],"name":"robot"})");
+    EXPECT_STREQ(json.Ref().Child("joints").ToString(JsonFormat::COMPACT).CStr(), "[1,2]");
+    EXPECT_STREQ(Json(json.ToString(JsonFormat::COMPACT)).ToString().CStr(), json.ToString().CStr());
+}
@@ -0,0 +1,155 @@
+#include "test_common.h"
+
+namespace
+{
+    struct SchemaItem
+    {
+        String label;
+        Array<i32> values;
+
+        static b8 Migrate(u32 fromVersion, Json &document)
+        {
+            switch (fromVersion)
+            {
+            case 0:
+                // version 1 added the values
+                document.Set<Json>("values", Json("[]"));
+                return TRUE;
+            case 1:
+                // version 2 renamed "name" into "label"
+                document.Set<String>("label", document.Get<String>("name"));
+                return TRUE;
+            default:
+                return FALSE;
+            }
+        }
+    };
+
+    const JsonSchemaField s_schemaItemFields[] = {
+        {"label", JsonValueType::STRING},
+        {"values", JsonValueType::ARRAY},
+    };
+} // namespace
+
+namespace rpp
+{
+    template <>
+    const JsonSchema &GetJsonSchema<SchemaItem>()
+    {
+        static const JsonSchema schema = {"SchemaItem", 2, s_schemaItemFields, 2, &SchemaItem::Migrate};
+        return schema;
+    }
+
+    template <>
+    b8 ReadJson<SchemaItem>(JsonReader &reader, SchemaItem &value)
+    {
+        if (reader.Next() != JsonToken::BEGIN_OBJECT)
+        {
+            reader.Skip();
+            return FALSE;
+        }
+
+        while (reader.Next() == JsonToken::KEY)
+        {
+            StringView key = reader.GetString();
+            if (key == "label")
+            {
+                reader.Read(value.label);
+            }
+            else if (key == "values")
+            {
+                reader.ReadArray(value.values);
+            }
+            else
+            {
+                reader.Skip();
+            }
+        }
+
+        return reader.GetToken() == JsonToken::END_OBJECT;
+    }
+} // namespace rpp
+
+TEST(JsonSchemaTest, PeekVersion)
+{
+    EXPECT_EQ(PeekJsonVersion(R"({"version": 3, "label": "a"})"), u32(3));
+    EXPECT_EQ(PeekJsonVersion(R"({"label": "a", "version": 3})"), u32(0)); // only the first key is looked at
+    EXPECT_EQ(PeekJsonVersion(R"({"version": "3"})"), u32(0));
+    EXPECT_EQ(PeekJsonVersion(R"([1, 2])"), u32(0));
+    EXPECT_EQ(PeekJsonVersion(""), u32(0));
+}
+
+TEST(JsonSchemaTest, Validate)
+{
+    const JsonSchema &schema = GetJsonSchema<SchemaItem>();
+    String error;
+
+    EXPECT_TRUE(ValidateJson(R"({"label": "a", "unknown": {"x": [1]}, "values": [1, 2]})", schema, error));
+
+    EXPECT_FALSE(ValidateJson(R"({"label": "a"})", schema, error));
+    EXPECT_STREQ(error.CStr(), "SchemaItem: the key \"values\" is missing");
+
+    EXPECT_FALSE(ValidateJson(R"({"label": 1, "values": []})", schema, error));
+    EXPECT_STREQ(error.CStr(), "SchemaItem: \"label\" must be a string");
+
+    EXPECT_FALSE(ValidateJson(R"({"label": "a", "values": []} [])", schema, error));
+    EXPECT_FALSE(ValidateJson(R"({"label": "a", "values": [})", schema, error));
+    EXPECT_FALSE(ValidateJson(R"([])", schema, error));
+}
+
+TEST(JsonSchemaTest, ReadCurrentVersion)
+{
+    SchemaItem item = {};
+    String error;
+
+    EXPECT_TRUE(ReadVersionedJson(R"({"version": 2, "label": "a", "values": [1, 2]})", item, error));
+    EXPECT_STREQ(item.label.CStr(), "a");
+    EXPECT_EQ(item.values.Size(), u32(2));
+
+    EXPECT_FALSE(ReadVersionedJson(R"({"version": 2, "label": "a"} {})", item, error));
+}
+
+TEST(JsonSchemaTest, MigrateOlderVersions)
+{
+    SchemaItem item = {};
+    String error;
+
+    // from version 0 (no version key), both migrations are applied in order
+    EXPECT_TRUE(ReadVersionedJson(R"({"name": "old"})", item, error)) << error.CStr();
+    EXPECT_STREQ(item.label.CStr(), "old");
+    EXPECT_EQ(item.values.Size(), u32(0));
+
+    // from version 1, only the rename is applied
+    item = {};
+    EXPECT_TRUE(ReadVersionedJson(R"({"version": 1, "name": "renamed", "values": [4]})", item, error)) << error.CStr();
+    EXPECT_STREQ(item.label.CStr(), "renamed");
+    ASSERT_EQ(item.values.Size(), u32(1));
+    EXPECT_EQ(item.values[0], 4);
+
+    String upgraded;
+    EXPECT_TRUE(UpgradeJson(R"({"version": 1, "name": "x", "values": []})", GetJsonSchema<SchemaItem>(), upgraded, error));
+    EXPECT_EQ(Json(upgraded).Get<u32>("version"), u32(2));
+}
+
+TEST(JsonSchemaTest, RejectUnreadableDocuments)
+{
+    SchemaItem item = {};
+    String error;
+
+    EXPECT_FALSE(ReadVersionedJson(R"({"version": 3, "label": "a", "values": []})", item, error));
+    EXPECT_STREQ(error.CStr(), "SchemaItem: version 3 is newer than the supported version 2");
+
+    EXPECT_FALSE(ReadVersionedJson(R"({"version": 1, "label": "a"})", item, error)); // still missing after migration
+    EXPECT_FALSE(ReadVersionedJson(R"({"name": )", item, error));
+    EXPECT_FALSE(ReadVersionedJson(R"("text")", item, error));
+
+    String upgraded;
+    const char *malformed[] = {R"({"version": 2, "label": "a", "values": [], "n": 01})",
+                               R"({"version": 2, "label": "a", "values": [], "n": 1.})"};
+    for (const char *document : malformed)
+    {
+        error = "";
+        EXPECT_FALSE(UpgradeJson(document, GetJsonSchema<SchemaItem>(), upgraded, error)) << document;
+        EXPECT_GT(error.Length(), u32(0)) << document;
+    }
+}
@@ -0,0 +1,396 @@
+#include "test_common.h"
+
+namespace
+{
+    struct StreamItem
+    {
+        String name;
+        i32 id;
+        f32 weight;
+        b8 enabled;
+        Array<String> tags;
+    };
+} // namespace
+
+namespace rpp
+{
+    template <>
+    void WriteJson<StreamItem>(JsonWriter &writer, const StreamItem &value)
+    {
+        writer.BeginObject();
+        writer.Key("name");
+        writer.Value(value.name);
+        writer.Key("id");
+        writer.Value(value.id);
+        writer.Key("weight");
+        writer.Value(value.weight);
+        writer.Key("enabled");
+        writer.Value(value.enabled);
+        writer.Key("tags");
+        writer.ValueArray(value.tags);
+        writer.EndObject();
+    }
+
+    template <>
+    b8 ReadJson<StreamItem>(JsonReader &reader, StreamItem &value)
+    {
+        if (reader.Next() != JsonToken::BEGIN_OBJECT)
+        {
+            reader.Skip();
+            return FALSE;
+        }
+
+        while (reader.Next() == JsonToken::KEY)
+        {
+            StringView key = reader.GetString();
+
+            switch (reader.GetKeyHash())
+            {
+            case JsonKeyHash("name"):
+                if (key == "name")
+                {
+                    reader.Read(value.name);
+                    continue;
+                }
+                break;
+            case JsonKeyHash("id"):
+                if (key == "id")
+                {
+                    reader.Read(value.id);
+                    continue;
+                }
+                break;
+            case JsonKeyHash("weight"):
+                if (key == "weight")
+                {
+                    reader.Read(value.weight);
+                    continue;
+                }
+                break;
+            case JsonKeyHash("enabled"):
+                if (key == "enabled")
+                {
+                    reader.Read(value.enabled);
+                    continue;
+                }
+                break;
+            case JsonKeyHash("tags"):
+                if (key == "tags")
+                {
+                    reader.ReadArray(value.tags);
+                    continue;
+                }
+                break;
+            default:
+                break;
+            }
+            reader.Skip();
+        }
+
+        return reader.GetToken() == JsonToken::END_OBJECT;
+    }
+} // namespace rpp
+
+class JsonStreamTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        rpp::FileSystem::Initialize("temp");
+    }
+
+    void TearDown() override
+    {
+        rpp::FileSystem::Shutdown();
+    }
+};
+
+TEST(JsonReaderTest, TokenSequence)
+{
+    JsonReader reader(R"( {"a": [1, -2.5e3, "x\n\"y\"", true, null], "b": {}} )");
+
+    EXPECT_EQ(reader.Next(), JsonToken::BEGIN_OBJECT);
+    EXPECT_EQ(reader.Next(), JsonToken::KEY);
+    EXPECT_TRUE(reader.GetString() == "a");
+    EXPECT_EQ(reader.Next(), JsonToken::BEGIN_ARRAY);
+    EXPECT_EQ(reader.GetDepth(), u32(2));
+
+    i32 integer = 0;
+    EXPECT_EQ(reader.Next(), JsonToken::NUMBER);
+    EXPECT_TRUE(reader.GetValue(integer));
+    EXPECT_EQ(integer, 1);
+
+    f64 number = 0.0;
+    EXPECT_EQ(reader.Next(), JsonToken::NUMBER);
+    EXPECT_TRUE(reader.GetValue(number));
+    EXPECT_DOUBLE_EQ(number, -2500.0);
+
+    String text;
+    EXPECT_EQ(reader.Next(), JsonToken::STRING);
+    EXPECT_TRUE(reader.GetValue(text));
+    EXPECT_STREQ(text.CStr(), "x\n\"y\"");
+
+    b8 flag = FALSE;
+    EXPECT_EQ(reader.Next(), JsonToken::BOOLEAN);
+    EXPECT_TRUE(reader.GetValue(flag));
+    EXPECT_TRUE(flag);
+
+    EXPECT_EQ(reader.Next(), JsonToken::NULL_VALUE);
+    EXPECT_EQ(reader.Next(), JsonToken::END_ARRAY);
+    EXPECT_EQ(reader.Next(), JsonToken::KEY);
+    EXPECT_EQ(reader.Next(), JsonToken::BEGIN_OBJECT);
+    EXPECT_EQ(reader.Next(), JsonToken::END_OBJECT);
+    EXPECT_EQ(reader.Next(), JsonToken::END_OBJECT);
+    EXPECT_EQ(reader.Next(), JsonToken::END);
+    EXPECT_EQ(reader.Next(), JsonToken::END);
+}
+
+TEST(JsonReaderTest, KeyHash)
+{
+    static_assert(JsonKeyHash("name") == JsonKeyHash("name!", 4), "the hash must only depend on the characters");
+    static_assert(JsonKeyHash("") == 2166136261u, "FNV-1a offset basis");
+
+    JsonReader reader(R"({"functionNames": 1})");
+    reader.Next();
+    EXPECT_EQ(reader.Next(), JsonToken::KEY);
+    EXPECT_EQ(reader.GetKeyHash(), JsonKeyHash("functionNames"));
+    EXPECT_NE(reader.GetKeyHash(), JsonKeyHash("functionName"));
+}
+
+TEST(JsonReaderTest, UnicodeEscapes)
+{
+    JsonReader reader(R"(["é中😀"])");
+    reader.Next();
+
+    String text;
+    EXPECT_TRUE(reader.Read(text));
+    EXPECT_STREQ(text.CStr(), "\xC3\xA9\xE4\xB8\xAD\xF0\x9F\x98\x80");
+}
+
+TEST(JsonReaderTest, NumberGrammar)
+{
+    JsonReader reader(R"([0, -0, 10, 0.5, 1E10, 2e-3, -1.25e+2])");
+    const f64 expected[] = {0.0, 0.0, 10.0, 0.5, 1e10, 2e-3, -125.0};
+
+    EXPECT_EQ(reader.Next(), JsonToken::BEGIN_ARRAY);
+    for (f64 value : expected)
+    {
+        f64 number = 1.0;
+        EXPECT_EQ(reader.Next(), JsonToken::NUMBER);
+        EXPECT_TRUE(reader.GetValue(number));
+        EXPECT_DOUBLE_EQ(number, value);
+    }
+    EXPECT_EQ(reader.Next(), JsonToken::END_ARRAY);
+    EXPECT_FALSE(reader.HasError());
+}
+
+TEST(JsonReaderTest, IntegerRange)
+{
+    JsonReader reader(R"([1e300, -1, 4294967296, 1.5, 1e3, 4294967295, 1e19])");
+    EXPECT_EQ(reader.Next(), JsonToken::BEGIN_ARRAY);
+
+    const b8 expected[] = {FALSE, FALSE, FALSE, FALSE, TRUE, TRUE};
+    for (b8 isValid : expected)
+    {
+        u32 value = 7;
+        EXPECT_EQ(reader.Next(), JsonToken::NUMBER);
+        EXPECT_EQ(reader.GetValue(value), isValid);
+        if (!isValid)
+        {
+            EXPECT_EQ(value, 7u);
+        }
+    }
+
+    i64 large = 0;
+    EXPECT_EQ(reader.Next(), JsonToken::NUMBER);
+    EXPECT_FALSE(reader.GetValue(large));
+    EXPECT_EQ(reader.Next(), JsonToken::END_ARRAY);
+}
+
+TEST(JsonReaderTest, InvalidInput)
+{
+    const char *documents[] = {R"({"a" 1})", R"([1, 2)", R"([1 2])", R"({"a": tru})", R"([1}])", R"({} {})", R"("abc)",
+                               R"({"n": 01})", R"({"n": 1.})", R"([.5])", R"([+1])", R"([-])", R"([1e])", R"([1.5e+])", R"([1-2])"};
+
+    for (const char *document : documents)
+    {
+        JsonReader reader(document);
+        while (reader.Next() != JsonToken::END && !reader.HasError())
+        {
+        }
+
+        EXPECT_TRUE(reader.HasError()) << document;
+        EXPECT_GT(reader.GetError().Length(), u32(0));
+    }
+}
+
+TEST(JsonReaderTest, SkipAndTypeMismatch)
+{
+    StreamItem item = {};
+    item.id = 7;
+
+    JsonReader reader(R"({"unknown": {"deep": [1, {"x": 2}]}, "id": "not a number", "name": "robot", "tags": ["a", 3, "b"]})");
+    EXPECT_TRUE(ReadJson(reader, item));
+
+    EXPECT_EQ(item.id, 7); // wrong type keeps the current value
+    EXPECT_STREQ(item.name.CStr(), "robot");
+    ASSERT_EQ(item.tags.Size(), u32(2));
+    EXPECT_STREQ(item.tags[1].CStr(), "b");
+    EXPECT_EQ(reader.Next(), JsonToken::END);
+}
+
+TEST(JsonWriterTest, CompactAndIndented)
+{
+    JsonWriter compact;
+    compact.BeginObject();
+    compact.Key("list");
+    compact.BeginArray();
+    compact.Value(1);
+    compact.Value(u64(18446744073709551615ull));
+    compact.Value(0.1f);
+    compact.Value("a\"b\\c\n");
+    compact.Null();
+    compact.EndArray();
+    compact.Key("empty");
+    compact.BeginObject();
+    compact.EndObject();
+    compact.EndObject();
+
+    EXPECT_STREQ(compact.Build().CStr(), R"({"list":[1,18446744073709551615,0.1,"a\"b\\c\n",null],"empty":{}})");
+
+    JsonWriter indented(JsonFormat::PRETTY);
+    indented.BeginObject();
+    indented.Key("a");
+    indented.BeginArray();
+    indented.Value(TRUE);
+    indented.EndArray();
+    indented.Key("b");
+    indented.BeginArray();
+    indented.EndArray();
+    indented.EndObject();
+
+    EXPECT_STREQ(indented.Build().CStr(), "{\n    \"a\": [\n        true\n    ],\n    \"b\": []\n}");
+}
+
+TEST(JsonWriterTest, MatchesJsonModule)
+{
+    StreamItem item = {"arm", 42, 1.5f, TRUE, {}};
+    item.tags.Push("x");
+    item.tags.Push("y");
+
+    JsonWriter writer(JsonFormat::PRETTY);
+    WriteJson(writer, item);
+    String written = writer.Build();
+
+    Json json(written);
+    EXPECT_STREQ(json.Get<String>("name").CStr(), "arm");
+    EXPECT_EQ(json.Get<i32>("id"), 42);
+    EXPECT_FLOAT_EQ(json.Get<f32>("weight"), 1.5f);
+    EXPECT_TRUE(json.Get<b8>("enabled"));
+    EXPECT_EQ(json.Get<Json>("tags").Size(), u32(2));
+}
+
+TEST(JsonWriterTest, CopyFromReader)
+{
+    const char *document = R"([{"a":[1,2.50,{"b":null}],"c":"d"},true,"e"])";
+
+    JsonReader reader(document);
+    JsonWriter writer;
+    reader.Next();
+    writer.Copy(reader);
+
+    EXPECT_STREQ(writer.Build().CStr(), document);
+    EXPECT_EQ(reader.Next(), JsonToken::END);
+}
+
+TEST_F(JsonStreamTest, RoundTripThroughFile)
+{
+    String filePath = FileSystem::CWD() + "/items.json";
+
+    // large enough to cross many chunk boundaries, including inside strings and numbers
+    Array<StreamItem> items;
+    for (i32 i = 0; i < 2000; i++)
+    {
+        StreamItem item = {Format("item with a long name \"{}\"", i), i * 1000, static_cast<f32>(i) / 8.0f, i % 2 == 0, {}};
+        item.tags.Push(Format("tag-{}", i));
+        items.Push(item);
+    }
+
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE);
+    {
+        JsonWriter writer(file, JsonFormat::PRETTY);
+        writer.BeginArray();
+        for (u32 i = 0; i < items.Size(); i++)
+        {
+            WriteJson(writer, items[i]);
+        }
+        writer.EndArray();
+        writer.Flush();
+    }
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(filePath, FILE_MODE_READ);
+    {
+        JsonReader reader(file);
+        ASSERT_EQ(reader.Next(), JsonToken::BEGIN_ARRAY);
+
+        for (u32 i = 0; i < items.Size(); i++)
+        {
+            StreamItem item = {};
+            ASSERT_TRUE(ReadJson(reader, item)) << reader.GetError().CStr();
+            EXPECT_STREQ(item.name.CStr(), items[i].name.CStr());
+            EXPECT_EQ(item.id, items[i].id);
+            EXPECT_EQ(item.weight, items[i].weight);
+            EXPECT_EQ(item.enabled, items[i].enabled);
+            ASSERT_EQ(item.tags.Size(), u32(1));
+            EXPECT_STREQ(item.tags[0].CStr(), items[i].tags[0].CStr());
+        }
+
+        EXPECT_EQ(reader.Next(), JsonToken::END_ARRAY);
+        EXPECT_EQ(reader.Next(), JsonToken::END);
+    }
+    FileSystem::CloseFile(file);
+}
+
+TEST_F(JsonStreamTest, JsonLinesAppend)
+{
+    String filePath = FileSystem::CWD() + "/results.jsonl";
+
+    // every record is appended through a new handle, like one test case per process
+    for (i32 i = 0; i < 3; i++)
+    {
+        FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_APPEND);
+        JsonLinesWriter writer(file);
+
+        JsonWriter &record = writer.BeginRecord();
+        record.BeginObject();
+        record.Key("name");
+        record.Value(Format("case\n{}", i));
+        record.Key("status");
+        record.Value(i != 1);
+        record.EndObject();
+        writer.EndRecord();
+
+        StreamItem item = {"item", i, 0.5f, TRUE, {}};
+        writer.Append(item);
+
+        FileSystem::CloseFile(file);
+    }
+
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_READ);
+    String content = FileSystem::Read(file);
+    FileSystem::CloseFile(file);
+
+    Array<String> lines;
+    content.Split(lines, "\n");
+    ASSERT_EQ(lines.Size(), u32(6));
+    for (u32 i = 0; i < lines.Size(); i += 2)
+    {
+        Json result(lines[i]);
+        EXPECT_STREQ(result.Get<String>("name").CStr(), Format("case\n{}", i / 2).CStr());
+        EXPECT_EQ(result.Get<b8>("status"), i != 2);
+
+        Json item(lines[i + 1]);
+        EXPECT_EQ(item.Get<i32>("id"), static_cast<i32>(i / 2));
+    }
+}
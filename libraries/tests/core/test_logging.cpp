@@ -0,0 +1,83 @@
+#include "test_common.h"
+
+namespace
+{
+    /**
+     * Keeps the last message, owned by the logging singleton so it is released by `SingletonManager::Shutdown`.
+     */
+    class CaptureHandler : public Handler
+    {
+    public:
+        String lastMessage;
+        u32 handledCount = 0;
+
+    protected:
+        void HandleImpl(const LogRecord &record) override
+        {
+            lastMessage = String(record.message.Data(), record.message.Length());
+            handledCount++;
+        }
+    };
+
+    /**
+     * Logs while it is formatted.
+     */
+    struct NestedLogger
+    {
+    };
+} // namespace
+
+namespace rpp
+{
+    template <>
+    const String ToString<NestedLogger>(const NestedLogger &value)
+    {
+        RPP_UNUSED(value);
+        Logging::GetInstance()->LogFormat(LogLevel::INFO, __FILE__, __LINE__, "inner {}", 1);
+        return "value";
+    }
+} // namespace rpp
+
+TEST(LoggingTest, LevelFilteringAndFormatting)
+{
+    SingletonManager::Initialize();
+
+    EXPECT_FALSE(Logging::IsEnabled(LogLevel::FATAL));
+
+    Scope<CaptureHandler> handler = CreateScope<CaptureHandler>();
+    CaptureHandler *pHandler = handler.get();
+    handler->SetLevel(LogLevel::WARNING);
+    Logging::GetInstance()->SetupHandler(std::move(handler));
+
+    EXPECT_FALSE(Logging::IsEnabled(LogLevel::INFO));
+    EXPECT_TRUE(Logging::IsEnabled(LogLevel::WARNING));
+    EXPECT_TRUE(Logging::IsEnabled(LogLevel::ERROR));
+
+    pHandler->SetLevel(LogLevel::TRACE);
+    EXPECT_TRUE(Logging::IsEnabled(LogLevel::TRACE));
+
+    // the singleton is only created once per process, so formatting is checked with the same handler
+    pHandler->SetLevel(LogLevel::INFO);
+    pHandler->handledCount = 0;
+    Logging::GetInstance()->LogFormat(LogLevel::INFO, __FILE__, __LINE__, "Value {} of {}", 1, String("{}"));
+    EXPECT_EQ(pHandler->lastMessage, "Value 1 of {}");
+
+    Logging::GetInstance()->LogFormat(LogLevel::DEBUG, __FILE__, __LINE__, "Filtered {}", 2);
+    EXPECT_EQ(pHandler->handledCount, 1u);
+
+    String longMessage;
+    for (u32 i = 0; i < RPP_LOG_BUFFER_SIZE; i++)
+    {
+        longMessage += "x";
+    }
+    Logging::GetInstance()->LogFormat(LogLevel::ERROR, __FILE__, __LINE__, "{}!", longMessage);
+    EXPECT_EQ(pHandler->lastMessage.Length(), RPP_LOG_BUFFER_SIZE + 1u);
+
+    // the nested call does not overwrite the message being formatted
+    pHandler->handledCount = 0;
+    Logging::GetInstance()->LogFormat(LogLevel::INFO, __FILE__, __LINE__, "outer {} {}", NestedLogger(), 2);
+    EXPECT_EQ(pHandler->lastMessage, "outer value 2");
+    EXPECT_EQ(pHandler->handledCount, 2u);
+
+    SingletonManager::Shutdown();
+}
@@ -0,0 +1,91 @@
+#include "test_common.h"
+
+namespace
+{
+    u32 HashU32(const void *key)
+    {
+        return *static_cast<const u32 *>(key) * 2654435761u;
+    }
+
+    u32 HashString(const void *key)
+    {
+        return Path::Hash(*static_cast<const String *>(key));
+    }
+} // namespace
+
+TEST(LRUCacheTest, GetAndPut)
+{
+    LRUCache<u32, i32, HashU32> cache(4);
+    EXPECT_EQ(cache.Capacity(), u32(4));
+    EXPECT_EQ(cache.Size(), u32(0));
+
+    i32 value = 0;
+    EXPECT_FALSE(cache.Get(1, value));
+
+    cache.Put(1, 10);
+    cache.Put(2, 20);
+    EXPECT_EQ(cache.Size(), u32(2));
+    EXPECT_TRUE(cache.Get(1, value));
+    EXPECT_EQ(value, 10);
+
+    cache.Put(1, 11); // replaced, not added
+    EXPECT_EQ(cache.Size(), u32(2));
+    EXPECT_TRUE(cache.Get(1, value));
+    EXPECT_EQ(value, 11);
+
+    EXPECT_THROW((LRUCache<u32, i32, HashU32>(0)), std::runtime_error);
+}
+
+TEST(LRUCacheTest, EvictLeastRecentlyUsed)
+{
+    LRUCache<u32, i32, HashU32> cache(3);
+    cache.Put(1, 10);
+    cache.Put(2, 20);
+    cache.Put(3, 30);
+
+    i32 value = 0;
+    EXPECT_TRUE(cache.Get(1, value)); // 2 becomes the least recently used
+
+    cache.Put(4, 40);
+    EXPECT_EQ(cache.Size(), u32(3));
+    EXPECT_FALSE(cache.Get(2, value));
+    EXPECT_TRUE(cache.Get(1, value));
+    EXPECT_TRUE(cache.Get(3, value));
+    EXPECT_TRUE(cache.Get(4, value));
+
+    // many more keys than buckets and entries
+    for (u32 i = 100; i < 1000; i++)
+    {
+        cache.Put(i, i32(i));
+    }
+    EXPECT_EQ(cache.Size(), u32(3));
+    EXPECT_TRUE(cache.Get(999, value));
+    EXPECT_EQ(value, 999);
+    EXPECT_TRUE(cache.Get(997, value));
+    EXPECT_FALSE(cache.Get(996, value));
+}
+
+TEST(LRUCacheTest, RemoveAndClear)
+{
+    LRUCache<String, String, HashString> cache(2);
+    cache.Put("a", "1");
+    cache.Put("b", "2");
+
+    EXPECT_TRUE(cache.Remove("a"));
+    EXPECT_FALSE(cache.Remove("a"));
+    EXPECT_EQ(cache.Size(), u32(1));
+
+    // the freed entry is reused before anything is evicted
+    cache.Put("c", "3");
+    String value;
+    EXPECT_TRUE(cache.Get("b", value));
+    EXPECT_STREQ(value.CStr(), "2");
+
+    cache.Clear();
+    EXPECT_EQ(cache.Size(), u32(0));
+    EXPECT_FALSE(cache.Get("b", value));
+
+    cache.Put("d", "4");
+    EXPECT_TRUE(cache.Get("d", value));
+    EXPECT_STREQ(value.CStr(), "4");
+}
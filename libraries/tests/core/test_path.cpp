@@ -0,0 +1,55 @@
+#include "test_common.h"
+
+TEST(PathTest, Normalize)
+{
+    EXPECT_STREQ(Path("assets\\textures/./robot.png").CStr(), "assets/textures/robot.png");
+    EXPECT_STREQ(Path("assets//textures/").CStr(), "assets/textures");
+    EXPECT_STREQ(Path("assets/textures/../functions/move.py").CStr(), "assets/functions/move.py");
+    EXPECT_STREQ(Path("../shared/./a/..").CStr(), "../shared");
+    EXPECT_STREQ(Path("a/../..").CStr(), "..");
+    EXPECT_STREQ(Path("/../root//a").CStr(), "/root/a");
+    EXPECT_STREQ(Path("C:\\Work\\..\\project").CStr(), "C:/project");
+    EXPECT_STREQ(Path("./").CStr(), ".");
+    EXPECT_STREQ(Path("/").CStr(), "/");
+    EXPECT_STREQ(Path("").CStr(), "");
+}
+
+TEST(PathTest, CompareAndHash)
+{
+    Path a("project/assets/../robot.json");
+    Path b(String("project\\robot.json"));
+
+    EXPECT_EQ(a, b);
+    EXPECT_EQ(a.GetHash(), b.GetHash());
+    EXPECT_EQ(a.GetHash(), Path::Hash("project/robot.json"));
+    EXPECT_NE(a, Path("project/robot.jsonx"));
+}
+
+TEST(PathTest, Parts)
+{
+    Path path("assets/textures/robot.png");
+    EXPECT_TRUE(path.GetFileName() == "robot.png");
+    EXPECT_TRUE(path.GetExtension() == ".png");
+    EXPECT_STREQ(path.GetParent().CStr(), "assets/textures");
+    EXPECT_STREQ(path.GetParent().GetParent().GetParent().CStr(), "");
+    EXPECT_FALSE(path.IsAbsolute());
+
+    EXPECT_TRUE(Path("assets/.gitignore").GetExtension().Empty());
+    EXPECT_TRUE(Path("archive.tar.gz").GetExtension() == ".gz");
+    EXPECT_TRUE(Path("..").GetExtension().Empty());
+
+    EXPECT_STREQ(Path("/home").GetParent().CStr(), "/");
+    EXPECT_STREQ(Path("/").GetParent().CStr(), "/");
+    EXPECT_STREQ(Path("C:/Work").GetParent().CStr(), "C:/");
+    EXPECT_TRUE(Path("/").GetFileName().Empty());
+    EXPECT_TRUE(Path("C:/Work").IsAbsolute());
+    EXPECT_TRUE(Path("/home").IsAbsolute());
+}
+
+TEST(PathTest, Join)
+{
+    Path root("project/assets");
+    EXPECT_STREQ(root.Join("textures/robot.png").CStr(), "project/assets/textures/robot.png");
+    EXPECT_STREQ((root / "../functions").CStr(), "project/functions");
+    EXPECT_STREQ(Path().Join("a\\b").CStr(), "a/b");
+}
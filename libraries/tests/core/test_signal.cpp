@@ -62,4 +62,13 @@ TEST_F(SignalTest, CoroutineUsage)
     EXPECT_EQ(sortedElements[0], 3);
     EXPECT_EQ(sortedElements[1], 4);
     EXPECT_EQ(sortedElements[2], 5);
-}
\ No newline at end of file
+}
+
+TEST_F(SignalTest, WaitTimeout)
+{
+    SignalId signal = Signal::Create();
+
+    EXPECT_FALSE(Signal::Wait(signal, 10)); // nobody notifies, must give up instead of waiting forever
+
+    Signal::Destroy(signal);
+}
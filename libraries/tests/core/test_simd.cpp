@@ -0,0 +1,86 @@
+#include "test_common.h"
+
+/**
+ * Every test runs the kernels with each instruction set supported by the current CPU.
+ */
+class SimdTest : public ::testing::TestWithParam<SimdLevel>
+{
+protected:
+    void SetUp() override
+    {
+        if (GetParam() > Simd::GetSupportedLevel())
+        {
+            GTEST_SKIP() << "Instruction set is not supported by this CPU";
+        }
+
+        Simd::SetLevel(GetParam());
+    }
+
+    void TearDown() override
+    {
+        Simd::SetLevel(Simd::GetSupportedLevel());
+    }
+};
+
+TEST_P(SimdTest, FindChar)
+{
+    char data[100];
+    memset(data, 'a', sizeof(data));
+
+    EXPECT_EQ(Simd::FindChar(data, sizeof(data), '\n'), nullptr);
+
+    for (u32 position = 0; position < sizeof(data); position++)
+    {
+        data[position] = '\n';
+        EXPECT_EQ(Simd::FindChar(data, sizeof(data), '\n'), data + position);
+        data[position] = 'a';
+    }
+}
+
+TEST_P(SimdTest, Find)
+{
+    String haystack;
+    for (u32 i = 0; i < 10; i++)
+    {
+        haystack += "abcabdabeab";
+    }
+    haystack += "needle";
+
+    EXPECT_EQ(Simd::Find(haystack.CStr(), haystack.Length(), "needle", 6), 110);
+    EXPECT_EQ(Simd::Find(haystack.CStr(), haystack.Length(), "abe", 3), 6);
+    EXPECT_EQ(Simd::Find(haystack.CStr(), haystack.Length(), "abf", 3), -1);
+    EXPECT_EQ(Simd::Find(haystack.CStr(), haystack.Length(), "", 0), 0);
+    EXPECT_EQ(Simd::Find("ab", 2, "abc", 3), -1);
+    EXPECT_EQ(Simd::Find(haystack.CStr(), haystack.Length(), haystack.CStr(), haystack.Length()), 0);
+
+    // the match is at every possible offset of the vector blocks
+    for (u32 position = 0; position < 70; position++)
+    {
+        String text;
+        for (u32 i = 0; i < position; i++)
+        {
+            text += "x";
+        }
+        text += "xyz";
+        for (u32 i = 0; i < 40; i++)
+        {
+            text += "x";
+        }
+
+        EXPECT_EQ(Simd::Find(text.CStr(), text.Length(), "xyz", 3), static_cast<i32>(position));
+    }
+}
+
+TEST_P(SimdTest, ChangeCase)
+{
+    String source = "Hello, World! [ABCXYZ] @`{abcxyz} 0123456789 \x80\xC1\xDA\xFF - The Quick Brown Fox";
+    char buffer[128];
+
+    Simd::ToLower(buffer, source.CStr(), source.Length());
+    EXPECT_EQ(StringView(buffer, source.Length()), "hello, world! [abcxyz] @`{abcxyz} 0123456789 \x80\xC1\xDA\xFF - the quick brown fox");
+
+    Simd::ToUpper(buffer, source.CStr(), source.Length());
+    EXPECT_EQ(StringView(buffer, source.Length()), "HELLO, WORLD! [ABCXYZ] @`{ABCXYZ} 0123456789 \x80\xC1\xDA\xFF - THE QUICK BROWN FOX");
+}
+
+INSTANTIATE_TEST_SUITE_P(AllLevels, SimdTest, ::testing::Values(SimdLevel::SCALAR, SimdLevel::SSE2, SimdLevel::AVX2));
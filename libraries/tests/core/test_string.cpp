@@ -150,4 +150,121 @@ TEST(StringTest, Join)
     parts.Push(String("cherry"));
     String joined = String::Join(parts, ", ");
     EXPECT_STREQ(joined.CStr(), "apple, banana, cherry");
-}
\ No newline at end of file
+}
+
+TEST(StringTest, ShortStringIsStoredInline)
+{
+    String str("short");
+    EXPECT_EQ(str.Capacity(), RPP_STRING_SSO_CAPACITY);
+    EXPECT_EQ(str.Length(), 5);
+    EXPECT_STREQ(str.CStr(), "short");
+}
+
+TEST(StringTest, LongStringGrowsCapacity)
+{
+    String str("This string is definitely longer than the inline buffer");
+    EXPECT_EQ(str.Length(), 55);
+    EXPECT_GE(str.Capacity(), str.Length());
+    EXPECT_STREQ(str.CStr(), "This string is definitely longer than the inline buffer");
+}
+
+TEST(StringTest, ConstructorWithLength)
+{
+    String str("Hello, World!", 5);
+    EXPECT_EQ(str.Length(), 5);
+    EXPECT_STREQ(str.CStr(), "Hello");
+}
+
+TEST(StringTest, MoveConstructor)
+{
+    String shortStr("short");
+    String longStr("This string is definitely longer than the inline buffer");
+
+    String movedShort(std::move(shortStr));
+    String movedLong(std::move(longStr));
+
+    EXPECT_STREQ(movedShort.CStr(), "short");
+    EXPECT_STREQ(movedLong.CStr(), "This string is definitely longer than the inline buffer");
+    EXPECT_EQ(shortStr.Length(), 0);
+    EXPECT_EQ(longStr.Length(), 0);
+    EXPECT_STREQ(longStr.CStr(), "");
+}
+
+TEST(StringTest, MoveAssignment)
+{
+    String str("This string is definitely longer than the inline buffer");
+    String other;
+    other = std::move(str);
+
+    EXPECT_STREQ(other.CStr(), "This string is definitely longer than the inline buffer");
+    EXPECT_EQ(str.Length(), 0);
+}
+
+TEST(StringTest, EqualityComparesLength)
+{
+    EXPECT_TRUE(String("abc") == String("abc"));
+    EXPECT_FALSE(String("abc") == String("abcd"));
+    EXPECT_FALSE(String("abcd") == String("abc"));
+}
+
+TEST(StringTest, AppendGrowsGeometrically)
+{
+    String str;
+    u32 reallocations = 0;
+    u32 lastCapacity = str.Capacity();
+
+    for (u32 i = 0; i < 1000; i++)
+    {
+        str += "a";
+        if (str.Capacity() != lastCapacity)
+        {
+            reallocations++;
+            lastCapacity = str.Capacity();
+        }
+    }
+
+    EXPECT_EQ(str.Length(), 1000u);
+    EXPECT_LT(reallocations, 10u);
+}
+
+TEST(StringTest, AppendSelf)
+{
+    String str = "abcdefghijklmnopqrstuvwxyz";
+    str += str;
+    EXPECT_EQ(str, "abcdefghijklmnopqrstuvwxyzabcdefghijklmnopqrstuvwxyz");
+
+    String shortStr = "ab";
+    shortStr += shortStr;
+    EXPECT_EQ(shortStr, "abab");
+}
+
+TEST(StringTest, AssignFromPartOfSelf)
+{
+    String str = "the first part is long enough for the heap";
+    str = String(str.CStr() + 4, 10);
+    EXPECT_EQ(str, "first part");
+
+    String shortStr = "abc";
+    shortStr = shortStr.SubString(1);
+    EXPECT_EQ(shortStr, "bc");
+
+    String grown = "0123456789";
+    grown = grown + grown.CStr() + grown.CStr() + grown.CStr();
+    EXPECT_EQ(grown.Length(), 40u);
+    EXPECT_EQ(grown.SubString(30), "0123456789");
+}
+
+TEST(StringTest, ReserveKeepsContent)
+{
+    String str = "hello";
+    str.Reserve(100);
+    EXPECT_GE(str.Capacity(), 100u);
+    EXPECT_EQ(str, "hello");
+}
+
+TEST(StringTest, ToUpperCase)
+{
+    String str = "Hello, World!";
+    EXPECT_STREQ(str.ToUpperCase().CStr(), "HELLO, WORLD!");
+    EXPECT_STREQ(str.CStr(), "Hello, World!");
+}
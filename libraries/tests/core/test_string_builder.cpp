@@ -0,0 +1,65 @@
+#include "test_common.h"
+
+TEST(StringBuilderTest, AppendPieces)
+{
+    StringBuilder builder;
+    builder.Append("Hello").Append(',').Append(' ').Append(String("World"));
+
+    EXPECT_EQ(builder.Length(), 12u);
+    EXPECT_EQ(builder.View(), "Hello, World");
+}
+
+TEST(StringBuilderTest, AppendFormat)
+{
+    StringBuilder builder;
+    builder.Append("Values: ");
+    builder.AppendFormat("{} and {}", 1, 2);
+
+    EXPECT_EQ(builder.Build(), "Values: 1 and 2");
+
+    // longer than the inline capacity, the buffer grows in the middle of the append
+    builder.Append("Long: ");
+    builder.AppendFormat("{:>30}|{}", "right aligned", 3.5);
+    EXPECT_EQ(builder.Build(), "Long:                  right aligned|3.5");
+}
+
+TEST(StringBuilderTest, BuildResetsBuilder)
+{
+    StringBuilder builder;
+    builder.Reserve(128);
+    builder.Append("The first sentence is long enough to be on the heap.");
+
+    String result = builder.Build();
+    EXPECT_EQ(result, "The first sentence is long enough to be on the heap.");
+    EXPECT_EQ(builder.Length(), 0u);
+
+    builder.Append("Second");
+    EXPECT_EQ(builder.Build(), "Second");
+}
+
+TEST(StringBuilderTest, Clear)
+{
+    StringBuilder builder;
+    builder.Reserve(256);
+    builder.Append("Some content");
+    builder.Clear();
+
+    EXPECT_EQ(builder.Length(), 0u);
+    EXPECT_EQ(builder.Capacity(), String().Capacity());
+    EXPECT_EQ(builder.Build(), "");
+}
+
+TEST(StringBuilderTest, ResetKeepsBuffer)
+{
+    StringBuilder builder;
+    builder.Reserve(256);
+    builder.Append("Some content");
+    builder.Reset();
+
+    EXPECT_EQ(builder.Length(), 0u);
+    EXPECT_GE(builder.Capacity(), 256u);
+    EXPECT_EQ(builder.View(), "");
+
+    builder.Append("Next");
+    EXPECT_EQ(builder.Build(), "Next");
+}
@@ -0,0 +1,137 @@
+#include "test_common.h"
+#include <chrono>
+#include <cstdio>
+
+TEST(StringPoolTest, SameStringSameId)
+{
+    StringId first = StringPool::Intern("uTranslate");
+    StringId second = StringPool::Intern(String("uTranslate"));
+    StringId other = StringPool::Intern("uScale");
+
+    EXPECT_TRUE(first.IsValid());
+    EXPECT_EQ(first, second);
+    EXPECT_NE(first, other);
+    EXPECT_EQ(first.hash, second.hash);
+}
+
+TEST(StringPoolTest, Resolve)
+{
+    StringId id = StringPool::Intern(StringView("uTextureSampler", 8));
+
+    EXPECT_EQ(StringPool::Resolve(id), "uTexture");
+    EXPECT_STREQ(StringPool::Resolve(id).Data(), "uTexture");
+    EXPECT_EQ(StringPool::Resolve(INVALID_STRING_ID).Length(), 0u);
+}
+
+TEST(StringPoolTest, FindDoesNotInsert)
+{
+    u32 count = StringPool::Count();
+
+    EXPECT_FALSE(StringPool::Find("StringPoolTest.NeverInterned").IsValid());
+    EXPECT_EQ(StringPool::Count(), count);
+
+    StringId id = StringPool::Intern("StringPoolTest.Interned");
+    EXPECT_EQ(StringPool::Find("StringPoolTest.Interned"), id);
+    EXPECT_EQ(StringPool::Count(), count + 1);
+}
+
+TEST(StringPoolTest, ManyStrings)
+{
+    Array<StringId> ids;
+    for (u32 i = 0; i < 5000; i++)
+    {
+        ids.Push(StringPool::Intern(Format("StringPoolTest.Name{}", i)));
+    }
+
+    for (u32 i = 0; i < 5000; i++)
+    {
+        EXPECT_EQ(StringPool::Intern(Format("StringPoolTest.Name{}", i)), ids[i]);
+        EXPECT_EQ(StringPool::Resolve(ids[i]), Format("StringPoolTest.Name{}", i));
+    }
+}
+
+namespace
+{
+    struct InternThreadParam
+    {
+        u32 offset;
+        StringId *pOutIds;
+    };
+
+    void InternFromThread(void *param)
+    {
+        InternThreadParam *pParam = static_cast<InternThreadParam *>(param);
+        for (u32 i = 0; i < 200; i++)
+        {
+            pParam->pOutIds[i] = StringPool::Intern(Format("StringPoolTest.Shared{}", (i + pParam->offset) % 200));
+        }
+    }
+} // namespace
+
+TEST(StringPoolTest, ConcurrentIntern)
+{
+    Thread::Initialize();
+
+    StringId results[4][200];
+    Array<ThreadId> threads;
+
+    for (u32 i = 0; i < 4; i++)
+    {
+        InternThreadParam param = {i * 50, results[i]};
+        threads.Push(Thread::Create(InternFromThread, &param, sizeof(InternThreadParam)));
+    }
+
+    for (u32 i = 0; i < threads.Size(); i++)
+    {
+        Thread::Start(threads[i]);
+    }
+
+    for (u32 i = 0; i < threads.Size(); i++)
+    {
+        Thread::Join(threads[i]);
+        Thread::Destroy(threads[i]);
+    }
+
+    Thread::Shutdown();
+
+    for (u32 name = 0; name < 200; name++)
+    {
+        StringId expected = StringPool::Find(Format("StringPoolTest.Shared{}", name));
+        ASSERT_TRUE(expected.IsValid());
+
+        for (u32 thread = 0; thread < 4; thread++)
+        {
+            EXPECT_EQ(results[thread][(name + 200 - thread * 50) % 200], expected);
+        }
+    }
+}
+
+// run on demand with --gtest_also_run_disabled_tests
+TEST(StringPoolTest, DISABLED_LookupBenchmark)
+{
+    const u32 namesCount = 256;
+    const u32 iterations = 200000;
+
+    Array<String> names;
+    for (u32 i = 0; i < namesCount; i++)
+    {
+        names.Push(Format("uBenchmarkUniform{}", i));
+        StringPool::Intern(names[i]);
+    }
+
+    u32 checksum = 0;
+    std::chrono::steady_clock::time_point start = std::chrono::steady_clock::now();
+
+    for (u32 i = 0; i < iterations; i++)
+    {
+        checksum += StringPool::Intern(names[i % namesCount]).index;
+    }
+
+    std::chrono::duration<f64> elapsed = std::chrono::steady_clock::now() - start;
+    f64 lookupsPerSecond = iterations / (elapsed.count() > 0.0 ? elapsed.count() : 1e-9);
+
+    std::printf("[ BENCHMARK] StringPool::Intern (existing): %.0f lookups/s\n", lookupsPerSecond);
+    RecordProperty("LookupsPerSecond", static_cast<i32>(lookupsPerSecond > 2e9 ? 2e9 : lookupsPerSecond));
+
+    EXPECT_GT(checksum, 0u);
+}
@@ -0,0 +1,82 @@
+#include "test_common.h"
+
+TEST(StringViewTest, DefaultConstructor)
+{
+    StringView view;
+    EXPECT_EQ(view.Length(), 0);
+    EXPECT_TRUE(view.Empty());
+}
+
+TEST(StringViewTest, ConstructorFromCStr)
+{
+    StringView view("Hello, World!");
+    EXPECT_EQ(view.Length(), 13);
+    EXPECT_EQ(view[7], 'W');
+    EXPECT_THROW(view[13], std::out_of_range);
+}
+
+TEST(StringViewTest, ViewOfString)
+{
+    String str("Hello, World!");
+    StringView view = str;
+    EXPECT_EQ(view.Data(), str.CStr());
+    EXPECT_EQ(view.Length(), str.Length());
+}
+
+TEST(StringViewTest, Equality)
+{
+    StringView view("Hello, World!", 5);
+    EXPECT_TRUE(view == "Hello");
+    EXPECT_FALSE(view == "Hello, World!");
+    EXPECT_TRUE(String("Hello") == view);
+}
+
+TEST(StringViewTest, FindSubstring)
+{
+    StringView view("Find the substring in this string. Find it well.");
+    EXPECT_EQ(view.Find("Find"), 0);
+    EXPECT_EQ(view.Find("substring"), 9);
+    EXPECT_EQ(view.Find("notfound"), -1);
+    EXPECT_EQ(view.Find("Find", 1), 35);
+    EXPECT_EQ(view.Find("Find", 40), -1);
+    EXPECT_EQ(view.Find('s'), 9);
+}
+
+TEST(StringViewTest, FindDoesNotReadPastTheView)
+{
+    StringView view("abcdef", 3);
+    EXPECT_EQ(view.Find("cd"), -1);
+    EXPECT_EQ(view.Find('d'), -1);
+}
+
+TEST(StringViewTest, SubView)
+{
+    StringView view("Substring Example");
+    EXPECT_TRUE(view.SubView(0, 9) == "Substring");
+    EXPECT_TRUE(view.SubView(10) == "Example");
+    EXPECT_TRUE(view.SubView(5, 50) == "ring Example");
+    EXPECT_TRUE(view.SubView(50).Empty());
+}
+
+TEST(StringViewTest, StartsAndEndsWith)
+{
+    StringView view("filename.txt");
+    EXPECT_TRUE(view.StartsWith("file"));
+    EXPECT_FALSE(view.StartsWith("name"));
+    EXPECT_TRUE(view.EndsWith(".txt"));
+    EXPECT_FALSE(view.EndsWith(".jpg"));
+}
+
+TEST(StringViewTest, Split)
+{
+    String str("one,two,,three,");
+    Array<StringView> parts;
+    str.Split(parts, ",");
+    ASSERT_EQ(parts.Size(), 5);
+    EXPECT_TRUE(parts[0] == "one");
+    EXPECT_TRUE(parts[1] == "two");
+    EXPECT_TRUE(parts[2] == "");
+    EXPECT_TRUE(parts[3] == "three");
+    EXPECT_TRUE(parts[4] == "");
+    EXPECT_EQ(parts[0].Data(), str.CStr());
+}
@@ -5,5 +5,233 @@ TEST(ProjectTest, ConvertToString)
     ProjectDescription desc;
     desc.name = "TestProject";
 
-    EXPECT_STREQ(ToString(desc).CStr(), Json(R"({"name": "TestProject", "functionNames": []})").ToString().CStr());
-}
\ No newline at end of file
+    // the streaming writer keeps the declaration order of the fields, after the version
+    EXPECT_STREQ(ToString(desc).CStr(), "{\n    \"version\": 1,\n    \"name\": \"TestProject\",\n    \"functionNames\": []\n}");
+    EXPECT_STREQ(Json(ToString(desc)).ToString().CStr(), Json(R"({"version": 1, "name": "TestProject", "functionNames": []})").ToString().CStr());
+}
+
+class ProjectSaveTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        rpp::FileSystem::Initialize("temp");
+    }
+
+    void TearDown() override
+    {
+        rpp::FileSystem::Shutdown();
+    }
+};
+
+TEST_F(ProjectSaveTest, SaveChangesMatchesSave)
+{
+    String filePath = FileSystem::CWD() + "/project.rppproj";
+    String fullFilePath = FileSystem::CWD() + "/full.rppproj";
+
+    ProjectDescription desc;
+    desc.name = "Robot";
+    desc.functionNames.Push("Move");
+    Project *pProject = Project::Create(desc);
+
+    EXPECT_TRUE(pProject->SaveChanges(filePath));
+    EXPECT_FALSE(pProject->IsDirty());
+    EXPECT_FALSE(FileSystem::PathExists(filePath + ".tmp"));
+
+    pProject->AddNewFunction("Turn");
+    EXPECT_TRUE(pProject->IsDirty());
+    EXPECT_TRUE(pProject->SaveChanges(filePath));
+    pProject->Save(fullFilePath);
+
+    FileHandle file = FileSystem::OpenFile(filePath);
+    String content = FileSystem::Read(file);
+    FileSystem::CloseFile(file);
+
+    file = FileSystem::OpenFile(fullFilePath);
+    String fullContent = FileSystem::Read(file);
+    FileSystem::CloseFile(file);
+
+    EXPECT_STREQ(content.CStr(), fullContent.CStr());
+
+    Project *pLoaded = Project::Create(filePath);
+    ASSERT_EQ(pLoaded->GetFunctionNames().Size(), u32(2));
+    EXPECT_STREQ(pLoaded->GetFunctionNames()[1].CStr(), "Turn");
+
+    RPP_DELETE(pLoaded);
+    RPP_DELETE(pProject);
+}
+
+TEST_F(ProjectSaveTest, SkipsCleanProject)
+{
+    String filePath = FileSystem::CWD() + "/project.rppproj";
+
+    Project *pProject = Project::Create();
+    EXPECT_TRUE(pProject->SaveChanges(filePath));
+    EXPECT_FALSE(pProject->SaveChanges(filePath));
+
+    // only the modified section is encoded again, the name keeps its cached text
+    pProject->GetFunctionNames().Push("Edited");
+    pProject->MarkDirty(ProjectSection::FUNCTIONS);
+    EXPECT_TRUE(pProject->SaveChanges(filePath));
+
+    Project *pLoaded = Project::Create(filePath);
+    pLoaded->MarkClean(filePath);
+    EXPECT_FALSE(pLoaded->SaveChanges(filePath));
+    EXPECT_STREQ(pLoaded->GetName().CStr(), "UnnamedProject");
+    ASSERT_EQ(pLoaded->GetFunctionNames().Size(), u32(1));
+
+    RPP_DELETE(pLoaded);
+    RPP_DELETE(pProject);
+}
+
+TEST_F(ProjectSaveTest, MigratesUnversionedFile)
+{
+    String filePath = FileSystem::CWD() + "/old.rppproj";
+
+    // written before the format was versioned, without the function list
+    FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE);
+    FileSystem::Write(file, R"({"name": "Old"})");
+    FileSystem::CloseFile(file);
+
+    ProjectDescription desc = {};
+    ASSERT_TRUE(Project::LoadDescription(filePath, desc));
+    EXPECT_STREQ(desc.name.CStr(), "Old");
+    EXPECT_EQ(desc.functionNames.Size(), u32(0));
+
+    // saved again with the current version, which is read on the fast path
+    Project *pProject = Project::Create(desc);
+    pProject->Save(filePath);
+    RPP_DELETE(pProject);
+
+    file = FileSystem::OpenFile(filePath);
+    String content = FileSystem::Read(file);
+    FileSystem::CloseFile(file);
+    EXPECT_EQ(PeekJsonVersion(content), GetJsonSchema<ProjectDescription>().version);
+}
+
+TEST_F(ProjectSaveTest, RejectsInvalidFile)
+{
+    String filePath = FileSystem::CWD() + "/invalid.rppproj";
+    const char *documents[] = {
+        R"({"name": ["not", "a", "string"]})",               // wrong type
+        R"({"functionNames": []})",                          // missing key
+        R"({"version": 99, "name": "", "functionNames": []})", // newer version
+        R"({"name": "", "functionNames": [})",               // invalid JSON
+    };
+
+    for (const char *document : documents)
+    {
+        FileHandle file = FileSystem::OpenFile(filePath, FILE_MODE_WRITE);
+        FileSystem::Write(file, document);
+        FileSystem::CloseFile(file);
+
+        ProjectDescription desc = {};
+        EXPECT_FALSE(Project::LoadDescription(filePath, desc)) << document;
+    }
+}
+
+TEST_F(ProjectSaveTest, SaveIntoMemoryMount)
+{
+    String mountPoint = FileSystem::CWD() + "/memory";
+    ASSERT_TRUE(FileSystem::MountMemory(mountPoint));
+    String filePath = mountPoint + "/project.rppproj";
+    String binaryFilePath = mountPoint + "/project.rppbin";
+
+    ProjectDescription desc;
+    desc.name = "Robot";
+    desc.functionNames.Push("Move");
+    Project *pProject = Project::Create(desc);
+
+    EXPECT_TRUE(pProject->SaveChanges(filePath));
+    EXPECT_FALSE(FileSystem::PathExists(filePath + ".tmp"));
+    pProject->AddNewFunction("Turn");
+    EXPECT_TRUE(pProject->Save(filePath));
+    EXPECT_TRUE(pProject->SaveBinary(binaryFilePath));
+
+    for (const String &path : {filePath, binaryFilePath})
+    {
+        ProjectDescription loaded = {};
+        ASSERT_TRUE(Project::LoadDescription(path, loaded));
+        EXPECT_STREQ(loaded.name.CStr(), "Robot");
+        ASSERT_EQ(loaded.functionNames.Size(), u32(2));
+        EXPECT_STREQ(loaded.functionNames[1].CStr(), "Turn");
+    }
+
+    RPP_DELETE(pProject);
+    ASSERT_TRUE(FileSystem::Unmount(mountPoint));
+}
+
+class ProjectAsyncTest : public ::testing::Test
+{
+protected:
+    void SetUp() override
+    {
+        rpp::FileSystem::Initialize("temp");
+        rpp::Thread::Initialize();
+        rpp::Signal::Initialize();
+        rpp::Async::Initialize();
+    }
+
+    void TearDown() override
+    {
+        rpp::Async::Shutdown();
+        rpp::Signal::Shutdown();
+        rpp::Thread::Shutdown();
+        rpp::FileSystem::Shutdown();
+    }
+};
+
+TEST_F(ProjectAsyncTest, SaveThenCreate)
+{
+    String filePath = FileSystem::CWD() + "/async.rppproj";
+
+    ProjectDescription desc;
+    desc.name = "Robot";
+    desc.functionNames.Push("Move");
+    Project *pProject = Project::Create(desc);
+
+    b8 saved = FALSE;
+    pProject->SaveAsync(filePath, [&](b8 success)
+                        { saved = success; });
+
+    // the save works on a snapshot, later changes are not written
+    pProject->AddNewFunction("Turn");
+
+    Project *pLoaded = nullptr;
+    b8 loadCalled = FALSE;
+    Project::CreateAsync(filePath, [&](Project *pResult)
+                         {
+                             loadCalled = TRUE;
+                             pLoaded = pResult; });
+
+    ASSERT_TRUE(Async::WaitIdle(5000));
+    EXPECT_FALSE(loadCalled); // the callbacks wait for the main loop
+    EXPECT_EQ(Async::ProcessCompletions(), u32(2));
+
+    EXPECT_TRUE(saved);
+    EXPECT_FALSE(FileSystem::PathExists(filePath + ".tmp"));
+    ASSERT_TRUE(loadCalled);
+    ASSERT_NE(pLoaded, nullptr);
+    EXPECT_STREQ(pLoaded->GetName().CStr(), "Robot");
+    ASSERT_EQ(pLoaded->GetFunctionNames().Size(), u32(1));
+    EXPECT_STREQ(pLoaded->GetFunctionNames()[0].CStr(), "Move");
+
+    RPP_DELETE(pLoaded);
+    RPP_DELETE(pProject);
+}
+
+TEST_F(ProjectAsyncTest, CreateMissingFile)
+{
+    b8 loadCalled = FALSE;
+    Project *pLoaded = nullptr;
+    Project::CreateAsync(FileSystem::CWD() + "/missing.rppproj", [&](Project *pResult)
+                         {
+                             loadCalled = TRUE;
+                             pLoaded = pResult; });
+
+    ASSERT_TRUE(Async::WaitIdle(5000));
+    Async::ProcessCompletions();
+
+    EXPECT_TRUE(loadCalled);
+    EXPECT_EQ(pLoaded, nullptr);
+}
@@ -12,7 +12,7 @@ PROJECT_BASE_DIR = os.path.dirname(os.getcwd())
 RESULTS_FILE_PATH = os.path.join(
     PROJECT_BASE_DIR,
     "e2e",
-    "results.json",
+    "results.jsonl",
 )
 
 if os.name == "nt":
@@ -122,8 +122,8 @@ def main():
     if os.path.exists(RESULTS_FILE_PATH):
         os.remove(RESULTS_FILE_PATH)
 
-    with open(RESULTS_FILE_PATH, "w") as resultsFile:
-        resultsFile.write("[]")
+    # JSON Lines: the test executables append one record per test case
+    open(RESULTS_FILE_PATH, "w").close()
 
     isTestFound = False
     runTests: list[str] = []  # all tests to run
@@ -161,7 +161,7 @@ def main():
     table.add_column("Error Message", width=80)
 
     with open(RESULTS_FILE_PATH, "r") as resultsFile:
-        resultsContent = json.loads(resultsFile.read())
+        resultsContent = [json.loads(line) for line in resultsFile if line.strip()]
         for result in resultsContent:
             assert "name" in result, "Each result must have a 'scenario' field."
             assert "status" in result, "Each result must have a 'status' field."